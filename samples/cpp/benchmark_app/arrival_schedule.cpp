@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrival_schedule.hpp"
+// clang-format on
+
+namespace {
+std::vector<double> read_trace(const std::string& trace_file) {
+    std::ifstream file(trace_file);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot open arrival trace file " + trace_file);
+    }
+    std::vector<double> trace;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        const double time = std::stod(line);
+        if (!trace.empty() && time < trace.back()) {
+            throw std::logic_error("Arrival times in the trace file " + trace_file + " should be non-decreasing");
+        }
+        trace.push_back(time);
+    }
+    if (trace.size() < 2 || trace.back() == trace.front()) {
+        throw std::logic_error("Arrival trace file " + trace_file +
+                               " should contain at least 2 different arrival times");
+    }
+    // the first request of the trace arrives at the start of the measurement
+    const double first = trace.front();
+    for (auto& time : trace) {
+        time -= first;
+    }
+    return trace;
+}
+
+Time::duration to_duration(double milliseconds) {
+    return std::chrono::duration_cast<Time::duration>(std::chrono::duration<double, std::milli>(milliseconds));
+}
+}  // namespace
+
+ArrivalSchedule::Ptr ArrivalSchedule::create(const std::string& mode, double rate, const std::string& trace_file) {
+    if (mode == "trace") {
+        if (trace_file.empty()) {
+            throw std::logic_error("-arrival_trace should be set for the trace arrival mode");
+        }
+        auto trace = read_trace(trace_file);
+        // the rate the trace is recorded with, the sweep scales the arrival times to change it
+        const double trace_rate = 1000.0 * (trace.size() - 1) / trace.back();
+        return Ptr(new ArrivalSchedule(Mode::TRACE, trace_rate, std::move(trace)));
+    }
+    if (rate <= 0) {
+        throw std::logic_error("-rate should be positive for the " + mode + " arrival mode");
+    }
+    if (mode == "constant") {
+        return Ptr(new ArrivalSchedule(Mode::CONSTANT, rate, {}));
+    }
+    if (mode == "poisson") {
+        return Ptr(new ArrivalSchedule(Mode::POISSON, rate, {}));
+    }
+    throw std::logic_error("Incorrect arrival mode " + mode + ". It should be constant, poisson or trace");
+}
+
+ArrivalSchedule::ArrivalSchedule(Mode mode, double rate, std::vector<double> trace)
+    : _mode(mode),
+      _rate(rate),
+      _trace(std::move(trace)),
+      _generator(std::mt19937::default_seed),
+      _interval(rate / 1000.0) {}
+
+ArrivalSchedule::Ptr ArrivalSchedule::with_rate(double rate) const {
+    auto trace = _trace;
+    for (auto& time : trace) {
+        time *= _rate / rate;
+    }
+    return Ptr(new ArrivalSchedule(_mode, rate, std::move(trace)));
+}
+
+void ArrivalSchedule::start(Time::time_point start_time) {
+    _index = 0;
+    _start_time = start_time;
+    _next_time = start_time;
+    // the same sequence of intervals for every run, so the runs of the sweep are comparable
+    _generator.seed(std::mt19937::default_seed);
+    _interval.reset();
+}
+
+bool ArrivalSchedule::next(Time::time_point& arrival_time) {
+    switch (_mode) {
+    case Mode::CONSTANT:
+        // computed from the index instead of accumulating the intervals, so the rounding errors don't drift
+        arrival_time = _start_time + to_duration(1000.0 * _index / _rate);
+        break;
+    case Mode::POISSON:
+        arrival_time = _next_time;
+        _next_time += to_duration(_interval(_generator));
+        break;
+    case Mode::TRACE:
+        if (_index == _trace.size()) {
+            return false;
+        }
+        arrival_time = _start_time + to_duration(_trace[_index]);
+        break;
+    }
+    ++_index;
+    return true;
+}
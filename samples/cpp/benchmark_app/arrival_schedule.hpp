@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "utils.hpp"
+// clang-format on
+
+/// @brief Arrival times of the requests in the open loop mode.
+/// Unlike the closed loop, where a request is restarted as soon as the previous one completes,
+/// the requests arrive independently of the completions, so the latency includes the time a request
+/// waits for an idle infer request.
+class ArrivalSchedule {
+public:
+    using Ptr = std::unique_ptr<ArrivalSchedule>;
+
+    enum class Mode { CONSTANT, POISSON, TRACE };
+
+    /// @param mode "constant", "poisson" or "trace"
+    /// @param rate the average number of requests per second, ignored for the trace
+    /// @param trace_file the file with the arrival time of each request in milliseconds, one per line
+    static Ptr create(const std::string& mode, double rate, const std::string& trace_file);
+
+    /// @brief Starts a new schedule with the same parameters, the first request arrives at the given time
+    void start(Time::time_point start_time);
+
+    /// @brief Gets the arrival time of the next request
+    /// @return false if the trace is over
+    bool next(Time::time_point& arrival_time);
+
+    /// @brief Creates the schedule of the same mode with another rate, used by the rate sweep
+    Ptr with_rate(double rate) const;
+
+    double get_rate() const {
+        return _rate;
+    }
+
+    Mode get_mode() const {
+        return _mode;
+    }
+
+private:
+    ArrivalSchedule(Mode mode, double rate, std::vector<double> trace);
+
+    Mode _mode;
+    double _rate;
+    std::vector<double> _trace;  // arrival times in milliseconds from the start of the trace
+    size_t _index = 0;
+    Time::time_point _start_time;
+    Time::time_point _next_time;
+    std::mt19937 _generator;
+    std::exponential_distribution<double> _interval;
+};
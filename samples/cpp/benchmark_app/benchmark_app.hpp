@@ -225,6 +225,42 @@ static const char pc_sort_message[] =
 // @brief message for performance counters for sequence option
 static const char pcseq_message[] = "Optional. Report latencies for each shape in -data_shape sequence.";
 
+// @brief message for arrival option
+static const char arrival_message[] =
+    "Optional. Enables the open loop mode: the requests arrive at the scheduled times independently of the "
+    "completion of the previous ones, and the latency is measured from the scheduled arrival, so it includes the "
+    "queueing. Requires async API.\n"
+    "                              'constant': the requests arrive with the constant rate set by -rate.\n"
+    "                              'poisson': the requests arrive as a Poisson process with the average rate set by "
+    "-rate.\n"
+    "                              'trace': the arrival times are replayed from the -arrival_trace file.\n"
+    "                              By default the closed loop is used: each request is restarted as soon as it "
+    "completes.";
+
+// @brief message for rate option
+static const char rate_message[] =
+    "Optional. Number of requests per second for the constant and poisson arrival modes.";
+
+// @brief message for arrival_trace option
+static const char arrival_trace_message[] =
+    "Optional. Path to a file with the arrival time of each request in milliseconds, one per line, for the trace "
+    "arrival mode.";
+
+// @brief message for target_p99 option
+static const char target_p99_message[] =
+    "Optional. Target p99 latency in milliseconds. Enables the sweep: after the measurement, the open loop is run "
+    "with the rates found by the binary search up to the measured throughput, and the maximum rate which meets the "
+    "target p99 latency is reported. Uses the arrival mode set by -arrival, 'constant' by default.";
+
+// @brief message for sweep_steps option
+static const char sweep_steps_message[] = "Optional. Number of the rates tried by the sweep. Default value is 8.";
+
+// @brief message for sweep_step_time option
+static const char sweep_step_time_message[] =
+    "Optional. Time in seconds each rate is tried by the sweep, the time set by -t is used if it is shorter. The "
+    "maximum rate found is then run for the full time and its statistics and performance counters are reported. "
+    "Default value is 5.";
+
 // @brief message for exec_graph_path option
 static const char exec_graph_path_message[] =
     "Optional. Path to a file where to store executable graph information serialized.";
@@ -373,6 +409,24 @@ DEFINE_string(pcsort, "", pc_sort_message);
 /// @brief Define flag for showing performance sequence counters <br>
 DEFINE_bool(pcseq, false, pcseq_message);
 
+/// @brief Define flag for the arrival mode of the open loop <br>
+DEFINE_string(arrival, "", arrival_message);
+
+/// @brief Number of requests per second in the open loop
+DEFINE_double(rate, 0, rate_message);
+
+/// @brief Path to a file with the arrival times of the requests
+DEFINE_string(arrival_trace, "", arrival_trace_message);
+
+/// @brief Target p99 latency of the rate sweep
+DEFINE_double(target_p99, 0, target_p99_message);
+
+/// @brief Number of the rates tried by the sweep
+DEFINE_uint64(sweep_steps, 8, sweep_steps_message);
+
+/// @brief Time of each rate tried by the sweep
+DEFINE_uint64(sweep_step_time, 5, sweep_step_time_message);
+
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
@@ -441,4 +495,12 @@ static void show_usage() {
     std::cout << "    -exec_graph_path        " << exec_graph_path_message << std::endl;
     std::cout << "    -dump_config            " << dump_config_message << std::endl;
     std::cout << "    -load_config            " << load_config_message << std::endl;
+    std::cout << std::endl;
+    std::cout << "Open loop options:" << std::endl;
+    std::cout << "    -arrival  <constant/poisson/trace>  " << arrival_message << std::endl;
+    std::cout << "    -rate  <number>         " << rate_message << std::endl;
+    std::cout << "    -arrival_trace  <path>  " << arrival_trace_message << std::endl;
+    std::cout << "    -target_p99  <number>   " << target_p99_message << std::endl;
+    std::cout << "    -sweep_steps  <integer> " << sweep_steps_message << std::endl;
+    std::cout << "    -sweep_step_time  <integer> " << sweep_step_time_message << std::endl;
 }
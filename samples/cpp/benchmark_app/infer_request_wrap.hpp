@@ -50,6 +50,13 @@ public:
         _request.start_async();
     }
 
+    /// @brief Starts the request which has been scheduled to arrive at the given time (open loop mode).
+    /// The latency is measured from the arrival, so it includes the time the request waited for this infer request.
+    void start_async(const Time::time_point& arrivalTime) {
+        _startTime = arrivalTime;
+        _request.start_async();
+    }
+
     void wait() {
         _request.wait();
     }
@@ -7,6 +7,8 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -28,6 +30,7 @@
 #include "samples/common.hpp"
 #include "samples/slog.hpp"
 
+#include "arrival_schedule.hpp"
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
@@ -88,6 +91,14 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         throw std::logic_error(pcsort_err);
     }
 
+    if ((!FLAGS_arrival.empty() || FLAGS_target_p99 != 0) && FLAGS_api != "async") {
+        throw std::logic_error("The open loop mode (-arrival and -target_p99 options) requires -api async.");
+    }
+    if (FLAGS_target_p99 < 0 || (FLAGS_target_p99 > 0 && (FLAGS_sweep_steps == 0 || FLAGS_sweep_step_time == 0))) {
+        throw std::logic_error(
+            "Incorrect sweep parameters. -target_p99, -sweep_steps and -sweep_step_time should be positive.");
+    }
+
     bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
     bool isPrecisionSet = !(FLAGS_ip.empty() && FLAGS_op.empty() && FLAGS_iop.empty());
     if (isNetworkCompiled && isPrecisionSet) {
@@ -896,6 +907,12 @@ int main(int argc, char* argv[]) {
         }
         uint64_t duration_nanoseconds = get_duration_in_nanoseconds(duration_seconds);
 
+        // Arrival schedule of the open loop
+        ArrivalSchedule::Ptr arrivals;
+        if (!FLAGS_arrival.empty()) {
+            arrivals = ArrivalSchedule::create(FLAGS_arrival, FLAGS_rate, FLAGS_arrival_trace);
+        }
+
         if (statistics) {
             statistics->add_parameters(
                 StatisticsReport::Category::RUNTIME_CONFIG,
@@ -909,6 +926,12 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("number of iterations", "iterations_num", niter),
                      StatisticsVariant("number of parallel infer requests", "nireq", nireq),
                      StatisticsVariant("duration (ms)", "duration", get_duration_in_milliseconds(duration_seconds))}));
+            if (arrivals) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::RUNTIME_CONFIG,
+                    {StatisticsVariant("arrival mode", "arrival_mode", FLAGS_arrival),
+                     StatisticsVariant("arrival rate (requests/s)", "arrival_rate", arrivals->get_rate())});
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -973,8 +996,6 @@ int main(int argc, char* argv[]) {
         }
         // ----------------- 10. Measuring performance
         // ------------------------------------------------------------------
-        size_t iteration = 0;
-
         std::stringstream ss;
         ss << "Start inference " << FLAGS_api << "hronously";
         if (FLAGS_api == "async") {
@@ -993,6 +1014,10 @@ int main(int argc, char* argv[]) {
                 ss << " using " << device_ss.str();
             }
         }
+        if (arrivals) {
+            ss << ", " << FLAGS_arrival << " arrivals with " << double_to_string(arrivals->get_rate())
+               << " requests/s";
+        }
         ss << ", limits: ";
         if (duration_seconds > 0) {
             ss << get_duration_in_milliseconds(duration_seconds) << " ms duration";
@@ -1087,62 +1112,86 @@ int main(int argc, char* argv[]) {
                 StatisticsReport::Category::EXECUTION_RESULTS,
                 {StatisticsVariant("first inference time (ms)", "first_inference_time", duration_ms)});
         }
-        inferRequestsQueue.reset_times();
-
-        size_t processedFramesN = 0;
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
         /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
-            if (!inferRequest) {
-                OPENVINO_THROW("No idle Infer Requests!");
+        /** In the open loop mode the requests are started at the arrival times of the schedule, the latency is
+         * measured from the arrival, so it includes the time the request waited for an idle infer request **/
+        auto measure = [&](ArrivalSchedule* schedule, uint64_t niter, uint64_t duration_nanoseconds) {
+            inferRequestsQueue.reset_times();
+            size_t iteration = 0;
+            size_t processedFramesN = 0;
+            auto startTime = Time::now();
+            auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+            if (schedule) {
+                schedule->start(startTime);
             }
 
-            if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
-
-                if (FLAGS_pcseq) {
-                    inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
+            /** to align number if iterations to guarantee that last infer requests are
+             * executed in the same conditions **/
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                Time::time_point arrivalTime;
+                if (schedule) {
+                    if (!schedule->next(arrivalTime)) {
+                        // the trace is over
+                        break;
+                    }
+                    std::this_thread::sleep_until(arrivalTime);
                 }
 
-                if (isDynamicNetwork) {
-                    batchSize = get_batch_size(inputs);
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    OPENVINO_THROW("No idle Infer Requests!");
                 }
 
-                for (auto& item : inputs) {
-                    auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
-                    inferRequest->set_tensor(inputName, data);
-                }
+                if (!inferenceOnly) {
+                    auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
 
-                if (useGpuMem) {
-                    auto outputTensors =
-                        ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
-                    for (auto& output : compiledModel.outputs()) {
-                        inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
+                    if (FLAGS_pcseq) {
+                        inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
+                    }
+
+                    if (isDynamicNetwork) {
+                        batchSize = get_batch_size(inputs);
+                    }
+
+                    for (auto& item : inputs) {
+                        auto inputName = item.first;
+                        const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
+                        inferRequest->set_tensor(inputName, data);
+                    }
+
+                    if (useGpuMem) {
+                        auto outputTensors =
+                            ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
+                        for (auto& output : compiledModel.outputs()) {
+                            inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
+                        }
                     }
                 }
-            }
 
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                inferRequest->start_async();
+                if (FLAGS_api == "sync") {
+                    inferRequest->infer();
+                } else if (schedule) {
+                    inferRequest->start_async(arrivalTime);
+                } else {
+                    inferRequest->start_async();
+                }
+                ++iteration;
+
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                processedFramesN += batchSize;
             }
-            ++iteration;
 
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-            processedFramesN += batchSize;
-        }
+            // wait the latest inference executions
+            inferRequestsQueue.wait_all();
+            return std::make_pair(iteration, processedFramesN);
+        };
 
-        // wait the latest inference executions
-        inferRequestsQueue.wait_all();
+        size_t iteration = 0;
+        size_t processedFramesN = 0;
+        std::tie(iteration, processedFramesN) = measure(arrivals.get(), niter, duration_nanoseconds);
 
         LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
         std::vector<LatencyMetrics> groupLatencies = {};
@@ -1183,6 +1232,12 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("Average latency (ms)", "latency_avg", generalLatency.avg),
                      StatisticsVariant("Min latency (ms)", "latency_min", generalLatency.min),
                      StatisticsVariant("Max latency (ms)", "latency_max", generalLatency.max)});
+                for (const auto& percentile : generalLatency.percentiles) {
+                    const auto name = percentile_name(percentile.first);
+                    statistics->add_parameters(
+                        StatisticsReport::Category::EXECUTION_RESULTS,
+                        {StatisticsVariant(name + " latency (ms)", "latency_" + name, percentile.second)});
+                }
 
                 if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                     for (size_t i = 0; i < groupLatencies.size(); ++i) {
@@ -1195,6 +1250,70 @@ int main(int argc, char* argv[]) {
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
         }
+
+        // Rate sweep: the binary search of the maximum rate which meets the target p99 latency.
+        // The measured rate is the upper bound, it's the throughput in the closed loop and the rate of the schedule
+        // in the open loop, unless the device can't sustain it. Each rate is tried for the sweep step time, then the
+        // rate found is run for the full time, the performance counters are the ones of this final run.
+        double maxRate = 0;
+        double finalRate = 0;
+        LatencyMetrics finalLatency;
+        double finalFps = 0;
+        if (FLAGS_target_p99 > 0) {
+            const double measuredRate = 1000.0 * iteration / totalDuration;
+            auto sweepArrivals = arrivals ? arrivals->with_rate(measuredRate)
+                                          : ArrivalSchedule::create("constant", measuredRate, "");
+            slog::info << "Searching for the maximum rate with p99 latency within "
+                       << double_to_string(FLAGS_target_p99) << " ms" << slog::endl;
+            double passedRate = 0;
+            double failedRate = measuredRate;
+            double rate = measuredRate;
+            auto step_nanoseconds = get_duration_in_nanoseconds(FLAGS_sweep_step_time);
+            if (duration_nanoseconds != 0) {
+                step_nanoseconds = std::min(step_nanoseconds, duration_nanoseconds);
+            }
+            for (uint64_t step = 0; step < FLAGS_sweep_steps; step++) {
+                auto schedule = sweepArrivals->with_rate(rate);
+                measure(schedule.get(), 0, step_nanoseconds);
+                const double p99 = LatencyMetrics(inferRequestsQueue.get_latencies(), "", 99).median_or_percentile;
+                slog::info << "   " << double_to_string(rate) << " requests/s: p99 latency " << double_to_string(p99)
+                           << " ms" << slog::endl;
+                if (p99 <= FLAGS_target_p99) {
+                    passedRate = rate;
+                    if (step == 0) {
+                        // the device meets the target even at the measured rate
+                        break;
+                    }
+                } else {
+                    failedRate = rate;
+                }
+                rate = (passedRate + failedRate) / 2;
+            }
+            maxRate = passedRate;
+
+            // if no rate meets the target, the lowest rate tried is reported
+            finalRate = maxRate > 0 ? maxRate : failedRate;
+            auto schedule = sweepArrivals->with_rate(finalRate);
+            const auto finalFrames = measure(schedule.get(), niter, duration_nanoseconds).second;
+            finalLatency = LatencyMetrics(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
+            finalFps = 1000.0 * finalFrames / inferRequestsQueue.get_duration_in_milliseconds();
+
+            if (statistics) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("target p99 latency (ms)", "target_p99", FLAGS_target_p99),
+                     StatisticsVariant("max rate meeting target p99 (requests/s)", "max_rate", maxRate),
+                     StatisticsVariant("final run rate (requests/s)", "final_rate", finalRate),
+                     StatisticsVariant("final run throughput", "final_throughput", finalFps)});
+                for (const auto& percentile : finalLatency.percentiles) {
+                    const auto name = percentile_name(percentile.first);
+                    statistics->add_parameters(
+                        StatisticsReport::Category::EXECUTION_RESULTS,
+                        {StatisticsVariant("final run " + name + " latency (ms)", "final_latency_" + name,
+                                           percentile.second)});
+                }
+            }
+        }
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
         next_step();
@@ -1214,6 +1333,10 @@ int main(int argc, char* argv[]) {
         }
 
         if (perf_counts) {
+            if (FLAGS_target_p99 > 0) {
+                slog::info << "Performance counts are measured in the final run at " << double_to_string(finalRate)
+                           << " requests/s" << slog::endl;
+            }
             std::vector<std::vector<ov::ProfilingInfo>> perfCounts;
             for (size_t ireq = 0; ireq < nireq; ireq++) {
                 auto reqPerfCounts = inferRequestsQueue.requests[ireq]->get_performance_counts();
@@ -1251,6 +1374,14 @@ int main(int argc, char* argv[]) {
         if (device_name.find("MULTI") == std::string::npos) {
             slog::info << "Latency:" << slog::endl;
             generalLatency.write_to_slog();
+            if (arrivals) {
+                // the tail latencies the open loop is run for
+                for (const auto& percentile : generalLatency.percentiles) {
+                    auto label = percentile_name(percentile.first) + ":";
+                    label.resize(18, ' ');
+                    slog::info << "   " << label << double_to_string(percentile.second) << " ms" << slog::endl;
+                }
+            }
 
             if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                 slog::info << "Latency for each data shape group:" << slog::endl;
@@ -1271,6 +1402,18 @@ int main(int argc, char* argv[]) {
         }
 
         slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
+        if (FLAGS_target_p99 > 0) {
+            slog::info << "Max rate with p99 latency within " << double_to_string(FLAGS_target_p99)
+                       << " ms: " << double_to_string(maxRate) << " requests/s" << slog::endl;
+            slog::info << "Final run at " << double_to_string(finalRate) << " requests/s:" << slog::endl;
+            finalLatency.write_to_slog();
+            for (const auto& percentile : finalLatency.percentiles) {
+                auto label = percentile_name(percentile.first) + ":";
+                label.resize(18, ' ');
+                slog::info << "   " << label << double_to_string(percentile.second) << " ms" << slog::endl;
+            }
+            slog::info << "   Throughput:       " << double_to_string(finalFps) << " FPS" << slog::endl;
+        }
 
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
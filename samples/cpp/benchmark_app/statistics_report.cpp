@@ -340,6 +340,11 @@ static nlohmann::json to_json(const LatencyMetrics& latenct_metrics) {
     stat["latency_average"] = latenct_metrics.avg;
     stat["latency_min"] = latenct_metrics.min;
     stat["latency_max"] = latenct_metrics.max;
+    auto& percentiles = stat["latency_percentiles"];
+    percentiles = nlohmann::json::object();
+    for (const auto& percentile : latenct_metrics.percentiles) {
+        percentiles[percentile_name(percentile.first)] = percentile.second;
+    }
     return stat;
 }
 
@@ -9,6 +9,7 @@
 #include <map>
 #include <openvino/openvino.hpp>
 #include <samples/slog.hpp>
+#include <sstream>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -37,6 +38,13 @@ inline double get_duration_ms_till_now(Time::time_point& startTime) {
     return std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
 };
 
+/// @brief Name of the latency percentile in the reports, e.g. "p99.9"
+inline std::string percentile_name(double percentile) {
+    std::ostringstream name;
+    name << "p" << percentile;
+    return name.str();
+}
+
 namespace benchmark_app {
 struct InputInfo {
     ov::element::Type type;
@@ -34,8 +34,12 @@ public:
     double avg = 0;
     double min = 0;
     double max = 0;
+    // tail latencies (p50, p90, p99, p99.9), see tail_percentiles
+    std::vector<std::pair<double, double>> percentiles;
     std::string data_shape;
 
+    static const std::vector<double> tail_percentiles;
+
 private:
     void fill_data(std::vector<double> latencies, size_t percentile_boundary);
     size_t percentile_boundary = 50;
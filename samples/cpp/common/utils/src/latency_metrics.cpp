@@ -12,6 +12,8 @@
 #include "samples/latency_metrics.hpp"
 // clang-format on
 
+const std::vector<double> LatencyMetrics::tail_percentiles = {50, 90, 99, 99.9};
+
 void LatencyMetrics::write_to_stream(std::ostream& stream) const {
     std::ios::fmtflags fmt(std::cout.flags());
     stream << data_shape << ";" << std::fixed << std::setprecision(2) << median_or_percentile << ";" << avg << ";"
@@ -39,4 +41,9 @@ void LatencyMetrics::fill_data(std::vector<double> latencies, size_t percentile_
     avg = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
     median_or_percentile = latencies[size_t(latencies.size() / 100.0 * percentile_boundary)];
     max = latencies.back();
+    percentiles.clear();
+    for (auto percentile : tail_percentiles) {
+        const auto index = std::min(size_t(latencies.size() / 100.0 * percentile), latencies.size() - 1);
+        percentiles.emplace_back(percentile, latencies[index]);
+    }
 };
@@ -11,6 +11,7 @@
 #include "snippets_isa.hpp"
 
 #include "snippets/lowered/linear_ir.hpp"
+#include "snippets/runtime_config.hpp"
 #include "snippets/shape_types.hpp"
 #include "target_machine.hpp"
 
@@ -25,6 +26,8 @@ class Generator;
  * @param compiled_snippet pointer to interface class that encapsulates compiled binary code
  * @param buffer_scratchpad_size the amount of additional memory required by the binary code to execute.
  * Must be allocated and freed by the backend.
+ * @param runtime_config description of the runtime args of shape-agnostic code, nullptr if the code is generated for static shapes.
+ * The backend must update it for every new shape and pass the runtime args to the binary code.
  */
 class LoweringResult {
     friend class Generator;
@@ -35,6 +38,7 @@ class LoweringResult {
 public:
     std::shared_ptr<CompiledSnippet> compiled_snippet = nullptr;
     size_t buffer_scratchpad_size = 0;
+    std::shared_ptr<RuntimeConfig> runtime_config = nullptr;
 };
 
 /**
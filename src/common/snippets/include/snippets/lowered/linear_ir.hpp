@@ -47,6 +47,9 @@ public:
     // True if the Buffer scratchpad size of LinearIR will be optimized (all possible optimizations will be activated)
     // False if all Buffers will have uniqie ID and offsets in the Linear IR
     bool m_are_buffers_optimized = true;
+    // True if the generated code must not depend on the particular shape values, only on the broadcasting pattern:
+    // Loop work amounts, data pointer shifts and tail sizes are read from the kernel runtime args (see RuntimeConfig)
+    bool m_is_shape_agnostic = false;
 };
 
 /* The control flow of Snippets is built on Linear Intermediate Representation (Linear IR).
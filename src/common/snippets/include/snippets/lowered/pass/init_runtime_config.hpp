@@ -0,0 +1,36 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "pass.hpp"
+
+#include "snippets/runtime_config.hpp"
+
+namespace ov {
+namespace snippets {
+namespace lowered {
+namespace pass {
+
+/**
+ * @interface InitRuntimeConfig
+ * @brief Registers all Loops of shape-agnostic Linear IR in RuntimeConfig and sets to every LoopEnd the index of its args
+ *        in the kernel runtime args. Must be called after InsertTailLoop, since the main body and tail Loops
+ *        get different runtime work amounts.
+ * @ingroup snippets
+ */
+class InitRuntimeConfig : public Pass {
+public:
+    OPENVINO_RTTI("InitRuntimeConfig", "Pass")
+    InitRuntimeConfig(std::shared_ptr<RuntimeConfig>& runtime_config);
+    bool run(LinearIR& linear_ir) override;
+
+private:
+    std::shared_ptr<RuntimeConfig>& m_runtime_config;
+};
+
+} // namespace pass
+} // namespace lowered
+} // namespace snippets
+} // namespace ov
@@ -0,0 +1,33 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "pass.hpp"
+
+namespace ov {
+namespace snippets {
+namespace lowered {
+namespace pass {
+
+/**
+ * @interface ReduceDecomposition
+ * @brief Decomposes snippets Reduce operations to the accumulation Loop by the innermost dimension
+ *        (VectorBuffer, Fill, Add or Maximum) and HorizonSum or HorizonMax after it
+ * @ingroup snippets
+ */
+class ReduceDecomposition : public Pass {
+public:
+    OPENVINO_RTTI("ReduceDecomposition", "Pass")
+    explicit ReduceDecomposition(size_t vector_size);
+    bool run(LinearIR& linear_ir) override;
+
+private:
+    size_t m_vector_size;
+};
+
+} // namespace pass
+} // namespace lowered
+} // namespace snippets
+} // namespace ov
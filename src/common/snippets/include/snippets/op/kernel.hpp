@@ -6,6 +6,7 @@
 
 #include "openvino/op/op.hpp"
 #include "snippets/lowered/linear_ir.hpp"
+#include "snippets/runtime_config.hpp"
 
 namespace ov {
 namespace snippets {
@@ -29,6 +30,8 @@ public:
         return std::make_shared<Kernel>(region);
     }
     const void *compile_params = nullptr;
+    // Set only if the kernel is shape-agnostic: describes where the shape dependent values are stored in runtime args
+    std::shared_ptr<const RuntimeConfig> runtime_config = nullptr;
 };
 
 } // namespace op
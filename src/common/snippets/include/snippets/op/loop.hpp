@@ -6,6 +6,7 @@
 
 #include "openvino/op/op.hpp"
 #include "snippets/emitter.hpp"
+#include "snippets/runtime_config.hpp"
 #include "openvino/op/parameter.hpp"
 
 namespace ov {
@@ -87,6 +88,9 @@ public:
     void set_increment(size_t new_increment);
     void set_evaluate_once(bool once);
     void set_id(size_t new_id);
+    // Shape-agnostic Loops read work_amount, ptr_increments and finalization_offsets from the kernel runtime args
+    // starting from this index (see RuntimeConfig), the static values are ignored in this case
+    void set_runtime_args_idx(size_t idx);
     // Used to propagate information about Loop structure, needed to simplify some optimizations. For example,
     // to skip pointer increments when outer Loop is empty, and work_amount == vector_size (one inner vector Loop)
     // true by default, the optimizations enabled if it's false;
@@ -95,6 +99,8 @@ public:
     size_t get_increment() const;
     bool get_evaluate_once() const;
     size_t get_id() const;
+    size_t get_runtime_args_idx() const;
+    bool is_dynamic() const;
     bool visit_attributes(AttributeVisitor& visitor) override;
 
 private:
@@ -108,6 +114,7 @@ private:
     size_t m_output_num = 0;
     size_t m_id = 0;  // the corresponding Loop identificator in LoopManager
     bool m_evaluate_once = false; // true if the Loop is executed only once, used to skip setting and testing the loop counter
+    size_t m_runtime_args_idx = RuntimeConfig::UNDEFINED_IDX;
 };
 
 } // namespace op
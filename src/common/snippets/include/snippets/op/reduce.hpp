@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface ReduceBase
+ * @brief Base class for reduction operations by the innermost dimension. The reduced dimension is kept in the output shape (equal to 1).
+ *        The operations are decomposed into accumulation Loop and Horizon operation on Linear IR (see ReduceDecomposition)
+ * @ingroup snippets
+ */
+class ReduceBase : public ov::op::Op {
+public:
+    OPENVINO_OP("ReduceBase", "SnippetsOpset");
+
+    ReduceBase(const Output<Node>& x);
+    ReduceBase() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override { return true; }
+    void validate_and_infer_types() override;
+};
+
+/**
+ * @interface ReduceSum
+ * @brief Sum of the elements by the innermost dimension
+ * @ingroup snippets
+ */
+class ReduceSum : public ReduceBase {
+public:
+    OPENVINO_OP("ReduceSum", "SnippetsOpset", ReduceBase);
+
+    ReduceSum(const Output<Node>& x) : ReduceBase(x) {}
+    ReduceSum() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+};
+
+/**
+ * @interface ReduceMax
+ * @brief Maximum of the elements by the innermost dimension
+ * @ingroup snippets
+ */
+class ReduceMax : public ReduceBase {
+public:
+    OPENVINO_OP("ReduceMax", "SnippetsOpset", ReduceBase);
+
+    ReduceMax(const Output<Node>& x) : ReduceBase(x) {}
+    ReduceMax() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ov
@@ -120,6 +120,17 @@ public:
     // it's going to be replaced with Jitters table later
     void set_generator(std::shared_ptr<ov::snippets::Generator> generator);
     void set_tile_rank(size_t newRank) {tileRank = newRank;}
+    // Must be set before convert_body_to_linear_ir: the code is generated once per broadcasting pattern instead of
+    // once per shape, the shape dependent values are calculated by the backend using Schedule's RuntimeConfig
+    void set_shape_agnostic(bool value) {m_is_shape_agnostic = value;}
+    bool is_shape_agnostic() const { return m_is_shape_agnostic; }
+    // Returns true if the body can be lowered to the shape-agnostic code:
+    // only element-wise bodies are supported since they don't need Buffers and Loop specific tail processing
+    bool is_shape_agnostic_supported() const;
+    // Returns true if the op can be a part of the body lowered to the shape-agnostic code
+    static bool is_shape_agnostic_supported_op(const std::shared_ptr<const ov::Node>& op);
+    // Shape-agnostic code keeps the runtime args pointer in one more GPR, so fewer GPRs are left for the data pointers
+    static constexpr size_t shape_agnostic_max_data_count = 10;
     void set_virtual_port_count(size_t count);
 
     void print() const;
@@ -136,7 +147,7 @@ public:
     static bool check_broadcast(const std::shared_ptr<const ov::Node>& node) noexcept;
     // Return estimated unique buffer count (upper bound). It's needed for tokenization
     static auto get_estimated_buffer_count(const ov::NodeVector& ops) -> size_t;
-    static auto is_domain_sensitive_op(const std::shared_ptr<ov::Node>& op) -> bool;
+    static auto is_domain_sensitive_op(const std::shared_ptr<const ov::Node>& op) -> bool;
 
     void data_flow_transformations(const BlockedShapeVector& blocked_input_shapes = {},
                                    const std::vector<ov::element::Type>& input_precisions = {},
@@ -162,6 +173,7 @@ private:
     std::shared_ptr<ov::snippets::Generator> m_generator = nullptr;
 
     size_t tileRank = 0; // set by plugin to specify the number of dimensions processed in a single kernel call
+    bool m_is_shape_agnostic = false;
     std::vector<size_t> appendOnesForCanonical;
     std::shared_ptr<lowered::LinearIR> m_linear_ir = nullptr;
 
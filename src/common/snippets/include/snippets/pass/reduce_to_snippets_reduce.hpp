@@ -0,0 +1,31 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+
+namespace ov {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface ReduceToSnippetsReduce
+ * @brief Converts ReduceSum, ReduceMax and ReduceMean by the innermost dimension to snippets ReduceSum and ReduceMax.
+ *        ReduceMean is converted to ReduceSum followed by Multiply by the reciprocal of the reduced dimension.
+ *        The pass must be called before Canonicalization, since the reduction axes depend on the original rank.
+ * @ingroup snippets
+ */
+class ReduceToSnippetsReduce: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ReduceToSnippetsReduce", "0");
+    ReduceToSnippetsReduce();
+
+    static bool is_supported_reduce(const std::shared_ptr<const ov::Node>& node);
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ov
@@ -0,0 +1,27 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+
+namespace ov {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface SetReducePorts
+ * @brief The pass updates port descriptors of snippets Reduce operations: the innermost dimension is processed
+ *        by the accumulation Loop that is inserted by ReduceDecomposition
+ * @ingroup snippets
+ */
+class SetReducePorts: public ov::pass::MatcherPass {
+public:
+    SetReducePorts();
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ov
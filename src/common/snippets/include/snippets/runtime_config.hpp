@@ -0,0 +1,94 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A file contains the description of the runtime arguments of shape-agnostic kernels.
+ * @file runtime_config.hpp
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "snippets/shape_types.hpp"
+
+namespace ov {
+namespace snippets {
+
+/**
+ * @interface RuntimeConfig
+ * @brief Describes the shape dependent values that a shape-agnostic kernel reads at runtime
+ *        and calculates them for the particular I/O shapes.
+ *        The values are stored in one flat array of int64_t ("runtime args"):
+ *          - per Loop:    [work_amount, ptr_increments (bytes) x N, finalization_offsets (bytes) x N], N - the number of Loop ports
+ *          - at the end:  data offsets (bytes) of every kernel I/O per dimension of the parallel execution domain
+ *        The Loops are registered during lowering, so the index of every Loop in the runtime args is known at code emission.
+ * @ingroup snippets
+ */
+class RuntimeConfig {
+public:
+    enum class LoopType {
+        Full,       // processes the whole dimension
+        MainBody,   // vector Loop that is followed by a tail Loop, processes the dimension rounded down to the increment
+        Tail        // scalar Loop that processes the rest of the dimension after the main body
+    };
+    struct LoopDesc {
+        // index of the dimension processed by the Loop, counting from the innermost one
+        size_t dim_idx = 0;
+        size_t increment = 1;
+        // the increment of the main body Loop, used only by tail Loops to calculate the tail size
+        size_t main_body_increment = 1;
+        LoopType type = LoopType::Full;
+        // per Loop port: index of the corresponding kernel I/O (inputs first), -1 if the port isn't bound to I/O
+        std::vector<int64_t> io_idxs = {};
+        // per Loop port: true if the data pointer is shifted by the Loop (false for broadcasted dimensions)
+        std::vector<bool> is_incremented = {};
+        std::vector<int64_t> data_sizes = {};
+    };
+    static constexpr size_t UNDEFINED_IDX = std::numeric_limits<size_t>::max();
+
+    RuntimeConfig() = default;
+    RuntimeConfig(size_t num_inputs, std::vector<int64_t> io_data_sizes, size_t loop_depth);
+
+    /**
+     * @brief Registers the Loop in the runtime args
+     * @return index of the first runtime arg of the Loop
+     */
+    size_t add_loop(LoopDesc desc);
+    /**
+     * @brief Index of the first data offset in the runtime args
+     */
+    size_t get_data_offsets_idx() const { return m_loop_args_size; }
+    size_t get_num_inputs() const { return m_num_inputs; }
+    size_t get_io_num() const { return m_io_data_sizes.size(); }
+    const std::vector<LoopDesc>& get_loops() const { return m_loops; }
+
+    /**
+     * @brief Calculates the runtime args for the new shapes
+     * @param io_shapes planar shapes of kernel inputs and outputs, in the order of kernel data pointers
+     * @param tensor_rank rank of the parallel execution domain used by the backend (including the dims processed by kernel)
+     */
+    void update(const std::vector<VectorDims>& io_shapes, size_t tensor_rank);
+    const std::vector<int64_t>& get_runtime_args() const { return m_runtime_args; }
+    const VectorDims& get_master_shape() const { return m_master_shape; }
+    /**
+     * @brief Returns the master shape of the last update where the dimensions processed by kernel are set to 1
+     */
+    VectorDims get_parallel_exec_domain() const;
+
+private:
+    std::vector<LoopDesc> m_loops = {};
+    std::vector<size_t> m_loop_offsets = {};
+    std::vector<int64_t> m_io_data_sizes = {};
+    size_t m_num_inputs = 0;
+    size_t m_loop_depth = 0;
+    size_t m_loop_args_size = 0;
+
+    VectorDims m_master_shape = {};
+    std::vector<int64_t> m_runtime_args = {};
+};
+
+} // namespace snippets
+} // namespace ov
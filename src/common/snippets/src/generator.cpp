@@ -7,6 +7,7 @@
 #include "snippets/lowered/linear_ir.hpp"
 #include "snippets/lowered/pass/assign_registers.hpp"
 #include "snippets/lowered/pass/cleanup_loop_offsets.hpp"
+#include "snippets/lowered/pass/init_runtime_config.hpp"
 #include "snippets/lowered/pass/insert_tail_loop.hpp"
 #include "snippets/lowered/pass/optimize_loop_single_evaluation.hpp"
 
@@ -34,16 +35,24 @@ void Generator::generate(lowered::LinearIR& linear_ir, LoweringResult& result, c
     //       (this might happen if tail loop and main loop have different increments)
     //    3. OptimizeLoopSingleEvaluation must be called after CleanupLoopOffsets
     //       since CleanupLoopOffsets can't handle loops with evaluate_once = true
+    //    4. In shape-agnostic mode CleanupLoopOffsets and OptimizeLoopSingleEvaluation are skipped since they rely on
+    //       the static work amounts. InitRuntimeConfig must be called after InsertTailLoop to register the tail Loops as well
+    const auto is_shape_agnostic = linear_ir.get_config().m_is_shape_agnostic;
     lowered_pipeline.register_pass<lowered::pass::AssignRegisters>(reg_type_mapper);
     lowered_pipeline.register_pass<lowered::pass::InsertTailLoop>();
-    lowered_pipeline.register_pass<lowered::pass::CleanupLoopOffsets>();
-    lowered_pipeline.register_pass<lowered::pass::OptimizeLoopSingleEvaluation>();
+    if (is_shape_agnostic) {
+        lowered_pipeline.register_pass<lowered::pass::InitRuntimeConfig>(result.runtime_config);
+    } else {
+        lowered_pipeline.register_pass<lowered::pass::CleanupLoopOffsets>();
+        lowered_pipeline.register_pass<lowered::pass::OptimizeLoopSingleEvaluation>();
+    }
     lowered_pipeline.run(linear_ir);
     linear_ir.init_emitters(target);
 
     OV_ITT_TASK_NEXT(GENERATE, "::EmitCode")
     auto loops2DKernel = std::make_shared<op::Kernel>(linear_ir);
     loops2DKernel->compile_params = compile_params;
+    loops2DKernel->runtime_config = result.runtime_config;
     auto loops2DKernelExpr = linear_ir.create_expression(loops2DKernel, std::vector<lowered::PortConnectorPtr>{});
     std::shared_ptr<Emitter> kernel = target->get(op::Kernel::get_type_info_static())(loops2DKernelExpr);
 
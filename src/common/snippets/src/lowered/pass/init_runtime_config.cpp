@@ -0,0 +1,123 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/lowered/pass/init_runtime_config.hpp"
+
+#include "snippets/lowered/linear_ir.hpp"
+#include "snippets/lowered/loop_manager.hpp"
+#include "snippets/snippets_isa.hpp"
+#include "snippets/itt.hpp"
+
+namespace ov {
+namespace snippets {
+namespace lowered {
+namespace pass {
+
+using LoopType = RuntimeConfig::LoopType;
+
+InitRuntimeConfig::InitRuntimeConfig(std::shared_ptr<RuntimeConfig>& runtime_config) : Pass(), m_runtime_config(runtime_config) {}
+
+bool InitRuntimeConfig::run(LinearIR& linear_ir) {
+    OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::InitRuntimeConfig")
+    if (linear_ir.empty())
+        return false;
+
+    // Kernel data pointers are ordered as [inputs, outputs]
+    size_t num_inputs = 0;
+    for (const auto& io_expr : linear_ir.get_IO_ops())
+        num_inputs += io_expr->get_type() == IOExpression::io_type::INPUT;
+    std::vector<int64_t> io_data_sizes(linear_ir.get_IO_ops().size(), 0);
+    std::map<ExpressionPtr, int64_t> io_idxs;
+    for (const auto& io_expr : linear_ir.get_IO_ops()) {
+        const auto is_input = io_expr->get_type() == IOExpression::io_type::INPUT;
+        const auto io_idx = is_input ? io_expr->get_index() : static_cast<int64_t>(num_inputs) + io_expr->get_index();
+        OPENVINO_ASSERT(io_idx >= 0 && static_cast<size_t>(io_idx) < io_data_sizes.size(), "Invalid I/O expression index");
+        const auto& node = io_expr->get_node();
+        io_data_sizes[io_idx] = static_cast<int64_t>(is_input ? node->get_output_element_type(0).size() : node->get_input_element_type(0).size());
+        io_idxs[io_expr] = io_idx;
+        if (is_input) {
+            // RankNormalization only reinterprets the shape, so it shares the data pointer with Parameter
+            for (const auto& consumer : io_expr->get_output_port_connector(0)->get_consumers()) {
+                if (ov::is_type<op::RankNormalization>(consumer.get_expr()->get_node()))
+                    io_idxs[consumer.get_expr()] = io_idx;
+            }
+        }
+    }
+    m_runtime_config = std::make_shared<RuntimeConfig>(num_inputs, std::move(io_data_sizes), linear_ir.get_config().m_loop_depth);
+
+    auto get_io_idx = [&io_idxs](const ExpressionPtr& expr) -> int64_t {
+        const auto found = io_idxs.find(expr);
+        return found != io_idxs.end() ? found->second : -1;
+    };
+
+    // In shape-agnostic mode InsertTailLoop inserts the main body Loop right before the tail Loop,
+    // so the tail is the Loop by the same dimension that starts right after the vector Loop.
+    const auto& loop_manager = linear_ir.get_loop_manager();
+    auto get_tail_loop_end = [&](LinearIR::constExprIt loop_end_it) -> std::shared_ptr<op::LoopEnd> {
+        const auto loop_end = ov::as_type_ptr<op::LoopEnd>(loop_end_it->get()->get_node());
+        const auto next_it = std::next(loop_end_it);
+        if (loop_end->get_increment() == 1 || next_it == linear_ir.cend())
+            return nullptr;
+        const auto next_loop_begin = ov::as_type_ptr<op::LoopBegin>(next_it->get()->get_node());
+        if (!next_loop_begin)
+            return nullptr;
+        const auto next_loop_end = next_loop_begin->get_loop_end();
+        if (next_loop_end->get_increment() != 1 ||
+            loop_manager->get_loop_info(next_loop_end->get_id())->get_dim_idx() != loop_manager->get_loop_info(loop_end->get_id())->get_dim_idx())
+            return nullptr;
+        return next_loop_end;
+    };
+
+    std::map<std::shared_ptr<op::LoopEnd>, size_t> tails;
+    for (auto expr_it = linear_ir.cbegin(); expr_it != linear_ir.cend(); ++expr_it) {
+        const auto& expr = *expr_it;
+        const auto loop_end = ov::as_type_ptr<op::LoopEnd>(expr->get_node());
+        if (!loop_end)
+            continue;
+
+        RuntimeConfig::LoopDesc desc;
+        desc.dim_idx = loop_manager->get_loop_info(loop_end->get_id())->get_dim_idx();
+        OPENVINO_ASSERT(desc.dim_idx != LinearIR::LoopManager::LoopInfo::UNDEFINED_DIM_IDX,
+                        "Shape-agnostic Loop must iterate over one dimension");
+        desc.increment = loop_end->get_increment();
+        if (const auto tail_loop_end = get_tail_loop_end(expr_it)) {
+            desc.type = LoopType::MainBody;
+            tails[tail_loop_end] = desc.increment;
+        } else if (tails.count(loop_end)) {
+            desc.type = LoopType::Tail;
+            desc.main_body_increment = tails.at(loop_end);
+        }
+
+        const auto input_num = loop_end->get_input_num();
+        const auto io_num = input_num + loop_end->get_output_num();
+        const auto& is_incremented = loop_end->get_is_incremented();
+        const auto& ptr_increments = loop_end->get_ptr_increments();
+        desc.data_sizes = loop_end->get_element_type_sizes();
+        desc.io_idxs.resize(io_num, -1);
+        desc.is_incremented.resize(io_num, false);
+        for (size_t i = 0; i < io_num; ++i) {
+            const auto& connector = expr->get_input_port_connector(i);
+            if (i < input_num) {
+                desc.io_idxs[i] = get_io_idx(connector->get_source().get_expr());
+            } else {
+                for (const auto& consumer : connector->get_consumers()) {
+                    const auto io_idx = get_io_idx(consumer.get_expr());
+                    if (io_idx >= 0)
+                        desc.io_idxs[i] = io_idx;
+                }
+            }
+            // Zero increments stand for broadcasted dimensions or repeated data pointers, they stay zero for any shape
+            // with the same broadcasting pattern
+            desc.is_incremented[i] = is_incremented[i] && ptr_increments[i] != 0;
+            OPENVINO_ASSERT(!desc.is_incremented[i] || desc.io_idxs[i] >= 0, "Shape-agnostic Loop can shift only I/O data pointers");
+        }
+        loop_end->set_runtime_args_idx(m_runtime_config->add_loop(std::move(desc)));
+    }
+    return true;
+}
+
+} // namespace pass
+} // namespace lowered
+} // namespace snippets
+} // namespace ov
@@ -319,6 +319,7 @@ void InsertTailLoop::tail_transformations(LinearIR& linear_ir,
 bool InsertTailLoop::run(LinearIR& linear_ir) {
     OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::insertTailLoop")
     const auto& loop_manager = linear_ir.get_loop_manager();
+    const auto is_shape_agnostic = linear_ir.get_config().m_is_shape_agnostic;
     bool modified = false;
 
     for (auto expr_it = linear_ir.cbegin(); expr_it != linear_ir.cend(); ++expr_it) {
@@ -336,7 +337,15 @@ bool InsertTailLoop::run(LinearIR& linear_ir) {
 
         const auto work_amount = loop_end->get_work_amount();
         const auto increment = loop_end->get_increment();
-        const auto tail_size = work_amount % increment;
+        auto tail_size = work_amount % increment;
+        auto need_vector_loop = work_amount >= increment;
+        // Shape-agnostic code can't rely on the work amount: every vector Loop is followed by the scalar tail Loop
+        // and the actual work amounts are set at runtime. The only exception is a Loop by broadcasted dimension
+        // (work amount is 1 for every shape with the same broadcasting pattern), it's processed by the scalar Loop only
+        if (is_shape_agnostic) {
+            tail_size = increment > 1 ? 1 : 0;
+            need_vector_loop = work_amount > 1;
+        }
 
         // tail is required => transform the body into a tail representation
         // tail loop is fake loop because for tail we should calculate only
@@ -344,7 +353,6 @@ bool InsertTailLoop::run(LinearIR& linear_ir) {
         if (tail_size != 0) {
             const auto loop_begin = loop_end->get_loop_begin();
             const auto begin_it = linear_ir.find(linear_ir.get_expr_by_node(loop_begin));
-            const auto need_vector_loop = work_amount >= increment;
             create_tail_loop(linear_ir, begin_it, std::next(expr_it), loop_end, need_vector_loop, tail_size);
         }
         modified = true;
@@ -0,0 +1,97 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/lowered/pass/reduce_decomposition.hpp"
+
+#include "snippets/lowered/linear_ir.hpp"
+#include "snippets/lowered/loop_manager.hpp"
+#include "snippets/snippets_isa.hpp"
+#include "snippets/itt.hpp"
+
+
+namespace ov {
+namespace snippets {
+namespace lowered {
+namespace pass {
+
+ReduceDecomposition::ReduceDecomposition(size_t vector_size) : m_vector_size{vector_size} {}
+
+bool ReduceDecomposition::run(LinearIR& linear_ir) {
+    OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::ReduceDecompositionLowered")
+    bool modified = false;
+    const auto& loop_manager = linear_ir.get_loop_manager();
+
+    for (auto expr_it = linear_ir.begin(); expr_it != linear_ir.end(); expr_it++) {
+        const auto reduce_expr = *expr_it;
+        const auto reduce = ov::as_type_ptr<op::ReduceBase>(reduce_expr->get_node());
+        if (!reduce)
+            continue;
+
+        const auto& reduce_loop_ids = reduce_expr->get_loop_ids();
+        const auto& input_connector = reduce_expr->get_input_port_connector(0);
+        const auto& output_connector = reduce_expr->get_output_port_connector(0);
+        const auto inner_work_amount = *(reduce_expr->get_input_port_descriptor(0)->get_shape().rbegin());
+        const bool is_max = ov::is_type<op::ReduceMax>(reduce);
+
+        // Float constant values in byte representation: the initial value of accumulator is -FLOAT_MAX for max and zero for sum
+        const auto fill_value = is_max ? uint32_t(0xff7fffff) : uint32_t(0x00000000);
+        const bool is_dynamic = reduce->is_dynamic();
+        // We need an iterator to the inserted element
+        auto push_node = [&linear_ir, &expr_it, is_dynamic](const std::shared_ptr<Node>& n) {
+            const auto expr = linear_ir.insert(expr_it, n);
+            if (is_dynamic)
+                expr->get()->updateShapes();
+            return std::make_pair(expr, n);
+        };
+
+        // Note: VectorBuffer is a special case, since it should go before the initial Load
+        const auto vector_buffer = push_node(std::make_shared<op::VectorBuffer>());
+        const auto fill = push_node(std::make_shared<op::Fill>(vector_buffer.second, 0, fill_value));
+        std::shared_ptr<ov::Node> accumulation_op = nullptr;
+        std::shared_ptr<ov::Node> horizon_op = nullptr;
+        if (is_max) {
+            accumulation_op = std::make_shared<ov::op::v1::Maximum>(reduce->get_input_source_output(0), fill.second);
+        } else {
+            accumulation_op = std::make_shared<ov::op::v1::Add>(reduce->get_input_source_output(0), fill.second);
+        }
+        const auto accumulation = push_node(accumulation_op);
+        if (is_max) {
+            horizon_op = std::make_shared<op::HorizonMax>(accumulation.second);
+        } else {
+            horizon_op = std::make_shared<op::HorizonSum>(accumulation.second);
+        }
+        const auto horizon = push_node(horizon_op);
+
+        // Markup of the accumulation Loop
+        loop_manager->mark_loop(accumulation.first, horizon.first, inner_work_amount, m_vector_size, 0,
+                                std::vector<ExpressionPort>{(*accumulation.first)->get_input_port(0),
+                                                            (*accumulation.first)->get_input_port(1)},
+                                std::vector<ExpressionPort>{(*accumulation.first)->get_output_port(0)});
+
+        // Transfer original ExpressionPorts
+        replace_input_port_connectors({ accumulation.first->get()->get_input_port(0) }, input_connector);
+        replace_input_port_connectors(output_connector->get_consumers(), (*horizon.first)->get_output_port_connector(0));
+
+        // Update Loop info for outer loops
+        const auto entry_points = std::vector<ExpressionPort>{(*accumulation.first)->get_input_port(0)};
+        const auto exit_points = std::vector<ExpressionPort>{(*horizon.first)->get_output_port(0)};
+        for (auto loop_id : reduce_loop_ids) {
+            loop_manager->expression_replacement(vector_buffer.first, expr_it, reduce_expr, loop_id, entry_points, exit_points);
+        }
+
+        expr_it = linear_ir.erase(expr_it);   // Remove Reduce
+
+        // For tail loop we should fill input of accumulation op by the initial value
+        // to avoid math incorrect calculations
+        accumulation.second->input(0).get_rt_info()["set_fill"] = fill_value;
+        modified = true;
+    }
+
+    return modified;
+}
+
+} // namespace pass
+} // namespace lowered
+} // namespace snippets
+} // namespace ov
@@ -71,6 +71,7 @@ std::shared_ptr<Node> LoopEnd::clone_with_new_inputs(const OutputVector& inputs)
     const auto loop_end = std::make_shared<LoopEnd>(inputs.at(0), m_work_amount, m_work_amount_increment, m_is_incremented, m_ptr_increments,
                                                     m_finalization_offsets, m_element_type_sizes, m_input_num, m_output_num, m_id);
     loop_end->m_evaluate_once = m_evaluate_once;
+    loop_end->m_runtime_args_idx = m_runtime_args_idx;
     return loop_end;
 }
 
@@ -121,6 +122,14 @@ size_t LoopEnd::get_id() const {
     return m_id;
 }
 
+size_t LoopEnd::get_runtime_args_idx() const {
+    return m_runtime_args_idx;
+}
+
+bool LoopEnd::is_dynamic() const {
+    return m_runtime_args_idx != RuntimeConfig::UNDEFINED_IDX;
+}
+
 void LoopEnd::set_finalization_offsets(std::vector<int64_t> offsets) {
     OPENVINO_ASSERT(offsets.size() == m_input_num + m_output_num,
                     "LoopEnd set_finalization_offsets is called with inconsistent offsets.size()");
@@ -156,6 +165,10 @@ void LoopEnd::set_id(size_t new_id) {
     m_id = new_id;
 }
 
+void LoopEnd::set_runtime_args_idx(size_t idx) {
+    m_runtime_args_idx = idx;
+}
+
 void LoopEnd::validate_and_infer_types() {
     NODE_VALIDATION_CHECK(this, get_input_size() == 1, "LoopEnd must have one input");
     const auto loop_begin = ov::as_type_ptr<LoopBegin>(get_input_node_shared_ptr(0));
@@ -15,6 +15,7 @@
 #include "snippets/pass/matmul_to_brgemm.hpp"
 #include "snippets/pass/fuse_transpose_brgemm.hpp"
 #include "snippets/pass/set_softmax_ports.hpp"
+#include "snippets/pass/set_reduce_ports.hpp"
 #include "snippets/pass/canonicalization.hpp"
 #include "snippets/pass/align_element_types.hpp"
 
@@ -34,6 +35,7 @@
 #include "snippets/lowered/pass/allocate_buffers.hpp"
 #include "snippets/lowered/pass/propagate_layout.hpp"
 #include "snippets/lowered/pass/softmax_decomposition.hpp"
+#include "snippets/lowered/pass/reduce_decomposition.hpp"
 #include "snippets/lowered/pass/move_scalar_to_consumer.hpp"
 #include "snippets/lowered/pass/move_result_out_of_loop.hpp"
 #include "snippets/lowered/pass/clean_repeated_ptr_shifts.hpp"
@@ -70,11 +72,16 @@ void Subgraph::set_virtual_port_count(const size_t count) {
     m_virtual_port_count = count;
 }
 
-auto Subgraph::is_domain_sensitive_op(const std::shared_ptr<ov::Node>& op) -> bool {
+auto Subgraph::is_domain_sensitive_op(const std::shared_ptr<const ov::Node>& op) -> bool {
     return ov::is_type<ov::op::v1::Transpose>(op) ||
            ov::is_type<ov::op::v1::Softmax>(op) ||
            ov::is_type<ov::op::v8::Softmax>(op) ||
            ov::is_type<ov::op::v0::MatMul>(op) ||
+           ov::is_type<ov::op::v1::ReduceSum>(op) ||   // Reductions and MVN (decomposed into reductions) change the shape
+           ov::is_type<ov::op::v1::ReduceMax>(op) ||   // by the reduced dimension
+           ov::is_type<ov::op::v1::ReduceMean>(op) ||
+           ov::is_type<ov::op::v6::MVN>(op) ||
+           ov::is_type<op::ReduceBase>(op) ||
            ov::is_type<ov::op::v1::Broadcast>(op) || // Broadcast is domain sensetive op because the output shape depends on
            ov::is_type<ov::op::v3::Broadcast>(op);   // the both input and broadcast shapes (the both - are inputs of op). Note: is used only in MHA pattern
 }
@@ -96,7 +103,7 @@ auto Subgraph::get_estimated_buffer_count(const ov::NodeVector& ops) -> size_t {
     // 2. Around MatMul: all buffers around Matmul must not be inplace because MatMul blocking implementation changes registers during computations.
     // The count is estimated because when we calculate this number, we have only original graph representation
     // and where will be Loops - we can just predict.
-    // Note: The ops that create Buffers: MatMul, Transpose and Softmax (always FP32)
+    // Note: The ops that create Buffers: MatMul, Transpose, Softmax and reductions (always FP32)
     std::vector<size_t> used_precision_size;
 
     auto push_prc_size = [&used_precision_size](size_t precision_size) {
@@ -124,6 +131,10 @@ auto Subgraph::get_estimated_buffer_count(const ov::NodeVector& ops) -> size_t {
             // Softmax always uses 2 FP32 Buffers after decomposition.
             // They are inplace and the same, so we can push precision size only once
             push_prc_size(ov::element::f32.size());
+        } else if (ov::is_type<ov::op::v1::ReduceSum>(op) || ov::is_type<ov::op::v1::ReduceMax>(op) ||
+                   ov::is_type<ov::op::v1::ReduceMean>(op) || ov::is_type<ov::op::v6::MVN>(op) || ov::is_type<op::ReduceBase>(op)) {
+            // Reductions are supported only in FP32, the Buffers around them are FP32 as well
+            push_prc_size(ov::element::f32.size());
         } else if (const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(op)) {
             // Since all buffers around Matmul must be unique, we explicitely add values to the vector without any checks
             if (!ov::is_type<ov::op::v0::Parameter>(matmul->get_input_node_shared_ptr(0)))
@@ -345,7 +356,9 @@ Subgraph::convert_body_to_linear_ir(size_t min_parallel_work_amount, size_t min_
     lowered::Config lowering_config;
     lowering_config.m_need_fill_tail_register = config.m_has_domain_sensitive_ops;
     lowering_config.m_loop_depth = tileRank;
-    lowering_config.m_enable_domain_optimization = !config.m_has_domain_sensitive_ops;
+    // Domain optimization collapses dimensions depending on their values, so shape-agnostic code can't use it
+    lowering_config.m_enable_domain_optimization = !config.m_has_domain_sensitive_ops && !m_is_shape_agnostic;
+    lowering_config.m_is_shape_agnostic = m_is_shape_agnostic;
     lowering_config.m_min_parallel_work_amount = min_parallel_work_amount;
     lowering_config.m_min_kernel_work_amount = min_kernel_work_amount;
 
@@ -354,6 +367,18 @@ Subgraph::convert_body_to_linear_ir(size_t min_parallel_work_amount, size_t min_
     return m_linear_ir;
 }
 
+bool Subgraph::is_shape_agnostic_supported() const {
+    if (config.m_has_domain_sensitive_ops || config.m_is_quantized)
+        return false;
+    const auto& ops = body_ptr()->get_ops();
+    return std::all_of(ops.cbegin(), ops.cend(), is_shape_agnostic_supported_op);
+}
+
+bool Subgraph::is_shape_agnostic_supported_op(const std::shared_ptr<const ov::Node>& op) {
+    return !is_domain_sensitive_op(op) && !ov::is_type<ov::op::v0::FakeQuantize>(op) &&
+           !ov::is_type<op::Buffer>(op) && !ov::is_type<op::Brgemm>(op);
+}
+
 std::shared_ptr<Subgraph> Subgraph::clone() const {
     ov::OutputVector subgraph_node_inputs;
     for (const auto &input : input_values()) {
@@ -371,6 +396,7 @@ std::shared_ptr<Subgraph> Subgraph::clone() const {
     // Note: we don't update shapeInfer here, since it's initialized in the constructor
     if (m_generator)
         result->m_generator = m_generator->clone();
+    result->m_is_shape_agnostic = m_is_shape_agnostic;
     return result;
 }
 
@@ -392,6 +418,7 @@ void Subgraph::data_flow_transformations(const BlockedShapeVector& blocked_input
         manager.register_pass<snippets::pass::FuseTransposeBrgemm>();
         manager.register_pass<snippets::pass::TransposeDecomposition>();
         manager.register_pass<snippets::pass::SetSoftmaxPorts>();
+        manager.register_pass<snippets::pass::SetReducePorts>();
     }
     manager.register_pass<snippets::pass::BroadcastToMoveBroadcast>();
     manager.register_pass<snippets::pass::ConvertConstantsToScalars>();
@@ -423,6 +450,7 @@ void Subgraph::control_flow_transformations(lowered::LinearIR& linear_ir,
     lowered::pass::PassPipeline pipeline(lowered_pass_config);
     pipeline.register_pass<lowered::pass::MarkLoops>(vector_size);
     pipeline.register_pass<lowered::pass::SoftmaxDecomposition>(vector_size);
+    pipeline.register_pass<lowered::pass::ReduceDecomposition>(vector_size);
     pipeline.register_pass<lowered::pass::FuseLoops>();
     pipeline.register_pass<lowered::pass::SplitLoops>();
     pipeline.register_pass<lowered::pass::MoveResultOutOfLoop>();
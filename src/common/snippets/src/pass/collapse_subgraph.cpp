@@ -10,6 +10,7 @@
 #include "snippets/pass/transpose_decomposition.hpp"
 #include "snippets/pass/fuse_transpose_brgemm.hpp"
 #include "snippets/pass/fq_decomposition.hpp"
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
 #include "snippets/op/subgraph.hpp"
 #include "snippets/utils.hpp"
 
@@ -155,6 +156,25 @@ auto is_supported_op(const std::shared_ptr<const Node> &n) -> bool {
         return axis >= 0 && axis == (rank.get_length() - 1);
     };
 
+    auto is_supported_reduce = [](const std::shared_ptr<const Node> &n) -> bool {
+        return ReduceToSnippetsReduce::is_supported_reduce(n);
+    };
+
+    auto is_supported_mvn = [](const std::shared_ptr<const Node> &n) -> bool {
+        // MVN by the innermost dimension (LayerNorm) is decomposed into ReduceMean and element-wise ops inside Subgraph,
+        // so it has the same limitations as ReduceMean
+        const auto mvn = ov::as_type_ptr<const ov::op::v6::MVN>(n);
+        if (!mvn || n->get_input_element_type(0) != ov::element::f32)
+            return false;
+        const auto& pshape = n->get_input_partial_shape(0);
+        const auto axes = ov::as_type_ptr<const opset1::Constant>(n->get_input_node_shared_ptr(1));
+        if (pshape.rank().is_dynamic() || pshape.size() == 0 || pshape.rbegin()->is_dynamic() ||
+            !axes || ov::shape_size(axes->get_shape()) != 1)
+            return false;
+        const auto axis = ov::util::normalize_axis(n->get_friendly_name(), axes->cast_vector<int64_t>()[0], pshape.rank());
+        return axis == pshape.rank().get_length() - 1;
+    };
+
     auto is_supported_broadcast_op = [](const std::shared_ptr<const Node> &n) -> bool {
         // Broadcast is supported only for MHA tokenization where there are needed and special checks
         if (auto broadcast_v1 = ov::as_type_ptr<const ov::op::v1::Broadcast>(n)) {
@@ -171,6 +191,8 @@ auto is_supported_op(const std::shared_ptr<const Node> &n) -> bool {
            is_supported_ternary_eltwise_op(n) ||
            is_supported_transpose(n) ||
            is_supported_softmax(n) ||
+           is_supported_reduce(n) ||
+           is_supported_mvn(n) ||
            is_supported_matmul(n) ||
            is_supported_broadcast_op(n);
 }
@@ -197,7 +219,15 @@ auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
             }
         }
     }
-    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
+    // Reduction axes are used only to decompose the op on Subgraph body, so they may have any integer type
+    auto is_reduction_axes = [&n](const Input<const Node>& in) {
+        return in.get_index() == 1 &&
+               (ov::is_type<const ov::op::util::ArithmeticReductionKeepDims>(n) || ov::is_type<const ov::op::v6::MVN>(n)) &&
+               ov::is_type<ov::op::v0::Constant>(in.get_source_output().get_node());
+    };
+    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {
+               return is_reduction_axes(in) || supported(in.get_tensor());
+           }) &&
            std::all_of(outputs.begin(), outputs.end(), [&](const Output<const Node>& out) {return  supported(out.get_tensor());});
 }
 
@@ -594,7 +624,9 @@ TokenizeSnippets::TokenizeSnippets() {
         // This limitation will be resolved once generator supports gprs spills [75622].
         // TODO [75567]: move this plugin-specific constraint to the plugin callback
         const auto unique_buffer_count = op::Subgraph::get_estimated_buffer_count(ops_for_buffer_count);
-        if (body_parameters.size() + body_results.size() + hidden_data_count + unique_buffer_count > 12) {
+        // Dynamic subgraphs are lowered to the shape-agnostic code which has fewer GPRs for the data pointers
+        const size_t max_data_count = node->is_dynamic() ? op::Subgraph::shape_agnostic_max_data_count : 12;
+        if (body_parameters.size() + body_results.size() + hidden_data_count + unique_buffer_count > max_data_count) {
             const std::string message_reset = "new subgraph is created. Impossible to schedule subgraph with " +
             std::to_string(body_parameters.size()) + " inputs, " + std::to_string(body_results.size()) + " outputs and " +
             std::to_string(hidden_data_count) + " non-scalar constants and " + std::to_string(unique_buffer_count) + "buffers.";
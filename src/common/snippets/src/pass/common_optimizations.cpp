@@ -6,6 +6,7 @@
 
 #include "snippets/pass/fq_decomposition.hpp"
 #include "snippets/pass/softmax_reshape_elimination.hpp"
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
 #include "snippets/pass/explicit_transpose_matmul_inputs.hpp"
 #include "snippets/pass/transpose_decomposition.hpp"
 #include "snippets/pass/fuse_transpose_brgemm.hpp"
@@ -19,6 +20,7 @@
 #include "snippets/itt.hpp"
 
 #include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/op_conversions/mvn6_decomposition.hpp"
 #include "transformations/utils/utils.hpp"
 
 namespace ov {
@@ -50,6 +52,10 @@ CommonOptimizations::CommonOptimizations(const SnippetsTokenization::Config& con
         REGISTER_SNIPPETS_PASS(manager, ov::snippets::pass::ExplicitTransposeMatMulInputs, is_domain_sensitive);
         REGISTER_SNIPPETS_PASS(manager, ov::snippets::pass::CommonFakeQuantizeDecomposition, is_quantized);
         REGISTER_SNIPPETS_PASS(manager, ov::snippets::pass::SoftmaxReshapeElimination, is_domain_sensitive);
+        // MVN is decomposed into reductions by the innermost dimension and element-wise ops.
+        // The reductions are converted before Canonicalization, since their axes depend on the original ranks
+        REGISTER_SNIPPETS_PASS(manager, ov::pass::MVN6Decomposition, is_domain_sensitive);
+        REGISTER_SNIPPETS_PASS(manager, ov::snippets::pass::ReduceToSnippetsReduce, is_domain_sensitive);
         manager.run_passes(body);
 
         ov::snippets::pass::CommonOptimizations::SubgraphManager subgraph_manager;
@@ -0,0 +1,70 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
+
+#include "snippets/itt.hpp"
+#include "snippets/op/reduce.hpp"
+#include "snippets/utils.hpp"
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reduce_max.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "validation_util.hpp"
+
+bool ov::snippets::pass::ReduceToSnippetsReduce::is_supported_reduce(const std::shared_ptr<const ov::Node>& node) {
+    const auto reduce = ov::as_type_ptr<const ov::op::util::ArithmeticReductionKeepDims>(node);
+    if (!reduce || !reduce->get_keep_dims() ||
+        !(ov::is_type<ov::op::v1::ReduceSum>(node) || ov::is_type<ov::op::v1::ReduceMax>(node) || ov::is_type<ov::op::v1::ReduceMean>(node)))
+        return false;
+    // Note: the reductions are decomposed into f32 accumulation Loops
+    const auto& pshape = node->get_input_partial_shape(0);
+    if (node->get_input_element_type(0) != ov::element::f32 || pshape.rank().is_dynamic() || pshape.size() == 0)
+        return false;
+    const auto axes = ov::as_type_ptr<const ov::op::v0::Constant>(node->get_input_node_shared_ptr(1));
+    if (!axes || ov::shape_size(axes->get_shape()) != 1)
+        return false;
+    const auto rank = pshape.rank();
+    const auto axis = ov::util::normalize_axis(node->get_friendly_name(), axes->cast_vector<int64_t>()[0], rank);
+    // ReduceMean is converted to ReduceSum and Multiply by the constant, so the reduced dimension must be known
+    return axis == rank.get_length() - 1 && utils::implication(ov::is_type<ov::op::v1::ReduceMean>(node), pshape.rbegin()->is_static());
+}
+
+ov::snippets::pass::ReduceToSnippetsReduce::ReduceToSnippetsReduce() {
+    MATCHER_SCOPE(ReduceToSnippetsReduce);
+    auto m_reduce = ov::pass::pattern::wrap_type<ov::op::v1::ReduceSum, ov::op::v1::ReduceMax, ov::op::v1::ReduceMean>();
+
+    auto callback = [this](ov::pass::pattern::Matcher& m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::op::ReduceToSnippetsReduce")
+        const auto reduce = m.get_match_root();
+        if (!is_supported_reduce(reduce) || transformation_callback(reduce))
+            return false;
+
+        const auto& data = reduce->input_value(0);
+        std::shared_ptr<ov::Node> snippets_reduce = nullptr;
+        if (ov::is_type<ov::op::v1::ReduceMax>(reduce)) {
+            snippets_reduce = std::make_shared<ov::snippets::op::ReduceMax>(data);
+        } else {
+            snippets_reduce = std::make_shared<ov::snippets::op::ReduceSum>(data);
+        }
+        ov::NodeVector new_nodes{snippets_reduce};
+        auto result = snippets_reduce;
+        if (ov::is_type<ov::op::v1::ReduceMean>(reduce)) {
+            const auto reduced_dim = static_cast<float>(data.get_partial_shape().rbegin()->get_length());
+            const auto scale = ov::op::v0::Constant::create(data.get_element_type(), ov::Shape{1}, {1.f / reduced_dim});
+            result = std::make_shared<ov::op::v1::Multiply>(snippets_reduce, scale);
+            new_nodes.insert(new_nodes.end(), {scale, result});
+        }
+        result->set_friendly_name(reduce->get_friendly_name());
+        ov::copy_runtime_info(reduce, new_nodes);
+        ov::replace_node(reduce, result);
+        return true;
+    };
+
+    register_matcher(std::make_shared<ov::pass::pattern::Matcher>(m_reduce, matcher_name), callback);
+}
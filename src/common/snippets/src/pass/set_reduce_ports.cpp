@@ -0,0 +1,36 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/pass/set_reduce_ports.hpp"
+
+#include "snippets/itt.hpp"
+#include "snippets/lowered/port_descriptor.hpp"
+#include "snippets/op/reduce.hpp"
+
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+ov::snippets::pass::SetReducePorts::SetReducePorts() {
+    MATCHER_SCOPE(SetReducePorts);
+
+    auto m_reduce = ov::pass::pattern::wrap_type<ov::snippets::op::ReduceBase>();
+
+    auto callback = [](ov::pass::pattern::Matcher &m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::op::SetReducePorts")
+        auto root = m.get_match_root();
+
+        const auto& pshape = root->get_input_partial_shape(0);
+        OPENVINO_ASSERT(!pshape.rank().is_dynamic(), "SetReducePorts doesn't support dynamic ranks");
+        const auto rank = pshape.rank().get_length();
+
+        std::vector<size_t> subtensor(rank, 1);
+        subtensor[rank - 1] = lowered::PortDescriptor::ServiceDimensions::FULL_DIM;
+
+        lowered::PortDescriptorUtils::set_port_descriptor_ptr(root->input(0), std::make_shared<lowered::PortDescriptor>(root->input(0), subtensor));
+        lowered::PortDescriptorUtils::set_port_descriptor_ptr(root->output(0), std::make_shared<lowered::PortDescriptor>(root->output(0), subtensor));
+
+        return true;
+    };
+
+    register_matcher(std::make_shared<ov::pass::pattern::Matcher>(m_reduce, matcher_name), callback);
+}
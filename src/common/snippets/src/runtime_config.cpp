@@ -0,0 +1,117 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/runtime_config.hpp"
+
+#include "openvino/core/except.hpp"
+
+#include <algorithm>
+
+namespace ov {
+namespace snippets {
+
+namespace {
+// Distance between the consecutive elements of the dimension, 0 if the dimension is broadcasted
+int64_t get_dim_stride(const VectorDims& shape, size_t dim) {
+    if (shape[dim] == 1)
+        return 0;
+    int64_t stride = 1;
+    for (size_t i = dim + 1; i < shape.size(); ++i)
+        stride *= static_cast<int64_t>(shape[i]);
+    return stride;
+}
+}  // namespace
+
+RuntimeConfig::RuntimeConfig(size_t num_inputs, std::vector<int64_t> io_data_sizes, size_t loop_depth)
+    : m_io_data_sizes(std::move(io_data_sizes)), m_num_inputs(num_inputs), m_loop_depth(loop_depth) {
+    OPENVINO_ASSERT(m_num_inputs <= m_io_data_sizes.size(), "RuntimeConfig: the number of inputs exceeds the number of I/O");
+}
+
+size_t RuntimeConfig::add_loop(LoopDesc desc) {
+    const auto port_count = desc.io_idxs.size();
+    OPENVINO_ASSERT(desc.is_incremented.size() == port_count && desc.data_sizes.size() == port_count,
+                    "RuntimeConfig: inconsistent Loop port description");
+    OPENVINO_ASSERT(desc.increment != 0 && desc.main_body_increment != 0, "RuntimeConfig: Loop increment can't be zero");
+    const auto loop_idx = m_loop_args_size;
+    m_loop_offsets.push_back(loop_idx);
+    m_loops.push_back(std::move(desc));
+    m_loop_args_size += 1 + 2 * port_count;
+    return loop_idx;
+}
+
+void RuntimeConfig::update(const std::vector<VectorDims>& io_shapes, size_t tensor_rank) {
+    const auto io_num = get_io_num();
+    OPENVINO_ASSERT(io_shapes.size() == io_num, "RuntimeConfig: expected ", io_num, " I/O shapes, got ", io_shapes.size());
+    size_t rank = 0;
+    for (const auto& shape : io_shapes)
+        rank = std::max(rank, shape.size());
+    OPENVINO_ASSERT(rank != 0 && rank <= tensor_rank, "RuntimeConfig: the I/O rank ", rank, " isn't supported for the tensor rank ", tensor_rank);
+
+    // I/O shapes are aligned to the same rank the same way as RankNormalization does it
+    std::vector<VectorDims> shapes(io_num);
+    m_master_shape.assign(rank, 1);
+    for (size_t i = 0; i < io_num; ++i) {
+        shapes[i] = io_shapes[i];
+        shapes[i].insert(shapes[i].begin(), rank - io_shapes[i].size(), 1);
+        for (size_t d = 0; d < rank; ++d) {
+            const auto dim = shapes[i][d];
+            OPENVINO_ASSERT(dim == m_master_shape[d] || dim == 1 || m_master_shape[d] == 1, "RuntimeConfig: I/O shapes are not broadcastable");
+            m_master_shape[d] = std::max(m_master_shape[d], dim);
+        }
+    }
+
+    const auto offset_rank = tensor_rank - 1;
+    m_runtime_args.assign(m_loop_args_size + io_num * offset_rank, 0);
+
+    for (size_t l = 0; l < m_loops.size(); ++l) {
+        const auto& loop = m_loops[l];
+        OPENVINO_ASSERT(loop.dim_idx < rank, "RuntimeConfig: Loop dimension index exceeds the rank");
+        const auto dim = rank - 1 - loop.dim_idx;
+        const auto work_amount = static_cast<int64_t>(m_master_shape[dim]);
+        const auto increment = static_cast<int64_t>(loop.increment);
+        int64_t loop_work_amount = work_amount;
+        switch (loop.type) {
+            case LoopType::MainBody:
+                loop_work_amount = work_amount - work_amount % increment;
+                break;
+            case LoopType::Tail:
+                loop_work_amount = work_amount % static_cast<int64_t>(loop.main_body_increment);
+                break;
+            default:
+                break;
+        }
+
+        auto* args = m_runtime_args.data() + m_loop_offsets[l];
+        const auto port_count = loop.io_idxs.size();
+        args[0] = loop_work_amount;
+        for (size_t p = 0; p < port_count; ++p) {
+            const auto io_idx = loop.io_idxs[p];
+            if (io_idx < 0 || !loop.is_incremented[p])
+                continue;
+            const auto stride = get_dim_stride(shapes[static_cast<size_t>(io_idx)], dim) * loop.data_sizes[p];
+            args[1 + p] = stride * increment;
+            // The main body doesn't rewind the pointers: the tail continues from where the main body stopped
+            // and rewinds the whole dimension
+            args[1 + port_count + p] = loop.type == LoopType::MainBody ? 0 : -stride * work_amount;
+        }
+    }
+
+    // Note that there is no offset for the last dim, since it's always processed by kernel
+    auto* data_offsets = m_runtime_args.data() + m_loop_args_size;
+    for (size_t i = 0; i < io_num; ++i) {
+        auto* io_offsets = data_offsets + i * offset_rank + (offset_rank - (rank - 1));
+        for (size_t d = 0; d + 1 < rank; ++d)
+            io_offsets[d] = get_dim_stride(shapes[i], d) * m_io_data_sizes[i];
+    }
+}
+
+VectorDims RuntimeConfig::get_parallel_exec_domain() const {
+    auto domain = m_master_shape;
+    for (size_t i = 0; i < std::min(m_loop_depth, domain.size()); ++i)
+        domain[domain.size() - 1 - i] = 1;
+    return domain;
+}
+
+} // namespace snippets
+} // namespace ov
@@ -50,6 +50,8 @@ const IShapeInferSnippetsFactory::TRegistry IShapeInferSnippetsFactory::registry
         SHAPE_INFER_PREDEFINED(ov::op::v0::PRelu, PassThroughShapeInfer),
         SHAPE_INFER_PREDEFINED(op::HorizonMax, HorizonOpShapeInfer),
         SHAPE_INFER_PREDEFINED(op::HorizonSum, HorizonOpShapeInfer),
+        SHAPE_INFER_PREDEFINED(op::ReduceSum, HorizonOpShapeInfer),
+        SHAPE_INFER_PREDEFINED(op::ReduceMax, HorizonOpShapeInfer),
         //
         SHAPE_INFER_PREDEFINED(op::LoopBegin, SingleElementShapeInfer),
         SHAPE_INFER_PREDEFINED(op::Scalar, SingleElementShapeInfer),
@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/runtime_config.hpp"
+
+#include <gtest/gtest.h>
+
+using Snippets_RuntimeConfig = ::testing::Test;
+using namespace ov::snippets;
+
+namespace {
+RuntimeConfig::LoopDesc make_loop_desc(size_t dim_idx, size_t increment, RuntimeConfig::LoopType type, std::vector<bool> is_incremented) {
+    RuntimeConfig::LoopDesc desc;
+    desc.dim_idx = dim_idx;
+    desc.increment = increment;
+    desc.main_body_increment = type == RuntimeConfig::LoopType::Tail ? 8 : increment;
+    desc.type = type;
+    desc.io_idxs = {0, 1, 2};
+    desc.is_incremented = std::move(is_incremented);
+    desc.data_sizes = {4, 4, 4};
+    return desc;
+}
+}  // namespace
+
+TEST(Snippets_RuntimeConfig, BroadcastedInputWithTail) {
+    // Add(in0 [1, 3, 17], in1 [1, 1, 17]) -> out [1, 3, 17], f32
+    RuntimeConfig config(2, {4, 4, 4}, 2);
+    const auto main_idx = config.add_loop(make_loop_desc(0, 8, RuntimeConfig::LoopType::MainBody, {true, true, true}));
+    const auto tail_idx = config.add_loop(make_loop_desc(0, 1, RuntimeConfig::LoopType::Tail, {true, true, true}));
+    const auto outer_idx = config.add_loop(make_loop_desc(1, 1, RuntimeConfig::LoopType::Full, {true, false, true}));
+    ASSERT_EQ(config.get_data_offsets_idx(), 21);
+
+    config.update({{1, 3, 17}, {1, 1, 17}, {1, 3, 17}}, 6);
+    const auto& args = config.get_runtime_args();
+    ASSERT_EQ(args.size(), 21 + 3 * 5);
+
+    const std::vector<int64_t> ref_main = {16, 32, 32, 32, 0, 0, 0};
+    const std::vector<int64_t> ref_tail = {1, 4, 4, 4, -68, -68, -68};
+    const std::vector<int64_t> ref_outer = {3, 68, 0, 68, -204, 0, -204};
+    EXPECT_EQ(std::vector<int64_t>(args.begin() + main_idx, args.begin() + main_idx + 7), ref_main);
+    EXPECT_EQ(std::vector<int64_t>(args.begin() + tail_idx, args.begin() + tail_idx + 7), ref_tail);
+    EXPECT_EQ(std::vector<int64_t>(args.begin() + outer_idx, args.begin() + outer_idx + 7), ref_outer);
+
+    const std::vector<int64_t> ref_offsets = {0, 0, 0, 0, 68,
+                                              0, 0, 0, 0, 0,
+                                              0, 0, 0, 0, 68};
+    EXPECT_EQ(std::vector<int64_t>(args.begin() + config.get_data_offsets_idx(), args.end()), ref_offsets);
+    EXPECT_EQ(config.get_parallel_exec_domain(), VectorDims({1, 1, 1}));
+}
+
+TEST(Snippets_RuntimeConfig, WorkAmountLessThanIncrement) {
+    RuntimeConfig config(2, {4, 4, 4}, 2);
+    const auto main_idx = config.add_loop(make_loop_desc(0, 8, RuntimeConfig::LoopType::MainBody, {true, true, true}));
+    const auto tail_idx = config.add_loop(make_loop_desc(0, 1, RuntimeConfig::LoopType::Tail, {true, true, true}));
+
+    config.update({{2, 5}, {2, 5}, {2, 5}}, 6);
+    const auto& args = config.get_runtime_args();
+    EXPECT_EQ(args[main_idx], 0);
+    EXPECT_EQ(args[tail_idx], 5);
+    EXPECT_EQ(config.get_parallel_exec_domain(), VectorDims({1, 1}));
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <snippets/snippets_isa.hpp>
+#include <snippets/pass/reduce_to_snippets_reduce.hpp>
+
+#include "common_test_utils/ov_test_utils.hpp"
+
+using namespace testing;
+using namespace ov;
+
+TEST_F(TransformationTestsF, ReduceSumToSnippetsReduceSum) {
+    {
+        auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, Shape{2, 3, 240});
+        auto axes = ov::op::v0::Constant::create(element::i64, Shape{1}, {-1});
+        auto reduce = std::make_shared<ov::op::v1::ReduceSum>(data, axes, true);
+        model = std::make_shared<Model>(NodeVector{reduce}, ParameterVector{data});
+
+        manager.register_pass<snippets::pass::ReduceToSnippetsReduce>();
+    }
+    {
+        auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, Shape{2, 3, 240});
+        auto reduce = std::make_shared<snippets::op::ReduceSum>(data);
+        model_ref = std::make_shared<Model>(NodeVector{reduce}, ParameterVector{data});
+    }
+}
+
+TEST_F(TransformationTestsF, ReduceMeanToSnippetsReduceSum) {
+    {
+        auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, Shape{2, 3, 240});
+        auto axes = ov::op::v0::Constant::create(element::i64, Shape{1}, {2});
+        auto reduce = std::make_shared<ov::op::v1::ReduceMean>(data, axes, true);
+        model = std::make_shared<Model>(NodeVector{reduce}, ParameterVector{data});
+
+        manager.register_pass<snippets::pass::ReduceToSnippetsReduce>();
+    }
+    {
+        auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, Shape{2, 3, 240});
+        auto reduce = std::make_shared<snippets::op::ReduceSum>(data);
+        auto scale = ov::op::v0::Constant::create(element::f32, Shape{1}, {1.f / 240});
+        auto mean = std::make_shared<ov::op::v1::Multiply>(reduce, scale);
+        model_ref = std::make_shared<Model>(NodeVector{mean}, ParameterVector{data});
+    }
+}
+
+TEST_F(TransformationTestsF, ReduceMaxByNotInnermostAxisIsNotConverted) {
+    {
+        auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, Shape{2, 3, 240});
+        auto axes = ov::op::v0::Constant::create(element::i64, Shape{1}, {1});
+        auto reduce = std::make_shared<ov::op::v1::ReduceMax>(data, axes, true);
+        model = std::make_shared<Model>(NodeVector{reduce}, ParameterVector{data});
+
+        manager.register_pass<snippets::pass::ReduceToSnippetsReduce>();
+    }
+}
@@ -224,6 +224,14 @@ inline bool file_exists(const std::string& path) {
     return file_exists(path.c_str());
 }
 
+/**
+ * @brief      Returns hash of the file identity: the absolute path, the size and the last modification time
+ *             (with sub-second precision where the file system provides it)
+ * @param[in]  path  The file name
+ * @return     hash of the file identity, only the path is hashed if the file doesn't exist
+ */
+uint64_t get_file_info_hash(const std::string& path);
+
 std::string get_file_ext(const std::string& path);
 std::string get_directory(const std::string& path);
 std::string path_join(const std::vector<std::string>& paths);
@@ -414,6 +414,44 @@ void ov::util::create_directory_recursive(const std::string& path) {
     }
 }
 
+uint64_t ov::util::get_file_info_hash(const std::string& path) {
+    auto abs_path = path;
+    if (!path.empty()) {
+        try {
+            abs_path = ov::util::get_absolute_file_path(path);
+        } catch (std::runtime_error&) {
+            // can't get absolute path, will use path for hash
+        }
+    }
+
+    std::vector<size_t> info{std::hash<std::string>()(abs_path)};
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    if (GetFileAttributesExA(abs_path.c_str(), GetFileExInfoStandard, &attributes)) {
+        // the last write time is in 100-nanosecond intervals
+        ULARGE_INTEGER time, size;
+        time.LowPart = attributes.ftLastWriteTime.dwLowDateTime;
+        time.HighPart = attributes.ftLastWriteTime.dwHighDateTime;
+        size.LowPart = attributes.nFileSizeLow;
+        size.HighPart = attributes.nFileSizeHigh;
+        info.push_back(static_cast<size_t>(time.QuadPart));
+        info.push_back(static_cast<size_t>(size.QuadPart));
+    }
+#else
+    struct stat result;
+    if (stat(abs_path.c_str(), &result) == 0) {
+        info.push_back(static_cast<size_t>(result.st_mtime));
+#    ifdef __APPLE__
+        info.push_back(static_cast<size_t>(result.st_mtimespec.tv_nsec));
+#    else
+        info.push_back(static_cast<size_t>(result.st_mtim.tv_nsec));
+#    endif
+        info.push_back(static_cast<size_t>(result.st_size));
+    }
+#endif
+    return ov::util::hash_combine(info);
+}
+
 bool ov::util::directory_exists(const std::string& path) {
     struct stat sb;
 
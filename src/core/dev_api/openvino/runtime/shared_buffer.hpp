@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <streambuf>
+
 #include "openvino/runtime/aligned_buffer.hpp"
 
 namespace ov {
@@ -28,4 +30,51 @@ private:
     T _shared_object;
 };
 
+/// \brief IdentifiedBuffer is a mixin for the buffers whose content is identified without reading the data, e.g.
+/// the weights mapped from a file are identified by the file info and the offset and size of the data in it.
+/// The model cache hash is calculated on the identity instead of the buffer content.
+class IdentifiedBuffer {
+public:
+    explicit IdentifiedBuffer(uint64_t identity) : m_identity(identity) {}
+
+    uint64_t get_identity() const {
+        return m_identity;
+    }
+
+private:
+    uint64_t m_identity;
+};
+
+/// \brief SharedBuffer with the identity of the data, see IdentifiedBuffer.
+template <typename T>
+class IdentifiedSharedBuffer : public SharedBuffer<T>, public IdentifiedBuffer {
+public:
+    IdentifiedSharedBuffer(char* data, size_t size, const T& shared_object, uint64_t identity)
+        : SharedBuffer<T>(data, size, shared_object),
+          IdentifiedBuffer(identity) {}
+};
+
+/// \brief SharedStreamBuffer class to read the pre-allocated buffer (e.g. mmaped file) as a stream without copying it.
+class SharedStreamBuffer : public std::streambuf {
+public:
+    SharedStreamBuffer(char* data, size_t size) {
+        setg(data, data, data + size);
+    }
+
+protected:
+    pos_type seekoff(off_type off,
+                     std::ios_base::seekdir dir,
+                     std::ios_base::openmode which = std::ios_base::in) override {
+        char* base = dir == std::ios_base::beg ? eback() : (dir == std::ios_base::cur ? gptr() : egptr());
+        if (off < eback() - base || off > egptr() - base)
+            return pos_type(off_type(-1));
+        setg(eback(), base + off, egptr());
+        return pos_type(gptr() - eback());
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
 }  // namespace ov
@@ -4,6 +4,8 @@
 
 #include "openvino/reference/convert.hpp"
 
+#include "openvino/core/parallel.hpp"
+
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
 #    include "jit_generator.hpp"
 
@@ -224,13 +226,30 @@ public:
     }
 };
 
+// The big arrays (e.g. the weights being constant folded) are converted by blocks in parallel
+constexpr size_t convert_block_size = 1 << 16;
+
+template <typename TI, typename TO>
+void convert_by_blocks(const jit_convert_array::fn_t& converter, const TI* arg, TO* out, size_t count) {
+    if (count < 2 * convert_block_size) {
+        jit_convert_array::args_t args = {arg, out, count};
+        converter(&args);
+        return;
+    }
+    const size_t blocks = (count + convert_block_size - 1) / convert_block_size;
+    ov::parallel_for(blocks, [&](size_t block) {
+        const size_t offset = block * convert_block_size;
+        jit_convert_array::args_t args = {arg + offset, out + offset, std::min(convert_block_size, count - offset)};
+        converter(&args);
+    });
+}
+
 template <typename TI, typename TO, bool clamp = false>
 void convert_impl(const TI* arg, TO* out, size_t count) {
     auto converter = jit_convert_array::get<TI, TO, clamp>();
 
     if (converter) {
-        jit_convert_array::args_t args = {arg, out, count};
-        converter(&args);
+        convert_by_blocks(converter, arg, out, count);
     } else {
         for (size_t i = 0; i < count; ++i) {
             out[i] = static_cast<TO>(arg[i]);
@@ -243,8 +262,7 @@ void convert_impl<float, float16, true>(const float* arg, float16* out, size_t c
     auto converter = jit_convert_array::get<float, float16, true>();
 
     if (converter) {
-        jit_convert_array::args_t args = {arg, out, count};
-        converter(&args);
+        convert_by_blocks(converter, arg, out, count);
     } else {
         for (size_t i = 0; i < count; ++i) {
             if (arg[i] > std::numeric_limits<ov::float16>::max()) {
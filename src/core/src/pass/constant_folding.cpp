@@ -4,10 +4,26 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <string>
+#include <unordered_map>
+
 #include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
+#include "openvino/op/concat.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/squeeze.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/op/util/binary_elementwise_bitwise.hpp"
+#include "openvino/op/util/binary_elementwise_comparison.hpp"
+#include "openvino/op/util/binary_elementwise_logical.hpp"
+#include "openvino/op/util/gather_base.hpp"
 #include "openvino/op/util/op_types.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
@@ -47,48 +63,185 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+namespace {
+/**
+ * \brief Split topologically sorted nodes into levels, the inputs of a node are produced by previous levels only.
+ *
+ * \param ordered_ops  Nodes in topological order.
+ *
+ * \return Levels of nodes, each level keeps the topological order of its nodes.
+ */
+std::vector<ov::NodeVector> split_by_levels(const ov::NodeVector& ordered_ops) {
+    std::unordered_map<const ov::Node*, size_t> node_level;
+    std::vector<ov::NodeVector> levels;
+    for (const auto& node : ordered_ops) {
+        size_t level = 0;
+        for (const auto& input : node->input_values()) {
+            const auto it = node_level.find(input.get_node());
+            if (it != node_level.end())
+                level = std::max(level, it->second + 1);
+        }
+        for (const auto& dependency : node->get_control_dependencies()) {
+            const auto it = node_level.find(dependency.get());
+            if (it != node_level.end())
+                level = std::max(level, it->second + 1);
+        }
+        node_level[node.get()] = level;
+        if (levels.size() <= level)
+            levels.resize(level + 1);
+        levels[level].push_back(node);
+    }
+    return levels;
+}
+
+struct FoldResult {
+    bool evaluated = false;
+    bool folded = false;
+    ov::OutputVector replacements;
+    std::exception_ptr exception;
+};
+
+// Folding of the level is run in parallel only if the constants read by the level are big enough to pay for threads
+constexpr size_t parallel_folding_min_bytes = 1 << 20;
+
+/**
+ * \brief Check if the node may be folded concurrently with the other nodes.
+ *
+ * constant_fold and evaluate of the node must only read the input Constants, which may be shared by the nodes of the
+ * level, and create the new output Constants. It is known for the listed operations of the core opsets, while the
+ * other ones (e.g. the operations of the plugins) may keep a state or change the inputs, so they are folded serially.
+ *
+ * \param node  Node to check.
+ *
+ * \return true if the node may be folded in parallel.
+ */
+bool is_stateless_fold(const std::shared_ptr<ov::Node>& node) {
+    const auto version_id = node->get_type_info().version_id;
+    if (version_id == nullptr || std::string(version_id).compare(0, 5, "opset") != 0)
+        return false;
+    return ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseBitwise>(node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseComparison>(node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseLogical>(node) || ov::is_type<ov::op::v0::Convert>(node) ||
+           ov::is_type<ov::op::v0::Concat>(node) || ov::is_type<ov::op::v1::Reshape>(node) ||
+           ov::is_type<ov::op::v0::Squeeze>(node) || ov::is_type<ov::op::v0::Unsqueeze>(node) ||
+           ov::is_type<ov::op::v1::Transpose>(node) || ov::is_type<ov::op::util::GatherBase>(node);
+}
+
+/**
+ * \brief Constant fold in parallel the nodes of one level whose inputs are all Constants.
+ *
+ * The nodes of a level don't depend on each other, so they are evaluated concurrently while the graph itself is not
+ * changed: the results are applied to the graph by the caller in the original order of the nodes. Only the nodes
+ * accepted by is_stateless_fold are evaluated concurrently.
+ *
+ * \param level  Nodes of one level.
+ *
+ * \return Fold results for the nodes of the level, not evaluated for the nodes which have to be folded serially.
+ */
+std::vector<FoldResult> fold_in_parallel(const ov::NodeVector& level) {
+    std::vector<FoldResult> results(level.size());
+    std::vector<size_t> candidates;
+    size_t input_bytes = 0;
+    for (size_t i = 0; i < level.size(); ++i) {
+        const auto& node = level[i];
+        if (node->get_input_size() == 0 || !is_stateless_fold(node) || ov::pass::constant_folding_is_disabled(node))
+            continue;
+        const auto& input_values = node->input_values();
+        const bool all_constants =
+            std::all_of(input_values.cbegin(), input_values.cend(), [](const ov::Output<ov::Node>& input) {
+                return ov::is_type<ov::op::v0::Constant>(input.get_node());
+            });
+        if (!all_constants)
+            continue;
+        for (const auto& input : input_values) {
+            input_bytes += ov::as_type<ov::op::v0::Constant>(input.get_node())->get_byte_size();
+            // the unique name is created on the first access, so it's not created by the concurrent folds of the
+            // nodes sharing the Constant
+            input.get_node()->get_name();
+        }
+        candidates.push_back(i);
+    }
+
+    const size_t threads_num = std::min(static_cast<size_t>(parallel_get_max_threads()), candidates.size());
+    if (threads_num < 2 || input_bytes < parallel_folding_min_bytes)
+        return results;
+
+    ov::parallel_for(candidates.size(), [&](size_t i) {
+        const auto& node = level[candidates[i]];
+        auto& result = results[candidates[i]];
+        result.replacements.resize(node->get_output_size());
+        try {
+            result.folded = node->constant_fold(result.replacements, node->input_values());
+        } catch (...) {
+            result.exception = std::current_exception();
+        }
+        result.evaluated = true;
+    });
+    return results;
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
 
-    for (const auto& node : model->get_ordered_ops()) {
+    for (const auto& level : split_by_levels(model->get_ordered_ops())) {
         if (rewritten) {
-            node->validate_and_infer_types();
+            for (const auto& node : level)
+                node->validate_and_infer_types();
         }
 
-        OutputVector replacements(node->get_output_size());
-
-        if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(node, replacement.get_node_shared_ptr());
+        auto results = fold_in_parallel(level);
 
-                    rewritten = true;
-                }
+        for (size_t node_idx = 0; node_idx < level.size(); ++node_idx) {
+            const auto& node = level[node_idx];
+            auto& result = results[node_idx];
+
+            OutputVector replacements(node->get_output_size());
+            bool folded;
+            if (result.evaluated) {
+                if (result.exception)
+                    std::rethrow_exception(result.exception);
+                folded = result.folded;
+                replacements = std::move(result.replacements);
+            } else {
+                folded = node->constant_fold(replacements, node->input_values());
             }
-        } else {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
-                size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
-                for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                    rewritten |= run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind)));
+
+            if (folded) {
+                OPENVINO_ASSERT(!constant_folding_is_disabled(node),
+                                "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                                node);
+                OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                                "constant_fold_default returned incorrect number of replacements for ",
+                                node);
+
+                for (size_t i = 0; i < replacements.size(); ++i) {
+                    auto node_output = node->output(i);
+                    auto replacement = replacements.at(i);
+                    if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+                        replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
+
+                        node_output.replace(replacement);
+                        // Copy runtime info from source nodes
+                        // when it was not propogated during pre-calculation
+                        copy_runtime_info_from_input_values(node);
+                        // Propagate runtime info attributes to replacement
+                        copy_runtime_info(node, replacement.get_node_shared_ptr());
+
+                        rewritten = true;
+                    }
+                }
+            } else {
+                // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
+                if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+                    size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+                    for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
+                        rewritten |= run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind)));
+                    }
                 }
             }
         }
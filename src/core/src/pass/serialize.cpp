@@ -7,6 +7,7 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <deque>
 #include <fstream>
 #include <openvino/cc/pass/itt.hpp>
 #include <unordered_map>
@@ -22,6 +23,7 @@
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/reference/convert.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/string_aligned_buffer.hpp"
 #include "openvino/util/file_util.hpp"
 #include "pugixml.hpp"
@@ -147,6 +149,13 @@ public:
         return offset;
     }
 
+    // Writes the identity of the buffer instead of its data (see ov::IdentifiedBuffer). The identities are kept
+    // by the writer since the deduplication compares the next constants with the written ones.
+    FilePosition write_identity(uint64_t identity, size_t* new_size) {
+        m_identities.push_back(identity);
+        return write(reinterpret_cast<const char*>(&m_identities.back()), sizeof(identity), new_size);
+    }
+
 private:
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
@@ -188,6 +197,7 @@ private:
     std::ostream& m_binary_output;
     bool m_enable_compression;
     FilePosition m_blob_offset;  // blob offset inside output stream
+    std::deque<uint64_t> m_identities;  // the pointers to the elements are stored in m_hash_to_file_positions
 };
 
 void ngfunction_2_ir(pugi::xml_node& node,
@@ -565,11 +575,19 @@ public:
             if (name == "value" && translate_type_name(m_node_type_name) == "Const") {
                 const int64_t size = a->get()->size();
                 size_t new_size;
-                int64_t offset = m_constant_write_handler.write(static_cast<const char*>(a->get()->get_ptr()),
-                                                                size,
-                                                                &new_size,
-                                                                m_compress_to_fp16,
-                                                                m_output_element_type);
+                int64_t offset;
+                const auto identified = std::dynamic_pointer_cast<ov::IdentifiedBuffer>(a->get());
+                if (m_deterministic && identified) {
+                    // hash calculation: the identity of the data is used instead of the data itself
+                    offset = m_constant_write_handler.write_identity(identified->get_identity(), &new_size);
+                    new_size = size;
+                } else {
+                    offset = m_constant_write_handler.write(static_cast<const char*>(a->get()->get_ptr()),
+                                                            size,
+                                                            &new_size,
+                                                            m_compress_to_fp16,
+                                                            m_output_element_type);
+                }
 
                 m_xml_node.append_attribute("offset").set_value(static_cast<unsigned long long>(offset));
                 m_xml_node.append_attribute("size").set_value(static_cast<unsigned long long>(new_size));
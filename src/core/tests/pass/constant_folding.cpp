@@ -3947,4 +3947,91 @@ TEST(constant_folding, sq_diff) {
     ASSERT_NE(const_node, nullptr);
     auto res_node = std::dynamic_pointer_cast<ov::op::v0::Result>(ops.back());
     ASSERT_NE(res_node, nullptr);
-}
\ No newline at end of file
+}
+
+TEST(constant_folding, independent_subgraphs_with_big_constants) {
+    // the branches don't depend on each other and read enough data to be folded in parallel
+    const size_t branches_num = 16;
+    const Shape shape{256, 512};
+    OutputVector concat_inputs;
+    std::vector<std::vector<float>> expected(branches_num);
+    for (size_t i = 0; i < branches_num; ++i) {
+        std::vector<uint8_t> weights_values(shape_size(shape));
+        for (size_t j = 0; j < weights_values.size(); ++j) {
+            weights_values[j] = static_cast<uint8_t>((i + j) % 256);
+        }
+        auto weights = op::v0::Constant::create(element::u8, shape, weights_values);
+        auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+        auto scale = op::v0::Constant::create(element::f32, Shape{shape[0], 1}, {0.5f + static_cast<float>(i)});
+        auto multiply = make_shared<op::v1::Multiply>(convert, scale);
+        multiply->set_friendly_name("multiply_" + std::to_string(i));
+        concat_inputs.push_back(multiply);
+
+        for (const auto value : weights_values) {
+            expected[i].push_back(static_cast<float>(value) * (0.5f + static_cast<float>(i)));
+        }
+    }
+    auto param = make_shared<op::v0::Parameter>(element::f32, Shape{1, 512});
+    concat_inputs.push_back(param);
+    auto concat = make_shared<op::v0::Concat>(concat_inputs, 0);
+    auto model = make_shared<Model>(NodeVector{concat}, ParameterVector{param});
+
+    run_constant_folding(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    for (size_t i = 0; i < branches_num; ++i) {
+        auto folded = ov::as_type_ptr<op::v0::Constant>(concat->get_input_node_shared_ptr(i));
+        ASSERT_TRUE(folded);
+        ASSERT_EQ(folded->get_friendly_name(), "multiply_" + std::to_string(i));
+        ASSERT_EQ(folded->get_shape(), shape);
+        ASSERT_EQ(folded->cast_vector<float>(), expected[i]);
+    }
+}
+
+TEST(constant_folding, shared_constants_folded_in_parallel) {
+    // the nodes of the level read the same Constants, whose names are not created before the folding
+    const size_t branches_num = 16;
+    const Shape shape{256, 1024};
+    std::vector<float> values(shape_size(shape));
+    for (size_t j = 0; j < values.size(); ++j) {
+        values[j] = static_cast<float>(j % 256);
+    }
+    auto shared = op::v0::Constant::create(element::f32, shape, values);
+    auto shared_scale = op::v0::Constant::create(element::f32, Shape{}, {2.0f});
+    OutputVector concat_inputs;
+    for (size_t i = 0; i < branches_num; ++i) {
+        auto multiply = make_shared<op::v1::Multiply>(shared, shared_scale);
+        auto shift = op::v0::Constant::create(element::f32, Shape{}, {static_cast<float>(i)});
+        auto add = make_shared<op::v1::Add>(shared, shift);
+        multiply->set_friendly_name("multiply_" + std::to_string(i));
+        add->set_friendly_name("add_" + std::to_string(i));
+        concat_inputs.push_back(multiply);
+        concat_inputs.push_back(add);
+    }
+    auto param = make_shared<op::v0::Parameter>(element::f32, Shape{1, 1024});
+    concat_inputs.push_back(param);
+    auto concat = make_shared<op::v0::Concat>(concat_inputs, 0);
+    auto model = make_shared<Model>(NodeVector{concat}, ParameterVector{param});
+
+    run_constant_folding(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(model), 0);
+    for (size_t i = 0; i < branches_num; ++i) {
+        auto multiply = ov::as_type_ptr<op::v0::Constant>(concat->get_input_node_shared_ptr(2 * i));
+        auto add = ov::as_type_ptr<op::v0::Constant>(concat->get_input_node_shared_ptr(2 * i + 1));
+        ASSERT_TRUE(multiply);
+        ASSERT_TRUE(add);
+        ASSERT_EQ(multiply->get_friendly_name(), "multiply_" + std::to_string(i));
+        ASSERT_EQ(add->get_friendly_name(), "add_" + std::to_string(i));
+        const auto multiplied = multiply->cast_vector<float>();
+        const auto added = add->cast_vector<float>();
+        for (size_t j = 0; j < values.size(); ++j) {
+            ASSERT_EQ(multiplied[j], values[j] * 2.0f);
+            ASSERT_EQ(added[j], values[j] + static_cast<float>(i));
+        }
+    }
+    // the shared Constants are not changed
+    ASSERT_EQ(shared->cast_vector<float>(), values);
+}
@@ -204,9 +204,16 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     if (!weights_path.empty()) {
         if (enable_mmap) {
             auto mapped_memory = ov::load_mmap_object(weights_path);
-            weights = std::make_shared<ov::SharedBuffer<std::shared_ptr<MappedMemory>>>(mapped_memory->data(),
-                                                                                        mapped_memory->size(),
-                                                                                        mapped_memory);
+            // the mapped weights are read only, so the constants may be identified by their place in the file
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+            const auto identity = ov::util::get_file_info_hash(ov::util::wstring_to_string(weights_path));
+#else
+            const auto identity = ov::util::get_file_info_hash(weights_path);
+#endif
+            weights = std::make_shared<ov::IdentifiedSharedBuffer<std::shared_ptr<MappedMemory>>>(mapped_memory->data(),
+                                                                                                  mapped_memory->size(),
+                                                                                                  mapped_memory,
+                                                                                                  identity);
         } else {
             std::ifstream bin_stream;
             bin_stream.open(weights_path.c_str(), std::ios::binary);
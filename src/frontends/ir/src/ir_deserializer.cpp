@@ -22,6 +22,7 @@
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/string_aligned_buffer.hpp"
+#include "openvino/util/common_util.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "rt_info_deserializer.hpp"
 #include "transformations/rt_info/attributes.hpp"
@@ -362,8 +363,20 @@ void ov::XmlDeserializer::on_adapter(const std::string& name, ov::ValueAccessor<
                 if (size < ((ov::shape_size(shape) * el_type.bitwidth() + 7) >> 3))
                     OPENVINO_THROW("Attribute and shape size are inconsistent for ", type, " op!");
 
-                auto buffer =
-                    std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(data, size, m_weights);
+                std::shared_ptr<ov::AlignedBuffer> buffer;
+                if (auto weights = std::dynamic_pointer_cast<ov::IdentifiedBuffer>(m_weights)) {
+                    // the constant is identified by its place in the weights file, so the model cache hash
+                    // doesn't need to read the data
+                    const uint64_t identity =
+                        ov::util::hash_combine({static_cast<size_t>(weights->get_identity()), offset, size});
+                    buffer = std::make_shared<ov::IdentifiedSharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(data,
+                                                                                                            size,
+                                                                                                            m_weights,
+                                                                                                            identity);
+                } else {
+                    buffer =
+                        std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(data, size, m_weights);
+                }
                 a->set(buffer);
             }
         }
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 
@@ -49,6 +50,22 @@ static constexpr Property<std::string, PropertyMutability::WO> config_device_id{
  */
 static constexpr Property<int32_t, PropertyMutability::RW> threads_per_stream{"THREADS_PER_STREAM"};
 
+/**
+ * @brief The models compiled with the same id share the constant weights, e.g. the same model compiled for several
+ * batch sizes. Empty id (default) means no sharing between the compiled models.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<std::string, PropertyMutability::RW> weights_sharing_id{"WEIGHTS_SHARING_ID"};
+
+/**
+ * @brief Buffer with the whole cache blob (e.g. mmaped cache file) passed to import_model along with the stream, so
+ * the plugin may reference the data of the blob in place instead of copying it. The plugin keeps the buffer as long as
+ * the referenced data is used.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<std::shared_ptr<ov::AlignedBuffer>, PropertyMutability::RW> cached_model_buffer{
+    "CACHED_MODEL_BUFFER"};
+
 /**
  * @brief It contains compiled_model_runtime_properties information to make plugin runtime can check whether it is
  * compatible with the cached compiled model, the result is returned by get_property() calling.
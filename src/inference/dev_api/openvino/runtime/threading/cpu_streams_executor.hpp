@@ -45,6 +45,13 @@ public:
 
     void run(Task task) override;
 
+    /**
+     * @brief Executes all the tasks and waits for them. In the task stealing mode the stream thread runs the tasks
+     *        of its own queue while it waits, so the tasks it has queued are run even if no other stream steals them.
+     * @param tasks A vector of tasks to execute
+     */
+    void run_and_wait(const std::vector<Task>& tasks) override;
+
     void execute(Task task) override;
 
     int get_stream_id() override;
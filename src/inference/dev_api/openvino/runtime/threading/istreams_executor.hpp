@@ -82,6 +82,8 @@ public:
         std::vector<std::vector<int>> _streams_info_table = {};
         std::vector<std::vector<int>> _stream_processor_ids;
         bool _cpu_reservation = false;
+        bool _task_stealing = false;  //!< Use the lock-free task queues with the work stealing between the streams
+                                      //!< of the same NUMA node instead of the single mutex-protected queue
 
         /**
          * @brief Get and reserve cpu ids based on configuration and hardware information,
@@ -114,6 +116,7 @@ public:
          * @param[in]  threadPreferredCoreType  @copybrief Config::_thread_preferred_core_type
          * @param[in]  streamsInfoTable         @copybrief Config::_streams_info_table
          * @param[in]  cpuReservation           @copybrief Config::_cpu_reservation
+         * @param[in]  taskStealing             @copybrief Config::_task_stealing
          */
         Config(std::string name = "StreamsExecutor",
                int streams = 1,
@@ -124,7 +127,8 @@ public:
                int threads = 0,
                PreferredCoreType threadPreferredCoreType = PreferredCoreType::ANY,
                std::vector<std::vector<int>> streamsInfoTable = {},
-               bool cpuReservation = false)
+               bool cpuReservation = false,
+               bool taskStealing = false)
             : _name{name},
               _streams{streams},
               _threads_per_stream{threadsPerStream},
@@ -134,7 +138,8 @@ public:
               _threads{threads},
               _thread_preferred_core_type(threadPreferredCoreType),
               _streams_info_table{streamsInfoTable},
-              _cpu_reservation{cpuReservation} {
+              _cpu_reservation{cpuReservation},
+              _task_stealing{taskStealing} {
             update_executor_config();
         }
 
@@ -187,6 +192,9 @@ public:
         std::vector<std::vector<int>> get_stream_processor_ids() {
             return _stream_processor_ids;
         }
+        bool get_task_stealing() const {
+            return _task_stealing;
+        }
         ThreadBindingType get_thread_binding_type() {
             return _threadBindingType;
         }
@@ -199,7 +207,8 @@ public:
         bool operator==(const Config& config){
             if (_name == config._name && _streams == config._streams &&
                 _threads_per_stream == config._threads_per_stream && _threadBindingType == config._threadBindingType &&
-                _thread_preferred_core_type == config._thread_preferred_core_type) {
+                _thread_preferred_core_type == config._thread_preferred_core_type &&
+                _task_stealing == config._task_stealing) {
                 return true;
             } else {
                 return false;
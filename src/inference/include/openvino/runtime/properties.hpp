@@ -698,6 +698,35 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to let the auto-batching adapt the batch collection to the load
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * The timeout is derived on the fly from the requests arrival rate and the batch execution time, the
+ * ov::auto_batch_timeout is used as the upper bound. Partially collected batches are executed with the batched model
+ * (the inputs of the missing requests are padded) when this is faster than the execution request by request.
+ */
+static constexpr Property<bool, PropertyMutability::RW> auto_batch_adaptive_timeout{"AUTO_BATCH_ADAPTIVE_TIMEOUT"};
+
+/**
+ * @brief Read-only property to get the average number of requests in the batched executions of the auto-batching
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<float, PropertyMutability::RO> auto_batch_executed_batch_size{"AUTO_BATCH_EXECUTED_BATCH_SIZE"};
+
+/**
+ * @brief Read-only property to get the average time (in ms) the requests wait in the auto-batching queue
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<float, PropertyMutability::RO> auto_batch_queue_delay{"AUTO_BATCH_QUEUE_DELAY"};
+
+/**
+ * @brief Enables the ladder of the batch sizes (powers of 2 below the auto-batching batch size) compiled in the
+ * background, so the partial batches collected by the timeout are executed with the closest batch size
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> auto_batch_ladder{"AUTO_BATCH_LADDER"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
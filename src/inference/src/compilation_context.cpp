@@ -4,13 +4,6 @@
 
 #include "compilation_context.hpp"
 
-#include <sys/stat.h>
-#include <sys/types.h>
-
-#ifndef _WIN32
-#    include <unistd.h>
-#endif
-
 #include "itt.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/util/file_util.hpp"
@@ -19,10 +12,6 @@
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
-#ifdef _WIN32
-#    define stat _stat
-#endif
-
 namespace ov {
 
 template <typename T>
@@ -41,25 +30,7 @@ static int32_t as_int32_t(T v) {
 namespace ov {
 
 std::string ModelCache::calculate_file_info(const std::string& filePath) {
-    uint64_t seed = 0;
-    auto absPath = filePath;
-    if (filePath.size() > 0) {
-        try {
-            absPath = ov::util::get_absolute_file_path(filePath);
-        } catch (std::runtime_error&) {
-            // can't get absolute path, will use filePath for hash
-        }
-    }
-
-    seed = hash_combine(seed, absPath);
-
-    std::string res;
-    struct stat result;
-    if (stat(absPath.c_str(), &result) == 0) {
-        seed = hash_combine(seed, result.st_mtime);
-        seed = hash_combine(seed, result.st_size);
-    }
-    return std::to_string(seed);
+    return std::to_string(ov::util::get_file_info_hash(filePath));
 }
 
 std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& model, const ov::AnyMap& compileOptions) {
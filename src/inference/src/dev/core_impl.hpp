@@ -100,10 +100,13 @@ private:
 
     struct CacheContent {
         explicit CacheContent(const std::shared_ptr<ov::ICacheManager>& cache_manager,
+                              bool mmap_enabled = false,
                               const std::string model_path = {})
             : cacheManager(cache_manager),
+              mmapEnabled(mmap_enabled),
               modelPath(model_path) {}
         std::shared_ptr<ov::ICacheManager> cacheManager;
+        bool mmapEnabled = false;
         std::string blobId = {};
         std::string modelPath = {};
     };
@@ -4,8 +4,11 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -13,6 +16,7 @@
 #include <thread>
 #include <vector>
 
+#include "dev/threading/mpmc_queue.hpp"
 #include "dev/threading/parallel_custom_arena.hpp"
 #include "dev/threading/thread_affinity.hpp"
 #include "openvino/itt.hpp"
@@ -304,6 +308,28 @@ struct CPUStreamsExecutor::Impl {
         std::mutex _stream_map_mutex;
     };
 
+    // the state of the stream thread in the task stealing mode
+    struct Worker {
+        Worker(Impl* impl, size_t index) : _impl(impl), _index(index), _localQueue(localQueueCapacity) {}
+        Impl* _impl = nullptr;
+        size_t _index = 0;
+        // the tasks which are run from this thread, other threads of the same NUMA node may steal them
+        MPMCQueue<Task> _localQueue;
+        std::atomic<int> _numaNodeIdx{-1};
+    };
+
+    struct NumaNodeQueues {
+        std::condition_variable _condVar;
+        std::atomic<int> _sleepingThreads{0};
+        // the number of the tasks in the local queues of the node's threads
+        std::atomic<int> _localTasks{0};
+    };
+
+    static Worker*& current_worker() {
+        static thread_local Worker* worker = nullptr;
+        return worker;
+    }
+
     explicit Impl(const Config& config)
         : _config{config},
           _streams(
@@ -321,9 +347,23 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = numaNodes;
         }
+        if (_config.get_task_stealing() && streams_num > 0) {
+            _numaNodeIds = numaNodes;
+            for (size_t i = 0; i < std::max<size_t>(1, _numaNodeIds.size()); i++) {
+                _numaNodeQueues.emplace_back(new NumaNodeQueues);
+            }
+            for (auto streamId = 0; streamId < streams_num; ++streamId) {
+                _workers.emplace_back(new Worker(this, streamId));
+            }
+            _globalQueue.reset(new MPMCQueue<Task>(globalQueueCapacity));
+        }
         for (auto streamId = 0; streamId < streams_num; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
+                if (_globalQueue) {
+                    WorkerLoop(*_workers[streamId]);
+                    return;
+                }
                 for (bool stopped = false; !stopped;) {
                     Task task;
                     {
@@ -345,7 +385,178 @@ struct CPUStreamsExecutor::Impl {
         _streams.set_thread_ids_map(_threads);
     }
 
+    void WorkerLoop(Worker& worker) {
+        current_worker() = &worker;
+        auto stream = _streams.local();
+        const auto it = std::find(_numaNodeIds.begin(), _numaNodeIds.end(), stream->_numaNodeId);
+        const size_t numaNodeIdx =
+            it == _numaNodeIds.end() ? 0 : static_cast<size_t>(std::distance(_numaNodeIds.begin(), it));
+        worker._numaNodeIdx = static_cast<int>(numaNodeIdx);
+        auto& node = *_numaNodeQueues[numaNodeIdx];
+        for (;;) {
+            Task task;
+            bool found = PopTask(worker, task);
+            // a short spinning before falling asleep saves the wake up latency when the tasks come at high rate
+            for (int spin = 0; !found && spin < spinCount; spin++) {
+                std::this_thread::yield();
+                found = PopTask(worker, task);
+            }
+            if (found) {
+                Execute(task, *stream);
+                continue;
+            }
+            bool stopped = false;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                node._sleepingThreads++;
+                node._condVar.wait(lock, [&] {
+                    return _pendingTasks > 0 || node._localTasks > 0 || HasBusyNode() || (stopped = _isStopped);
+                });
+                node._sleepingThreads--;
+            }
+            if (stopped) {
+                break;
+            }
+        }
+        current_worker() = nullptr;
+    }
+
+    bool PopTask(Worker& worker, Task& task) {
+        auto& node = *_numaNodeQueues[worker._numaNodeIdx];
+        if (worker._localQueue.try_pop(task)) {
+            node._localTasks--;
+            return true;
+        }
+        if (_globalQueue->try_pop(task)) {
+            _pendingTasks--;
+            return true;
+        }
+        // steal from the other threads of the same NUMA node
+        for (size_t i = 1; i < _workers.size(); i++) {
+            auto& victim = *_workers[(worker._index + i) % _workers.size()];
+            if (victim._numaNodeIdx == worker._numaNodeIdx && victim._localQueue.try_pop(task)) {
+                node._localTasks--;
+                return true;
+            }
+        }
+        if (_overflowTasks > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                _overflowTasks--;
+                _pendingTasks--;
+                return true;
+            }
+        }
+        // the fallback: steal from the NUMA nodes with no idle thread, e.g. the only stream of the node may wait
+        // for the tasks of its own local queue
+        for (size_t i = 1; i < _workers.size(); i++) {
+            auto& victim = *_workers[(worker._index + i) % _workers.size()];
+            const int victimNodeIdx = victim._numaNodeIdx;
+            if (victimNodeIdx < 0 || victimNodeIdx == worker._numaNodeIdx)
+                continue;
+            auto& victimNode = *_numaNodeQueues[victimNodeIdx];
+            if (victimNode._sleepingThreads == 0 && victim._localQueue.try_pop(task)) {
+                victimNode._localTasks--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // whether some NUMA node has the tasks in the local queues but no thread sleeping, so no thread of the node
+    // is going to take them soon
+    bool HasBusyNode() const {
+        for (const auto& node : _numaNodeQueues) {
+            if (node->_localTasks > 0 && node->_sleepingThreads == 0)
+                return true;
+        }
+        return false;
+    }
+
+    bool IsCurrentWorker() const {
+        auto worker = current_worker();
+        return worker != nullptr && worker->_impl == this;
+    }
+
+    // the stream thread waits for the tasks by running the tasks of its own queue, the tasks may be in this queue
+    void RunAndWait(const std::vector<Task>& tasks) {
+        auto& worker = *current_worker();
+        auto stream = _streams.local();
+        std::vector<std::packaged_task<void()>> packagedTasks;
+        std::vector<std::future<void>> futures;
+        for (std::size_t i = 0; i < tasks.size(); ++i) {
+            packagedTasks.emplace_back([&tasks, i] {
+                tasks[i]();
+            });
+            futures.emplace_back(packagedTasks.back().get_future());
+        }
+        for (std::size_t i = 0; i < tasks.size(); ++i) {
+            EnqueueStealing([&packagedTasks, i] {
+                packagedTasks[i]();
+            });
+        }
+        for (auto&& future : futures) {
+            while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                Task task;
+                if (PopTask(worker, task)) {
+                    Execute(task, *stream);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+        for (auto&& future : futures) {
+            future.get();
+        }
+    }
+
+    void Notify(NumaNodeQueues& node) {
+        // the mutex guarantees the sleeping thread has either checked the queues after the push or is waiting already
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+        }
+        node._condVar.notify_one();
+    }
+
+    void EnqueueStealing(Task task) {
+        auto worker = current_worker();
+        if (worker != nullptr && worker->_impl == this && worker->_localQueue.try_push(task)) {
+            auto& node = *_numaNodeQueues[worker->_numaNodeIdx];
+            node._localTasks++;
+            if (node._sleepingThreads > 0) {
+                Notify(node);
+                return;
+            }
+            // no idle thread on the node, the threads of the other nodes may steal the task
+            for (auto& other : _numaNodeQueues) {
+                if (other->_sleepingThreads > 0) {
+                    Notify(*other);
+                    break;
+                }
+            }
+            return;
+        }
+        if (!_globalQueue->try_push(task)) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _taskQueue.emplace(std::move(task));
+            _overflowTasks++;
+        }
+        _pendingTasks++;
+        for (auto& node : _numaNodeQueues) {
+            if (node->_sleepingThreads > 0) {
+                Notify(*node);
+                break;
+            }
+        }
+    }
+
     void Enqueue(Task task) {
+        if (_globalQueue) {
+            EnqueueStealing(std::move(task));
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -394,6 +605,19 @@ struct CPUStreamsExecutor::Impl {
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
     std::shared_ptr<ExecutorManager> _exectorMgr;
+
+    // task stealing mode, see IStreamsExecutor::Config::_task_stealing
+    // _taskQueue keeps the tasks which do not fit into the global queue
+    static constexpr size_t globalQueueCapacity = 4096;
+    static constexpr size_t localQueueCapacity = 256;
+    static constexpr int spinCount = 64;
+    std::unique_ptr<MPMCQueue<Task>> _globalQueue;
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::vector<int> _numaNodeIds;
+    std::vector<std::unique_ptr<NumaNodeQueues>> _numaNodeQueues;
+    // the number of the tasks in the global and the overflow queues
+    std::atomic<int> _pendingTasks{0};
+    std::atomic<int> _overflowTasks{0};
 };
 
 int CPUStreamsExecutor::get_stream_id() {
@@ -419,6 +643,9 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
         _impl->_isStopped = true;
     }
     _impl->_queueCondVar.notify_all();
+    for (auto& node : _impl->_numaNodeQueues) {
+        node->_condVar.notify_all();
+    }
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
@@ -430,6 +657,14 @@ void CPUStreamsExecutor::execute(Task task) {
     _impl->Defer(std::move(task));
 }
 
+void CPUStreamsExecutor::run_and_wait(const std::vector<Task>& tasks) {
+    if (_impl->_globalQueue && _impl->IsCurrentWorker()) {
+        _impl->RunAndWait(tasks);
+    } else {
+        ITaskExecutor::run_and_wait(tasks);
+    }
+}
+
 void CPUStreamsExecutor::run(Task task) {
     if (0 == _impl->_config.get_streams()) {
         _impl->Defer(std::move(task));
@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace threading {
+
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer FIFO queue.
+ * Every cell has a sequence number which tells the producers and the consumers whether the cell is free or holds a
+ * value for the current lap, so the only contended operations are the CAS on the enqueue and dequeue positions.
+ * @tparam T The type of the values, must be default constructible and movable
+ */
+template <typename T>
+class MPMCQueue {
+public:
+    /**
+     * @brief Constructs the queue
+     * @param capacity The maximum number of the values in the queue, must be a power of 2
+     */
+    explicit MPMCQueue(size_t capacity) : m_cells(new Cell[capacity]), m_mask(capacity - 1) {
+        OPENVINO_ASSERT(capacity >= 2 && (capacity & (capacity - 1)) == 0, "MPMCQueue capacity must be a power of 2");
+        for (size_t i = 0; i < capacity; i++) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        m_enqueue_pos.store(0, std::memory_order_relaxed);
+        m_dequeue_pos.store(0, std::memory_order_relaxed);
+    }
+
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    /**
+     * @brief Pushes the value to the queue
+     * @param value The value, it is moved from only if the push succeeded
+     * @return false if the queue is full
+     */
+    bool try_push(T& value) {
+        Cell* cell;
+        size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pops the oldest value from the queue
+     * @param value The popped value
+     * @return false if the queue is empty
+     */
+    bool try_pop(T& value) {
+        Cell* cell;
+        size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->data);
+        // release the resources captured by the value right away, not when the cell is reused
+        cell->data = T{};
+        cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static constexpr size_t cache_line_size = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    const size_t m_mask;
+    // producers and consumers update different positions, keep them in the separate cache lines
+    char m_pad0[cache_line_size];
+    std::atomic<size_t> m_enqueue_pos;
+    char m_pad1[cache_line_size];
+    std::atomic<size_t> m_dequeue_pos;
+    char m_pad2[cache_line_size];
+};
+
+}  // namespace threading
+}  // namespace ov
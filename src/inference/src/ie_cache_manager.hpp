@@ -14,7 +14,9 @@
 #include <memory>
 #include <string>
 
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov {
 
@@ -46,20 +48,22 @@ public:
     virtual void write_cache_entry(const std::string& id, StreamWriter writer) = 0;
 
     /**
-     * @brief Function passing created input stream
+     * @brief Function passing created input stream and the buffer with the whole cache entry (if the stream is created
+     * on top of the memory, nullptr otherwise)
      *
      */
-    using StreamReader = std::function<void(std::istream&)>;
+    using StreamReader = std::function<void(std::istream&, std::shared_ptr<ov::AlignedBuffer>)>;
     /**
      * @brief Callback when Inference Engine intends to read network from cache
      *
-     * Client needs to call create std::istream object and call reader(istream)
+     * Client needs to call create std::istream object and call reader(istream, buffer)
      * Otherwise, network will not be read from cache and will be loaded as usual
      *
      * @param id Id of cache (hash of the network)
+     * @param enable_mmap Allows to map the cache entry to the memory instead of reading it
      * @param reader Lambda function to be called when input stream is created
      */
-    virtual void read_cache_entry(const std::string& id, StreamReader reader) = 0;
+    virtual void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) = 0;
 
     /**
      * @brief Callback when Inference Engine intends to remove cache entry
@@ -103,11 +107,21 @@ private:
         writer(stream);
     }
 
-    void read_cache_entry(const std::string& id, StreamReader reader) override {
+    void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
         if (ov::util::file_exists(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
+            if (enable_mmap) {
+                auto mmap = ov::load_mmap_object(blobFileName);
+                auto buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(mmap->data(),
+                                                                                                    mmap->size(),
+                                                                                                    mmap);
+                ov::SharedStreamBuffer stream_buffer(mmap->data(), mmap->size());
+                std::istream stream(&stream_buffer);
+                reader(stream, buffer);
+            } else {
+                std::ifstream stream(blobFileName, std::ios_base::binary);
+                reader(stream, nullptr);
+            }
         }
     }
 
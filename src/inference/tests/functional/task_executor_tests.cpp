@@ -4,11 +4,13 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <future>
 #include <thread>
 
 #include "openvino/core/parallel.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
+#include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/immediate_executor.hpp"
 
 using namespace ::testing;
@@ -216,6 +218,68 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
 
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
+static CPUStreamsExecutor::Ptr makeTaskStealingExecutor(int streams) {
+    return std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                 streams,
+                                 1,
+                                 IStreamsExecutor::ThreadBindingType::NONE,
+                                 1,
+                                 0,
+                                 0,
+                                 IStreamsExecutor::Config::PreferredCoreType::ANY,
+                                 {},
+                                 false,
+                                 true});
+}
+
+// the task run from a stream thread goes to the local queue of the stream, it is run by the other streams only if
+// they steal it
+TEST(CPUStreamsExecutorTaskStealing, tasksOfBlockedProducerAreStolen) {
+    // more tasks than the local queue can keep, the rest of them goes to the global queue
+    constexpr int tasksNum = 1000;
+    auto executor = makeTaskStealingExecutor(4);
+    std::atomic_int done = {0};
+    std::promise<void> allDone;
+    auto producer = async(executor, [&] {
+        for (int i = 0; i < tasksNum; i++) {
+            executor->run([&] {
+                if (++done == tasksNum) {
+                    allDone.set_value();
+                }
+            });
+        }
+        // the producer is blocked until the other streams run all its tasks
+        allDone.get_future().wait();
+    });
+    ASSERT_EQ(std::future_status::ready, producer.wait_for(std::chrono::seconds(30)));
+    ASSERT_EQ(tasksNum, done);
+}
+
+// every stream floods its own queue and waits for its tasks, the streams must not wait for each other. It covers
+// the single stream per NUMA node
+TEST(CPUStreamsExecutorTaskStealing, runAndWaitFromEveryStream) {
+    constexpr int tasksNum = 1000;
+    for (int streams : {1, std::max<int>(1, static_cast<int>(get_available_numa_nodes().size())), 4}) {
+        auto executor = makeTaskStealingExecutor(streams);
+        std::atomic_int done = {0};
+        std::vector<Future> producers;
+        for (int s = 0; s < streams; s++) {
+            producers.emplace_back(async(executor, [&] {
+                std::vector<Task> tasks(tasksNum, [&] {
+                    done++;
+                });
+                executor->run_and_wait(tasks);
+            }));
+        }
+        for (auto& producer : producers) {
+            ASSERT_EQ(std::future_status::ready, producer.wait_for(std::chrono::seconds(30)))
+                << "streams: " << streams;
+        }
+        ASSERT_EQ(streams * tasksNum, done) << "streams: " << streams;
+    }
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = get_number_of_cpu_cores();
@@ -244,6 +308,22 @@ static auto Executors = ::testing::Values(
                                      threads / streams,
                                      IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        auto streams = get_number_of_logical_cpu_cores(false);
+        auto threads = parallel_get_max_threads();
+        return std::make_shared<CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                     streams,
+                                     threads / streams,
+                                     IStreamsExecutor::ThreadBindingType::NONE,
+                                     1,
+                                     0,
+                                     0,
+                                     IStreamsExecutor::Config::PreferredCoreType::ANY,
+                                     {},
+                                     false,
+                                     true});
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     });
@@ -277,6 +357,22 @@ static auto AsyncExecutors = ::testing::Values(
                                      streams,
                                      threads / streams,
                                      IStreamsExecutor::ThreadBindingType::NONE});
+    },
+    [] {
+        auto streams = get_number_of_logical_cpu_cores(false);
+        auto threads = parallel_get_max_threads();
+        return std::make_shared<CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                     streams,
+                                     threads / streams,
+                                     IStreamsExecutor::ThreadBindingType::NONE,
+                                     1,
+                                     0,
+                                     0,
+                                     IStreamsExecutor::Config::PreferredCoreType::ANY,
+                                     {},
+                                     false,
+                                     true});
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
@@ -18,6 +18,7 @@
 #include "openvino/op/constant.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -171,6 +172,47 @@ TEST(NetworkContext, HashOfSame) {
     ASSERT_EQ(ModelCache::compute_hash(model1, {}), ModelCache::compute_hash(model2, {}));
 }
 
+static std::shared_ptr<ov::Model> create_model_with_identified_weights(std::vector<int8_t>& data, uint64_t identity) {
+    using Buffer = ov::IdentifiedSharedBuffer<std::shared_ptr<void>>;
+    auto buffer = std::make_shared<Buffer>(reinterpret_cast<char*>(data.data()), data.size(), nullptr, identity);
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::i8, ov::Shape{data.size()});
+    auto constant = std::make_shared<ov::op::v0::Constant>(ov::element::i8, ov::Shape{data.size()}, buffer);
+    auto add = std::make_shared<ov::op::v1::Add>(param, constant);
+    auto res = std::make_shared<ov::op::v0::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{param});
+}
+
+TEST(NetworkContext, HashWithIdentifiedWeights) {
+    std::vector<int8_t> data1{1, 2, 3, 4};
+    std::vector<int8_t> data2{5, 6, 7, 8};
+    // the data of the identified weights is not read, only the identity matters
+    ASSERT_EQ(ModelCache::compute_hash(create_model_with_identified_weights(data1, 1), {}),
+              ModelCache::compute_hash(create_model_with_identified_weights(data2, 1), {}));
+    ASSERT_NE(ModelCache::compute_hash(create_model_with_identified_weights(data1, 1), {}),
+              ModelCache::compute_hash(create_model_with_identified_weights(data1, 2), {}));
+}
+
+TEST(NetworkContext, HashWithDuplicatedIdentifiedWeights) {
+    std::vector<int8_t> data{1, 2, 3, 4};
+    auto create_model = [&data](uint64_t identity1, uint64_t identity2) {
+        using Buffer = ov::IdentifiedSharedBuffer<std::shared_ptr<void>>;
+        const ov::Shape shape{data.size()};
+        auto buffer1 = std::make_shared<Buffer>(reinterpret_cast<char*>(data.data()), data.size(), nullptr, identity1);
+        auto buffer2 = std::make_shared<Buffer>(reinterpret_cast<char*>(data.data()), data.size(), nullptr, identity2);
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::i8, shape);
+        auto constant1 = std::make_shared<ov::op::v0::Constant>(ov::element::i8, shape, buffer1);
+        auto constant2 = std::make_shared<ov::op::v0::Constant>(ov::element::i8, shape, buffer2);
+        auto add = std::make_shared<ov::op::v1::Add>(param, constant1);
+        auto mul = std::make_shared<ov::op::v1::Multiply>(add, constant2);
+        auto res = std::make_shared<ov::op::v0::Result>(mul);
+        return std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{param});
+    };
+    // the constants with the same identity are deduplicated like the constants with the same data
+    ASSERT_EQ(ModelCache::compute_hash(create_model(1, 1), {}), ModelCache::compute_hash(create_model(1, 1), {}));
+    ASSERT_NE(ModelCache::compute_hash(create_model(1, 1), {}), ModelCache::compute_hash(create_model(1, 2), {}));
+    ASSERT_NE(ModelCache::compute_hash(create_model(1, 2), {}), ModelCache::compute_hash(create_model(2, 1), {}));
+}
+
 TEST(NetworkContext, HashWithConfig) {
     auto net1 = create_simple_model();
     auto net2 = create_simple_model();
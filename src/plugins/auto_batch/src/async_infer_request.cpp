@@ -65,6 +65,12 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
+                const auto now = std::chrono::steady_clock::now();
+                _this->m_sync_request->m_enqueue_time = now;
+                {
+                    std::lock_guard<std::mutex> lock(workerInferRequest->_stats_mutex);
+                    workerInferRequest->_stats.on_arrival(now);
+                }
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
@@ -6,6 +6,7 @@
 #include "compiled_model.hpp"
 
 #include "async_infer_request.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 
 namespace ov {
 namespace autobatch_plugin {
@@ -29,10 +30,15 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto adaptive_time_out = config.find(ov::auto_batch_adaptive_timeout.name());
+    if (adaptive_time_out != config.end())
+        m_adaptive_time_out = adaptive_time_out->second.as<bool>();
 }
 
 CompiledModel::~CompiledModel() {
     m_terminate = true;
+    if (m_ladder_thread.joinable())
+        m_ladder_thread.join();
     for (const auto& w : m_worker_requests) {
         w->_thread.join();
     }
@@ -68,9 +74,17 @@ CompiledModel::GetWorkerInferRequest() const {
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                {
+                    std::lock_guard<std::mutex> lock(workerRequestPtr->_stats_mutex);
+                    BatchingStatistics::accumulate(
+                        workerRequestPtr->_stats._batch_execution,
+                        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                                  workerRequestPtr->_batch_start)
+                            .count());
+                }
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
-                for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
+                for (int c = 0; c < workerRequestPtr->_num_batched; c++) {
                     workerRequestPtr->_completion_tasks[c]();
                 }
                 // reset the timeout
@@ -78,11 +92,35 @@ CompiledModel::GetWorkerInferRequest() const {
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            // pops the collected requests to be executed with the batched request
+            auto pop_batched_tasks = [workerRequestPtr](int sz) {
+                std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+                const auto now = std::chrono::steady_clock::now();
+                double queue_delay = 0.0;
+                for (int n = 0; n < sz; n++) {
+                    OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                    workerRequestPtr->_completion_tasks[n] = std::move(t.second);
+                    t.first->m_sync_request->copy_inputs_if_needed();
+                    t.first->m_sync_request->m_batched_request_status =
+                        ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
+                    queue_delay +=
+                        std::chrono::duration<double, std::milli>(now - t.first->m_sync_request->m_enqueue_time).count();
+                }
+                {
+                    std::lock_guard<std::mutex> lock(workerRequestPtr->_stats_mutex);
+                    BatchingStatistics::accumulate(workerRequestPtr->_stats._queue_delay, queue_delay / sz);
+                    BatchingStatistics::accumulate(workerRequestPtr->_stats._executed_batch_size, sz);
+                }
+                workerRequestPtr->_num_batched = sz;
+                workerRequestPtr->_batch_start = now;
+            };
             while (1) {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    const auto time_out =
+                        get_batch_time_out(*workerRequestPtr, static_cast<int>(workerRequestPtr->_tasks.size()));
+                    status = workerRequestPtr->_cond.wait_for(lock, time_out);
                 }
                 if (m_terminate) {
                     break;
@@ -91,15 +129,39 @@ CompiledModel::GetWorkerInferRequest() const {
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
                     if (sz == workerRequestPtr->_batch_size) {
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            workerRequestPtr->_completion_tasks[n] = std::move(t.second);
-                            t.first->m_sync_request->copy_inputs_if_needed();
-                            t.first->m_sync_request->m_batched_request_status =
-                                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
-                        }
+                        pop_batched_tasks(sz);
                         workerRequestPtr->_infer_request_batched->start_async();
+                    } else if ((status == std::cv_status::timeout) && sz > 1 &&
+                               execute_ladder_batch(*workerRequestPtr, sz)) {
+                        // timeout to collect the batch is over, the requests were executed with the smaller batch
+                    } else if ((status == std::cv_status::timeout) && sz && execute_padded_batch(*workerRequestPtr, sz)) {
+                        // timeout to collect the batch is over, but the batched execution of the partial batch is
+                        // still cheaper than the batch1 one. The outputs are redirected to the padding tensors, so the
+                        // slices of the requests that are not in the batch are not overwritten
+                        pop_batched_tasks(sz);
+                        auto& batched_request = workerRequestPtr->_infer_request_batched;
+                        if (workerRequestPtr->_padding_outputs.empty()) {
+                            for (const auto& output : batched_request->get_outputs()) {
+                                auto tensor = batched_request->get_tensor(output);
+                                workerRequestPtr->_padding_outputs.emplace_back(
+                                    output,
+                                    ov::make_tensor(tensor->get_element_type(), tensor->get_shape()));
+                            }
+                        }
+                        std::vector<ov::SoPtr<ov::ITensor>> shared_outputs;
+                        for (const auto& output : workerRequestPtr->_padding_outputs) {
+                            shared_outputs.push_back(batched_request->get_tensor(output.first));
+                            batched_request->set_tensor(output.first, output.second);
+                        }
+                        batched_request->start_async();
+                        try {
+                            batched_request->wait();
+                        } catch (...) {
+                            // the exception is propagated to the requests by the callback
+                        }
+                        for (size_t i = 0; i < shared_outputs.size(); i++) {
+                            batched_request->set_tensor(workerRequestPtr->_padding_outputs[i].first, shared_outputs[i]);
+                        }
                     } else if ((status == std::cv_status::timeout) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
@@ -107,8 +169,13 @@ CompiledModel::GetWorkerInferRequest() const {
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
+                        const auto start = std::chrono::steady_clock::now();
+                        double queue_delay = 0.0;
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                            queue_delay +=
+                                std::chrono::duration<double, std::milli>(start - t.first->m_sync_request->m_enqueue_time)
+                                    .count();
                             t.first->m_request_without_batch->set_callback(
                                 [t, sz, &arrived, &all_completed](std::exception_ptr p) {
                                     if (p)
@@ -124,6 +191,14 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_request_without_batch->start_async();
                         }
                         all_completed_future.get();
+                        {
+                            std::lock_guard<std::mutex> lock(workerRequestPtr->_stats_mutex);
+                            const auto elapsed =
+                                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+                            BatchingStatistics::accumulate(workerRequestPtr->_stats._batch1_execution,
+                                                           elapsed.count() / sz);
+                            BatchingStatistics::accumulate(workerRequestPtr->_stats._queue_delay, queue_delay / sz);
+                        }
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -133,6 +208,110 @@ CompiledModel::GetWorkerInferRequest() const {
     return {m_worker_requests.back(), static_cast<int>(batch_id)};
 }
 
+std::chrono::microseconds CompiledModel::get_batch_time_out(WorkerInferRequest& worker, int num_collected) const {
+    const std::chrono::microseconds time_out = std::chrono::milliseconds(m_time_out);
+    if (!m_adaptive_time_out)
+        return time_out;
+    double arrival_interval, batch_execution;
+    {
+        std::lock_guard<std::mutex> lock(worker._stats_mutex);
+        arrival_interval = worker._stats._arrival_interval;
+        batch_execution = worker._stats._batch_execution;
+    }
+    if (arrival_interval == 0.0)
+        return time_out;
+    // expected time to collect the rest of the batch (with a slack for the arrival jitter)
+    double wait_ms = arrival_interval * (worker._batch_size - num_collected) * 1.25;
+    // waiting longer than the batch execution itself adds more latency than the batching saves
+    if (batch_execution > 0.0)
+        wait_ms = std::min(wait_ms, batch_execution);
+    const auto wait = std::chrono::microseconds(static_cast<int64_t>(wait_ms * 1000));
+    return std::min(std::max(wait, std::chrono::microseconds(100)), time_out);
+}
+
+bool CompiledModel::execute_padded_batch(WorkerInferRequest& worker, int num_collected) const {
+    if (!m_adaptive_time_out || num_collected < 2)
+        return false;
+    std::lock_guard<std::mutex> lock(worker._stats_mutex);
+    const auto& stats = worker._stats;
+    // the padded batch takes as long as the full one, so compare it with the batch1 execution of the collected requests
+    if (stats._batch1_execution == 0.0)
+        return false;
+    if (stats._batch_execution == 0.0)
+        return true;
+    return stats._batch_execution <= stats._batch1_execution * num_collected;
+}
+
+bool CompiledModel::execute_ladder_batch(WorkerInferRequest& worker, int num_collected) const {
+    int batch_size = 0;
+    ov::SoPtr<ov::ICompiledModel> compiled_model;
+    {
+        std::lock_guard<std::mutex> lock(m_ladder_mutex);
+        // the smallest compiled batch which fits all the collected requests
+        for (const auto& step : m_ladder) {
+            if (step.first >= num_collected && (!batch_size || step.first < batch_size)) {
+                batch_size = step.first;
+                compiled_model = step.second;
+            }
+        }
+    }
+    if (!compiled_model)
+        return false;
+    auto& request = worker._ladder_requests[batch_size];
+    if (!request)
+        request = {compiled_model->create_infer_request(), compiled_model._so};
+
+    std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks(num_collected);
+    const auto start = std::chrono::steady_clock::now();
+    double queue_delay = 0.0;
+    for (int n = 0; n < num_collected; n++) {
+        OPENVINO_ASSERT(worker._tasks.try_pop(tasks[n]));
+        tasks[n].first->m_sync_request->copy_inputs_to(request, n, batch_size);
+        queue_delay +=
+            std::chrono::duration<double, std::milli>(start - tasks[n].first->m_sync_request->m_enqueue_time).count();
+    }
+    {
+        std::lock_guard<std::mutex> lock(worker._stats_mutex);
+        BatchingStatistics::accumulate(worker._stats._queue_delay, queue_delay / num_collected);
+        BatchingStatistics::accumulate(worker._stats._executed_batch_size, num_collected);
+    }
+    std::exception_ptr exception;
+    try {
+        request->infer();
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    for (int n = 0; n < num_collected; n++) {
+        auto& sync_request = tasks[n].first->m_sync_request;
+        if (exception)
+            sync_request->m_exception_ptr = exception;
+        else
+            sync_request->copy_outputs_from(request, n, batch_size);
+        // the outputs are already in place, so the request is completed as the non-batched one
+        sync_request->m_batched_request_status =
+            ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+        tasks[n].second();
+    }
+    return true;
+}
+
+void CompiledModel::compile_batch_ladder(
+    const std::function<ov::SoPtr<ov::ICompiledModel>(size_t)>& compile_with_batch) {
+    m_ladder_thread = std::thread([this, compile_with_batch] {
+        for (size_t batch_size = 2; batch_size < m_device_info.device_batch_size && !m_terminate; batch_size *= 2) {
+            ov::SoPtr<ov::ICompiledModel> compiled_model;
+            try {
+                compiled_model = compile_with_batch(batch_size);
+            } catch (const ov::Exception&) {
+                // the partial batches are dispatched to the other batch sizes
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(m_ladder_mutex);
+            m_ladder.emplace_back(static_cast<int>(batch_size), compiled_model);
+        }
+    });
+}
+
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     ov::SoPtr<ov::IAsyncInferRequest> infer_request_without_batch = {
         m_compiled_model_without_batch->create_infer_request(),
@@ -163,11 +342,16 @@ void CompiledModel::set_property(const ov::AnyMap& properties) {
         if (property.first == ov::auto_batch_timeout.name()) {
             m_time_out = property.second.as<std::uint32_t>();
             m_config[ov::auto_batch_timeout.name()] = property.second.as<std::uint32_t>();
+        } else if (property.first == ov::auto_batch_adaptive_timeout.name()) {
+            m_adaptive_time_out = property.second.as<bool>();
+            m_config[ov::auto_batch_adaptive_timeout.name()] = property.second.as<bool>();
         } else {
             OPENVINO_THROW("AutoBatching Compiled Model dosen't support property",
                            property.first,
-                           ". The only property that can be changed on the fly is the ",
-                           ov::auto_batch_timeout.name());
+                           ". The only properties that can be changed on the fly are the ",
+                           ov::auto_batch_timeout.name(),
+                           " and the ",
+                           ov::auto_batch_adaptive_timeout.name());
         }
     }
 }
@@ -204,10 +388,32 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_adaptive_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_ladder.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{ov::auto_batch_executed_batch_size.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{ov::auto_batch_queue_delay.name(), ov::PropertyMutability::RO}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == ov::auto_batch_adaptive_timeout) {
+            bool adaptive_time_out = m_adaptive_time_out;
+            return adaptive_time_out;
+        } else if (name == ov::auto_batch_executed_batch_size || name == ov::auto_batch_queue_delay) {
+            // averaged over the batched requests of the compiled model
+            double sum = 0.0;
+            size_t count = 0;
+            std::lock_guard<std::mutex> lock(m_worker_requests_mutex);
+            for (const auto& worker : m_worker_requests) {
+                std::lock_guard<std::mutex> stats_lock(worker->_stats_mutex);
+                const auto value = name == ov::auto_batch_executed_batch_size ? worker->_stats._executed_batch_size
+                                                                              : worker->_stats._queue_delay;
+                if (value > 0.0) {
+                    sum += value;
+                    count++;
+                }
+            }
+            return static_cast<float>(count ? sum / count : 0.0);
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
@@ -5,7 +5,9 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <thread>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
@@ -20,9 +22,28 @@ class AsyncInferRequest;
 
 class CompiledModel : public ov::ICompiledModel {
 public:
+    // running averages used by the adaptive batching policy, the times are in ms
+    struct BatchingStatistics {
+        static void accumulate(double& average, double value) {
+            average = average == 0.0 ? value : average + (value - average) / 8;
+        }
+        void on_arrival(std::chrono::steady_clock::time_point now) {
+            if (_last_arrival != std::chrono::steady_clock::time_point{})
+                accumulate(_arrival_interval, std::chrono::duration<double, std::milli>(now - _last_arrival).count());
+            _last_arrival = now;
+        }
+        double _arrival_interval = 0.0;
+        double _batch_execution = 0.0;
+        double _batch1_execution = 0.0;  // per request, when executed without batching
+        double _executed_batch_size = 0.0;
+        double _queue_delay = 0.0;
+        std::chrono::steady_clock::time_point _last_arrival;
+    };
+
     struct WorkerInferRequest {
         ov::SoPtr<ov::IAsyncInferRequest> _infer_request_batched;
         int _batch_size;
+        int _num_batched = 0;  // number of the requests in the executed batch, less than _batch_size when padded
         ov::threading::ThreadSafeQueueWithSize<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
             _tasks;
         std::vector<ov::threading::Task> _completion_tasks;
@@ -30,6 +51,13 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
+        BatchingStatistics _stats;
+        std::mutex _stats_mutex;
+        std::chrono::steady_clock::time_point _batch_start;
+        // outputs of the padded batches, so the slices of the requests which are not in the batch are intact
+        std::vector<std::pair<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>>> _padding_outputs;
+        // requests of the smaller batch sizes (created on the first use), the key is the batch size
+        std::map<int, ov::SoPtr<ov::IAsyncInferRequest>> _ladder_requests;
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -58,6 +86,9 @@ public:
 
     const std::vector<ov::Output<const ov::Node>>& inputs() const override;
 
+    // compiles the smaller batch sizes (powers of 2 below the device batch size) in the background
+    void compile_batch_ladder(const std::function<ov::SoPtr<ov::ICompiledModel>(size_t)>& compile_with_batch);
+
 protected:
     std::shared_ptr<ov::ISyncInferRequest> create_sync_infer_request() const override;
     static unsigned int ParseTimeoutValue(const std::string&);
@@ -72,12 +103,22 @@ protected:
 
     mutable std::atomic_size_t m_num_requests_created = {0};
     std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    std::atomic_bool m_adaptive_time_out = {false};
+
+    std::chrono::microseconds get_batch_time_out(WorkerInferRequest& worker, int num_collected) const;
+    bool execute_padded_batch(WorkerInferRequest& worker, int num_collected) const;
+    // executes the collected requests with the closest batch size of the ladder, returns false if none is compiled yet
+    bool execute_ladder_batch(WorkerInferRequest& worker, int num_collected) const;
 
     const std::set<std::string> m_batched_inputs;
     const std::set<std::string> m_batched_outputs;
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+
+    std::vector<std::pair<int, ov::SoPtr<ov::ICompiledModel>>> m_ladder;
+    mutable std::mutex m_ladder_mutex;
+    std::thread m_ladder_thread;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
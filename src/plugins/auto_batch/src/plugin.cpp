@@ -19,7 +19,10 @@
 namespace ov {
 namespace autobatch_plugin {
 
-std::vector<std::string> supported_configKeys = {ov::device::priorities.name(), ov::auto_batch_timeout.name()};
+std::vector<std::string> supported_configKeys = {ov::device::priorities.name(),
+                                                 ov::auto_batch_timeout.name(),
+                                                 ov::auto_batch_adaptive_timeout.name(),
+                                                 ov::auto_batch_ladder.name()};
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
     for (auto&& kvp : user_config) {
@@ -111,6 +114,8 @@ OV_DEFINE_PLUGIN_CREATE_FUNCTION(Plugin, version)
 Plugin::Plugin() {
     set_device_name("BATCH");
     m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_adaptive_timeout(false));
+    m_plugin_config.insert(ov::auto_batch_ladder(false));
 }
 
 std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
@@ -239,6 +244,22 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         return footprint;
     };
 
+    const bool enable_ladder = full_properties.count(ov::auto_batch_ladder.name()) &&
+                               full_properties.at(ov::auto_batch_ladder.name()).as<bool>() &&
+                               meta_device.device_batch_size > 2;
+    if (enable_ladder) {
+        // the models of the ladder share the constant weights, if the device supports that
+        try {
+            auto internal_properties = core->get_property(device_name, ov::internal::supported_properties);
+            if (std::count(internal_properties.begin(), internal_properties.end(), ov::internal::weights_sharing_id)) {
+                static std::atomic_size_t num_ladders = {0};
+                device_config_no_auto_batch[ov::internal::weights_sharing_id.name()] =
+                    "AUTO_BATCH_" + std::to_string(num_ladders++);
+            }
+        } catch (const ov::Exception&) {
+        }
+    }
+
     size_t batch1_footprint = 0;
     if (device_name.find("GPU") != std::string::npos)
         batch1_footprint = report_footprint(core, device_name);
@@ -261,24 +282,27 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), c.first))
             compiled_model_config.insert(c);
     }
+    auto compile_with_batch = [core, model, batched_inputs, device_name, device_config_no_auto_batch, context](
+                                  size_t batch_size) {
+        auto reshaped = model->clone();
+        auto inputs = reshaped->inputs();
+        std::map<ov::Output<ov::Node>, ov::PartialShape> partial_shapes;
+        for (auto& input : inputs) {
+            auto input_shape = input.get_shape();
+            if (batched_inputs.find(ov::op::util::get_ie_output_name(input)) != batched_inputs.end()) {
+                input_shape[0] = batch_size;
+            }
+            partial_shapes.insert({input, ov::PartialShape(input_shape)});
+        }
+
+        reshaped->reshape(partial_shapes);
+        return context ? core->compile_model(reshaped, context, device_config_no_auto_batch)
+                       : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+    };
     ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
-    auto reshaped = model->clone();
     if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
         try {
-            auto inputs = reshaped->inputs();
-            std::map<ov::Output<ov::Node>, ov::PartialShape> partial_shapes;
-            for (auto& input : inputs) {
-                auto input_shape = input.get_shape();
-                if (batched_inputs.find(ov::op::util::get_ie_output_name(input)) != batched_inputs.end()) {
-                    input_shape[0] = meta_device.device_batch_size;
-                }
-                partial_shapes.insert({input, ov::PartialShape(input_shape)});
-            }
-
-            reshaped->reshape(partial_shapes);
-            compiled_model_with_batch = context
-                                            ? core->compile_model(reshaped, context, device_config_no_auto_batch)
-                                            : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+            compiled_model_with_batch = compile_with_batch(meta_device.device_batch_size);
         } catch (const ov::Exception&) {
             meta_device.device_batch_size = 1;
         }
@@ -296,15 +320,18 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         device_context = context;
     }
 
-    return std::make_shared<CompiledModel>(model->clone(),
-                                           shared_from_this(),
-                                           compiled_model_config,
-                                           meta_device,
-                                           batched_inputs,
-                                           batched_outputs,
-                                           compiled_model_with_batch,
-                                           compiled_model_without_batch,
-                                           device_context);
+    auto compiled_model = std::make_shared<CompiledModel>(model->clone(),
+                                                          shared_from_this(),
+                                                          compiled_model_config,
+                                                          meta_device,
+                                                          batched_inputs,
+                                                          batched_outputs,
+                                                          compiled_model_with_batch,
+                                                          compiled_model_without_batch,
+                                                          device_context);
+    if (enable_ladder && compiled_model_with_batch && meta_device.device_batch_size > 2)
+        compiled_model->compile_batch_ladder(compile_with_batch);
+    return compiled_model;
 }
 
 ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
@@ -27,6 +27,11 @@ public:
 
     void copy_outputs_if_needed();
 
+    // copies the data to / from the batch_id slot of the request of another (smaller) batch size
+    void copy_inputs_to(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id, size_t batch_size);
+
+    void copy_outputs_from(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id, size_t batch_size);
+
     void infer() override;
 
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
@@ -37,6 +42,9 @@ public:
 
     std::exception_ptr m_exception_ptr;
 
+    // the time the request was queued for the batched execution
+    std::chrono::steady_clock::time_point m_enqueue_time;
+
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
@@ -46,7 +54,11 @@ public:
     size_t get_batch_size() const;
 
 protected:
-    void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src, ov::SoPtr<ov::ITensor>& dst, const bool bInput);
+    void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
+                               ov::SoPtr<ov::ITensor>& dst,
+                               const bool bInput,
+                               size_t batch_id,
+                               size_t batch_size);
 
     void share_tensors_with_batched_req(const std::set<std::string>& batched_inputs,
                                         const std::set<std::string>& batched_outputs);
@@ -31,6 +31,15 @@ INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_test,
                                             ::testing::ValuesIn(num_batch)),
                          AutoBatching_Test_DetectionOutput::getTestCaseName);
 
+// the number of the requests is less than the batch size
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_test,
+                         AutoBatching_Test_PartialBatch,
+                         ::testing::Combine(::testing::Values(ov::test::utils::DEVICE_TEMPLATE),
+                                            ::testing::Values(2, 3),
+                                            ::testing::Values(4, 8),
+                                            ::testing::Values(false, true)),
+                         AutoBatching_Test_PartialBatch::getTestCaseName);
+
 const std::vector<ov::AnyMap> default_properties = {
     {ov::auto_batch_timeout(1000)},
 };
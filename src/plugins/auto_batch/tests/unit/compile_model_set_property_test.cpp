@@ -104,6 +104,7 @@ TEST_P(CompileModelSetPropertyTest, CompileModelSetPropertyTestCase) {
 
 const std::vector<set_property_param> compile_model_set_property_param_test = {
     set_property_param{{{ov::auto_batch_timeout(static_cast<uint32_t>(100))}}, false},
+    set_property_param{{{ov::auto_batch_adaptive_timeout(true)}}, false},
     set_property_param{{{"INCORRECT_CONFIG", 2}}, true},
 };
 
@@ -10,6 +10,8 @@
 #include "graph_debug_dump.hpp"
 #include "itt.hpp"
 #include "op/device_subgraph.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/pass/manager.hpp"
@@ -20,6 +22,31 @@
 #include "plugin.hpp"
 #include "properties.hpp"
 
+namespace {
+// Creates the port of the whole batch for the port of the submodel compiled for a single micro-batch
+ov::Output<const ov::Node> make_batched_port(const ov::Output<const ov::Node>& port,
+                                             size_t micro_batches,
+                                             bool is_input) {
+    auto shape = port.get_partial_shape();
+    OPENVINO_ASSERT(shape.rank().is_static() && shape.size() > 0 && shape[0].is_static(),
+                    "The batch of the port ",
+                    port,
+                    " is not static");
+    shape[0] = shape[0].get_length() * micro_batches;
+    auto param = std::make_shared<ov::op::v0::Parameter>(port.get_element_type(), shape);
+    if (is_input) {
+        param->set_friendly_name(port.get_node()->get_friendly_name());
+        param->output(0).get_tensor().set_names(port.get_names());
+        return param->output(0);
+    }
+    param->set_friendly_name(port.get_node()->input_value(0).get_node()->get_friendly_name());
+    auto result = std::make_shared<ov::op::v0::Result>(param);
+    result->set_friendly_name(port.get_node()->get_friendly_name());
+    result->output(0).get_tensor().set_names(port.get_names());
+    return result->output(0);
+}
+}  // namespace
+
 ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                                          const std::shared_ptr<const ov::IPlugin>& plugin,
                                          const Configuration& cfg)
@@ -45,6 +72,46 @@ void ov::hetero::CompiledModel::compile_model(const std::shared_ptr<ov::Model>&
     manager.register_pass<ov::pass::ConstantFolding>();
     manager.run_passes(model);
 
+    if (m_cfg.micro_batches > 1) {
+        // the submodels are compiled for a single micro-batch, the infer request splits the user tensors
+        OPENVINO_ASSERT(model->get_sinks().empty() && model->get_variables().empty(),
+                        "Pipelined execution by micro-batches is not supported for the stateful models");
+        std::map<ov::Output<ov::Node>, ov::PartialShape> micro_batch_shapes;
+        for (const auto& param : model->get_parameters()) {
+            auto shape = param->get_partial_shape();
+            OPENVINO_ASSERT(shape.rank().is_static() && shape.size() > 0 && shape[0].is_static() &&
+                                shape[0].get_length() % m_cfg.micro_batches == 0,
+                            "The batch of the input ",
+                            param->get_friendly_name(),
+                            " ",
+                            shape,
+                            " is not divisible by the number of micro-batches ",
+                            m_cfg.micro_batches);
+            shape[0] = shape[0].get_length() / m_cfg.micro_batches;
+            micro_batch_shapes[param->output(0)] = shape;
+        }
+        // the outputs are concatenated from the micro-batches along the first dimension, so it must be the batch
+        auto output_batch = [](const std::shared_ptr<ov::op::v0::Result>& result) -> int64_t {
+            const auto& shape = result->get_input_partial_shape(0);
+            return shape.rank().is_static() && shape.size() > 0 && shape[0].is_static() ? shape[0].get_length() : -1;
+        };
+        std::vector<int64_t> output_batches;
+        for (const auto& result : model->get_results()) {
+            output_batches.push_back(output_batch(result));
+        }
+        model->reshape(micro_batch_shapes);
+        for (size_t i = 0; i < output_batches.size(); i++) {
+            const auto& result = model->get_results()[i];
+            const auto micro_batch = output_batch(result);
+            OPENVINO_ASSERT(output_batches[i] >= 0 && micro_batch >= 0 &&
+                                output_batches[i] == micro_batch * static_cast<int64_t>(m_cfg.micro_batches),
+                            "Pipelined execution by micro-batches is not supported for the model: the first dimension "
+                            "of the output ",
+                            result->get_friendly_name(),
+                            " is not the batch");
+        }
+    }
+
     ov::SupportedOpsMap query_model_result;
     bool user_set_affinities = false;
     // Get user defined affinity
@@ -284,6 +351,7 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
         add_ro_properties(ov::supported_properties.name(), supported_properties);
         add_ro_properties(ov::device::properties.name(), supported_properties);
         add_ro_properties(ov::device::priorities.name(), supported_properties);
+        add_ro_properties(ov::hetero::micro_batches.name(), supported_properties);
         return decltype(ov::supported_properties)::value_type(supported_properties);
     } else if (ov::device::properties == name) {
         ov::AnyMap all_devices = {};
@@ -348,7 +416,9 @@ void ov::hetero::CompiledModel::set_inputs_and_outputs() {
                         "Submodel " + std::to_string(submodel_idx) + " has " +
                             std::to_string(compiled_submodel->inputs().size()) +
                             " inputs. Index is out of range: " + std::to_string(input_idx));
-        m_compiled_inputs.emplace_back(compiled_submodel->inputs()[input_idx]);
+        const auto& input = compiled_submodel->inputs()[input_idx];
+        m_compiled_inputs.emplace_back(m_cfg.micro_batches > 1 ? make_batched_port(input, m_cfg.micro_batches, true)
+                                                                : input);
     }
     m_compiled_outputs.reserve(m_mapping_info._outputs_to_submodels_outputs.size());
     for (const auto& it : m_mapping_info._outputs_to_submodels_outputs) {
@@ -362,7 +432,9 @@ void ov::hetero::CompiledModel::set_inputs_and_outputs() {
                         "Submodel " + std::to_string(submodel_idx) + " has " +
                             std::to_string(compiled_submodel->outputs().size()) +
                             " outputs. Index is out of range: " + std::to_string(output_idx));
-        m_compiled_outputs.emplace_back(compiled_submodel->outputs()[output_idx]);
+        const auto& output = compiled_submodel->outputs()[output_idx];
+        m_compiled_outputs.emplace_back(m_cfg.micro_batches > 1 ? make_batched_port(output, m_cfg.micro_batches, false)
+                                                                 : output);
     }
 }
 
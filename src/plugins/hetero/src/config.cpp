@@ -6,6 +6,7 @@
 
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "properties.hpp"
 
 using namespace ov::hetero;
 
@@ -20,6 +21,9 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
 
         if (ov::device::priorities == key) {
             device_priorities = value.as<std::string>();
+        } else if (ov::hetero::micro_batches == key) {
+            micro_batches = value.as<size_t>();
+            OPENVINO_ASSERT(micro_batches > 0, "Wrong value of ", key, ", it must be greater than 0");
         } else {
             if (throwOnUnsupported)
                 OPENVINO_THROW("Property was not found: ", key);
@@ -31,18 +35,20 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
 ov::Any Configuration::get(const std::string& name) const {
     if (name == ov::device::priorities) {
         return {device_priorities};
+    } else if (name == ov::hetero::micro_batches) {
+        return {micro_batches};
     } else {
         OPENVINO_THROW("Property was not found: ", name);
     }
 }
 
 std::vector<ov::PropertyName> Configuration::get_supported() const {
-    static const std::vector<ov::PropertyName> names = {ov::device::priorities};
+    static const std::vector<ov::PropertyName> names = {ov::device::priorities, ov::hetero::micro_batches};
     return names;
 }
 
 ov::AnyMap Configuration::get_hetero_properties() const {
-    return {{ov::device::priorities.name(), device_priorities}};
+    return {{ov::device::priorities.name(), device_priorities}, {ov::hetero::micro_batches.name(), micro_batches}};
 }
 
 ov::AnyMap Configuration::get_device_properties() const {
@@ -34,6 +34,7 @@ struct Configuration {
     bool dump_dot_files() const;
 
     std::string device_priorities;
+    size_t micro_batches = 1;
     ov::AnyMap device_properties;
 };
 }  // namespace hetero
@@ -145,7 +145,7 @@ ov::Any ov::hetero::Plugin::get_property(const std::string& name, const ov::AnyM
         return ro_properties;
     };
     const auto& default_rw_properties = []() {
-        std::vector<ov::PropertyName> rw_properties{ov::device::priorities};
+        std::vector<ov::PropertyName> rw_properties{ov::device::priorities, ov::hetero::micro_batches};
         return rw_properties;
     };
 
@@ -18,5 +18,14 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
 
+/**
+ * @brief The number of micro-batches an infer request is split into along the batch (first) dimension.
+ * The micro-batches flow through the chain of the submodels concurrently, so while a submodel processes one
+ * micro-batch the next submodel processes the previous one. The batch of every input must be divisible by the value,
+ * and the first dimension of every output must be the batch. The profiling info sums the time of all the micro-batches.
+ * The default value 1 disables the pipelining.
+ */
+static constexpr Property<size_t, PropertyMutability::RW> micro_batches{"HETERO_MICRO_BATCHES"};
+
 }  // namespace hetero
 }  // namespace ov
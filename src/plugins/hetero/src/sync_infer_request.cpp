@@ -5,6 +5,7 @@
 #include "sync_infer_request.hpp"
 
 #include <algorithm>
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
@@ -13,14 +14,15 @@
 #include "compiled_model.hpp"
 #include "itt.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "plugin.hpp"
 
 ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::CompiledModel>& compiled_model)
     : ov::ISyncInferRequest(compiled_model) {
-    for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
-        auto& comp_model = comp_model_desc.compiled_model;
-        m_subrequests.push_back({comp_model->create_infer_request(), comp_model._so});
+    for (size_t i = 0; i < compiled_model->m_cfg.micro_batches; i++) {
+        m_micro_batch_subrequests.emplace_back(create_subrequests(compiled_model));
     }
+    m_subrequests = m_micro_batch_subrequests.front();
 
     for (size_t i = 0; i < compiled_model->inputs().size(); i++) {
         const auto& port = compiled_model->inputs()[i];
@@ -33,21 +35,55 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
         m_port_to_subrequest_idx[port] = submodel_idx;
     }
 
+    if (is_pipelined()) {
+        for (const auto& port : get_inputs()) {
+            m_batched_tensors[port] = {ov::make_tensor(port.get_element_type(), port.get_shape()), nullptr};
+        }
+        for (const auto& port : get_outputs()) {
+            m_batched_tensors[port] = {ov::make_tensor(port.get_element_type(), port.get_shape()), nullptr};
+        }
+        for (size_t micro_batch = 0; micro_batch < m_micro_batch_subrequests.size(); micro_batch++) {
+            for (size_t stage = 0; stage < m_micro_batch_subrequests[micro_batch].size(); stage++) {
+                m_micro_batch_subrequests[micro_batch][stage]->set_callback(
+                    [this, micro_batch, stage](std::exception_ptr exception_ptr) {
+                        on_micro_batch_done(micro_batch, stage, std::move(exception_ptr));
+                    });
+            }
+        }
+    }
+}
+
+std::vector<ov::SoPtr<ov::IAsyncInferRequest>> ov::hetero::InferRequest::create_subrequests(
+    const std::shared_ptr<const ov::hetero::CompiledModel>& compiled_model) const {
+    std::vector<ov::SoPtr<ov::IAsyncInferRequest>> subrequests;
+    for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
+        auto& comp_model = comp_model_desc.compiled_model;
+        subrequests.push_back({comp_model->create_infer_request(), comp_model._so});
+    }
+
     for (const auto& kvp : compiled_model->m_mapping_info._submodels_input_to_prev_output) {
         const auto& submodel_idx_in = kvp.first.first;
         const auto& port_idx_in = kvp.first.second;
         const auto& submodel_idx_out = kvp.second.first;
         const auto& port_idx_out = kvp.second.second;
 
-        const auto& output_port = m_subrequests[submodel_idx_out]->get_compiled_model()->outputs()[port_idx_out];
-        const auto& output_tensor = m_subrequests[submodel_idx_out]->get_tensor(output_port);
-        const auto& input_port = m_subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
-        m_subrequests[submodel_idx_in]->set_tensor(input_port, output_tensor);
+        const auto& output_port = subrequests[submodel_idx_out]->get_compiled_model()->outputs()[port_idx_out];
+        const auto& output_tensor = subrequests[submodel_idx_out]->get_tensor(output_port);
+        const auto& input_port = subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
+        subrequests[submodel_idx_in]->set_tensor(input_port, output_tensor);
     }
+    return subrequests;
 }
 
 ov::hetero::InferRequest::~InferRequest() = default;
 
+const ov::Output<const ov::Node>& ov::hetero::InferRequest::get_internal_port(
+    const ov::Output<const ov::Node>& port) const {
+    auto found_port = find_port(port);
+    OPENVINO_ASSERT(found_port.found(), "Cannot find tensor for port ", port);
+    return found_port.is_input() ? get_inputs().at(found_port.idx) : get_outputs().at(found_port.idx);
+}
+
 ov::SoPtr<ov::IAsyncInferRequest> ov::hetero::InferRequest::get_request(const ov::Output<const ov::Node>& port) const {
     auto found_port = find_port(port);
     ov::Output<const ov::Node> internal_port;
@@ -61,6 +97,9 @@ ov::SoPtr<ov::IAsyncInferRequest> ov::hetero::InferRequest::get_request(const ov
 }
 
 ov::SoPtr<ov::ITensor> ov::hetero::InferRequest::get_tensor(const ov::Output<const ov::Node>& port) const {
+    if (is_pipelined()) {
+        return m_batched_tensors.at(get_internal_port(port));
+    }
     const auto infer_request = get_request(port);
     auto tensor = infer_request->get_tensor(port);
     if (!tensor._so) {
@@ -71,11 +110,20 @@ ov::SoPtr<ov::ITensor> ov::hetero::InferRequest::get_tensor(const ov::Output<con
 
 void ov::hetero::InferRequest::set_tensor(const ov::Output<const ov::Node>& port,
                                           const ov::SoPtr<ov::ITensor>& tensor) {
+    if (is_pipelined()) {
+        check_tensor(port, tensor);
+        m_batched_tensors.at(get_internal_port(port)) = tensor;
+        m_micro_batch_tensors_set = false;
+        return;
+    }
     get_request(port)->set_tensor(port, tensor);
 }
 
 std::vector<ov::SoPtr<ov::ITensor>> ov::hetero::InferRequest::get_tensors(
     const ov::Output<const ov::Node>& port) const {
+    if (is_pipelined()) {
+        return {get_tensor(port)};
+    }
     const auto infer_request = get_request(port);
     auto tensors = infer_request->get_tensors(port);
     for (auto& tensor : tensors) {
@@ -88,6 +136,11 @@ std::vector<ov::SoPtr<ov::ITensor>> ov::hetero::InferRequest::get_tensors(
 
 void ov::hetero::InferRequest::set_tensors(const ov::Output<const ov::Node>& port,
                                            const std::vector<ov::SoPtr<ov::ITensor>>& tensors) {
+    OPENVINO_ASSERT(!is_pipelined() || tensors.size() == 1,
+                    "Batched tensors are not supported with the pipelined execution by micro-batches");
+    if (is_pipelined()) {
+        return set_tensor(port, tensors.front());
+    }
     return get_request(port)->set_tensors(port, tensors);
 }
 
@@ -111,16 +164,157 @@ std::vector<ov::SoPtr<ov::IVariableState>> ov::hetero::InferRequest::query_state
 }
 
 void ov::hetero::InferRequest::infer() {
+    if (is_pipelined()) {
+        std::promise<void> promise;
+        auto future = promise.get_future();
+        infer_micro_batches([&promise](std::exception_ptr exception_ptr) {
+            if (exception_ptr) {
+                promise.set_exception(exception_ptr);
+            } else {
+                promise.set_value();
+            }
+        });
+        future.get();
+        return;
+    }
     for (auto&& request : m_subrequests) {
         OPENVINO_ASSERT(request);
         request->infer();
     }
 }
 
+void ov::hetero::InferRequest::set_micro_batch_tensors() {
+    const auto compiled_model = std::static_pointer_cast<const ov::hetero::CompiledModel>(get_compiled_model());
+    const auto& mapping_info = compiled_model->m_mapping_info;
+    const auto micro_batches = m_micro_batch_subrequests.size();
+    auto set_parts = [&](const ov::Output<const ov::Node>& port,
+                         const ov::hetero::NodeInfo& submodel_port,
+                         bool is_input) {
+        const auto& tensor = m_batched_tensors.at(port);
+        OPENVINO_ASSERT(tensor->is_continuous(), "The tensor of the port ", port, " must be continuous");
+        auto shape = tensor->get_shape();
+        shape[0] /= micro_batches;
+        const auto byte_size = tensor->get_byte_size() / micro_batches;
+        for (size_t micro_batch = 0; micro_batch < micro_batches; micro_batch++) {
+            const auto& request = m_micro_batch_subrequests[micro_batch][submodel_port.first];
+            const auto& submodel = request->get_compiled_model();
+            const auto& request_port =
+                is_input ? submodel->inputs()[submodel_port.second] : submodel->outputs()[submodel_port.second];
+            auto data = static_cast<uint8_t*>(tensor->data()) + micro_batch * byte_size;
+            ov::SoPtr<ov::ITensor> part = {ov::make_tensor(tensor->get_element_type(), shape, data), tensor._so};
+            request->set_tensor(request_port, part);
+            if (is_input)
+                continue;
+            // the output can also be read by the next submodels, they must read the same part instead of the
+            // tensor which was set in create_subrequests
+            for (const auto& kvp : mapping_info._submodels_input_to_prev_output) {
+                if (kvp.second != submodel_port)
+                    continue;
+                const auto& consumer = m_micro_batch_subrequests[micro_batch][kvp.first.first];
+                consumer->set_tensor(consumer->get_compiled_model()->inputs()[kvp.first.second], part);
+            }
+        }
+    };
+    for (size_t i = 0; i < get_inputs().size(); i++) {
+        set_parts(get_inputs()[i], mapping_info._inputs_to_submodels_inputs[i], true);
+    }
+    for (size_t i = 0; i < get_outputs().size(); i++) {
+        set_parts(get_outputs()[i], mapping_info._outputs_to_submodels_outputs[i], false);
+    }
+}
+
+void ov::hetero::InferRequest::infer_micro_batches(std::function<void(std::exception_ptr)> callback) {
+    OPENVINO_ASSERT(is_pipelined());
+    if (!m_micro_batch_tensors_set) {
+        set_micro_batch_tensors();
+        m_micro_batch_tensors_set = true;
+    }
+    std::vector<std::pair<size_t, size_t>> micro_batches;
+    {
+        std::lock_guard<std::mutex> lock(m_pipeline_mutex);
+        m_pipeline_callback = std::move(callback);
+        m_pipeline_exception = nullptr;
+        m_processed_micro_batches = 0;
+        m_stage_queues.assign(m_subrequests.size(), {});
+        m_stage_busy.assign(m_subrequests.size(), false);
+        for (size_t micro_batch = 0; micro_batch < m_micro_batch_subrequests.size(); micro_batch++) {
+            m_stage_queues.front().push_back(micro_batch);
+        }
+        micro_batches = schedule_micro_batches();
+    }
+    start_micro_batches(micro_batches);
+}
+
+std::vector<std::pair<size_t, size_t>> ov::hetero::InferRequest::schedule_micro_batches() {
+    // takes the next micro-batch from the queue of every idle submodel, must be called under m_pipeline_mutex
+    std::vector<std::pair<size_t, size_t>> micro_batches;
+    for (size_t stage = 0; stage < m_stage_queues.size(); stage++) {
+        if (!m_stage_busy[stage] && !m_stage_queues[stage].empty()) {
+            m_stage_busy[stage] = true;
+            micro_batches.emplace_back(m_stage_queues[stage].front(), stage);
+            m_stage_queues[stage].pop_front();
+        }
+    }
+    return micro_batches;
+}
+
+void ov::hetero::InferRequest::start_micro_batches(const std::vector<std::pair<size_t, size_t>>& micro_batches) {
+    for (const auto& micro_batch : micro_batches) {
+        try {
+            m_micro_batch_subrequests[micro_batch.first][micro_batch.second]->start_async();
+        } catch (...) {
+            on_micro_batch_done(micro_batch.first, micro_batch.second, std::current_exception());
+        }
+    }
+}
+
+void ov::hetero::InferRequest::on_micro_batch_done(size_t micro_batch, size_t stage, std::exception_ptr exception) {
+    std::vector<std::pair<size_t, size_t>> micro_batches;
+    std::function<void(std::exception_ptr)> callback;
+    std::exception_ptr pipeline_exception;
+    {
+        std::lock_guard<std::mutex> lock(m_pipeline_mutex);
+        m_stage_busy[stage] = false;
+        if (exception && !m_pipeline_exception) {
+            // the micro-batches which have not been started yet are dropped
+            m_pipeline_exception = std::move(exception);
+            for (auto& queue : m_stage_queues) {
+                m_processed_micro_batches += queue.size();
+                queue.clear();
+            }
+        }
+        if (!m_pipeline_exception && stage + 1 < m_stage_queues.size()) {
+            m_stage_queues[stage + 1].push_back(micro_batch);
+        } else {
+            m_processed_micro_batches++;
+        }
+        micro_batches = schedule_micro_batches();
+        if (m_processed_micro_batches == m_micro_batch_subrequests.size()) {
+            std::swap(callback, m_pipeline_callback);
+            pipeline_exception = m_pipeline_exception;
+        }
+    }
+    start_micro_batches(micro_batches);
+    if (callback) {
+        callback(pipeline_exception);
+    }
+}
+
 std::vector<ov::ProfilingInfo> ov::hetero::InferRequest::get_profiling_info() const {
     std::vector<ov::ProfilingInfo> info;
     for (size_t i = 0; i < m_subrequests.size(); ++i) {
         auto&& subreq_info = m_subrequests[i]->get_profiling_info();
+        // the time of the pipelined execution is summed over the micro-batches, the subrequests of every
+        // micro-batch run the same compiled submodel, so their records are in the same order
+        for (size_t micro_batch = 1; micro_batch < m_micro_batch_subrequests.size(); ++micro_batch) {
+            auto&& micro_batch_info = m_micro_batch_subrequests[micro_batch][i]->get_profiling_info();
+            for (size_t r = 0; r < std::min(subreq_info.size(), micro_batch_info.size()); ++r) {
+                if (micro_batch_info[r].node_name != subreq_info[r].node_name)
+                    continue;
+                subreq_info[r].real_time += micro_batch_info[r].real_time;
+                subreq_info[r].cpu_time += micro_batch_info[r].cpu_time;
+            }
+        }
         for (auto&& rec : subreq_info)
             rec.node_name = std::string("subgraph") + std::to_string(i) + ": " + rec.node_name;
         info.insert(info.end(), subreq_info.begin(), subreq_info.end());
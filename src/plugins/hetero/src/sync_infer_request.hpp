@@ -6,8 +6,11 @@
 
 #include <array>
 #include <chrono>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -45,13 +48,52 @@ public:
 
     void check_tensors() const override;
 
+    /**
+     * @brief Starts the pipelined execution by micro-batches, see ov::hetero::micro_batches.
+     * Every submodel processes one micro-batch at a time, the micro-batches processed by the previous submodel wait
+     * for it in the queue of the submodel.
+     * @param callback Called once all the micro-batches are processed or the execution of any of them failed
+     */
+    void infer_micro_batches(std::function<void(std::exception_ptr)> callback);
+
 private:
     friend class AsyncInferRequest;
 
     ov::SoPtr<ov::IAsyncInferRequest> get_request(const ov::Output<const ov::Node>& port) const;
 
+    std::vector<ov::SoPtr<ov::IAsyncInferRequest>> create_subrequests(
+        const std::shared_ptr<const ov::hetero::CompiledModel>& compiled_model) const;
+
+    bool is_pipelined() const {
+        return m_micro_batch_subrequests.size() > 1;
+    }
+
+    const ov::Output<const ov::Node>& get_internal_port(const ov::Output<const ov::Node>& port) const;
+
+    void set_micro_batch_tensors();
+
+    std::vector<std::pair<size_t, size_t>> schedule_micro_batches();
+
+    void start_micro_batches(const std::vector<std::pair<size_t, size_t>>& micro_batches);
+
+    void on_micro_batch_done(size_t micro_batch, size_t stage, std::exception_ptr exception);
+
     std::vector<ov::SoPtr<ov::IAsyncInferRequest>> m_subrequests;
     std::map<ov::Output<const ov::Node>, size_t> m_port_to_subrequest_idx;
+
+    // The chains of the subrequests, one per micro-batch, m_subrequests is the first one
+    std::vector<std::vector<ov::SoPtr<ov::IAsyncInferRequest>>> m_micro_batch_subrequests;
+    // The tensors of the whole batch, the subrequests use their parts
+    std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>> m_batched_tensors;
+    bool m_micro_batch_tensors_set = false;
+
+    std::mutex m_pipeline_mutex;
+    // The micro-batches waiting for the submodel and whether the submodel processes a micro-batch
+    std::vector<std::deque<size_t>> m_stage_queues;
+    std::vector<bool> m_stage_busy;
+    size_t m_processed_micro_batches = 0;
+    std::exception_ptr m_pipeline_exception;
+    std::function<void(std::exception_ptr)> m_pipeline_callback;
 };
 
 }  // namespace hetero
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include "hetero_tests.hpp"
+#include "openvino/opsets/opset11.hpp"
 #include "openvino/runtime/exec_model_info.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -98,6 +99,80 @@ TEST_F(HeteroTests, compile_with_device_properties_no_exclusive) {
     EXPECT_EQ(6, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
 }
 
+TEST_F(HeteroTests, infer_with_micro_batches) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), {"HETERO_MICRO_BATCHES", "2"}};
+    auto model = create_model_with_subtract(false, 4);
+    auto compiled_model = core.compile_model(model, "HETERO", config);
+    EXPECT_EQ(2, compiled_model.get_property("HETERO_MICRO_BATCHES").as<size_t>());
+    // the inputs and the outputs have the whole batch, the submodels are compiled for a single micro-batch
+    EXPECT_EQ(model->input().get_shape(), compiled_model.input().get_shape());
+    EXPECT_EQ(model->output().get_shape(), compiled_model.output().get_shape());
+
+    auto infer_request = compiled_model.create_infer_request();
+    auto input_tensor =
+        create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape());
+    infer_request.set_input_tensor(input_tensor);
+    infer_request.infer();
+    auto output_tensor = infer_request.get_output_tensor();
+    EXPECT_EQ(input_tensor.get_shape(), output_tensor.get_shape());
+    EXPECT_EQ(memcmp(input_tensor.data(), output_tensor.data(), input_tensor.get_byte_size()), 0);
+
+    memset(output_tensor.data(), 0, output_tensor.get_byte_size());
+    infer_request.start_async();
+    infer_request.wait();
+    EXPECT_EQ(memcmp(input_tensor.data(), output_tensor.data(), input_tensor.get_byte_size()), 0);
+}
+
+TEST_F(HeteroTests, infer_with_micro_batches_and_output_read_by_next_submodel) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), {"HETERO_MICRO_BATCHES", "2"}};
+    // the output of add is both the model output and the input of the submodel with sub
+    auto param = std::make_shared<ov::opset11::Parameter>(ov::element::i64, ov::PartialShape{4, 3, 2, 2});
+    auto const_value = ov::opset11::Constant::create(ov::element::i64, ov::Shape{1, 1, 1, 1}, {1});
+    auto add = std::make_shared<ov::opset11::Add>(param, const_value);
+    auto subtract = std::make_shared<ov::opset11::Subtract>(add, const_value);
+    auto add_result = std::make_shared<ov::opset11::Result>(add);
+    auto sub_result = std::make_shared<ov::opset11::Result>(subtract);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{add_result, sub_result}, ov::ParameterVector{param});
+    auto compiled_model = core.compile_model(model, "HETERO", config);
+
+    auto infer_request = compiled_model.create_infer_request();
+    auto input_tensor =
+        create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape());
+    infer_request.set_input_tensor(input_tensor);
+    for (size_t i = 0; i < 2; i++) {
+        // the output tensors set by the user replace the parts read by the next submodel as well
+        ov::Tensor add_tensor(compiled_model.output(0).get_element_type(), compiled_model.output(0).get_shape());
+        ov::Tensor sub_tensor(compiled_model.output(1).get_element_type(), compiled_model.output(1).get_shape());
+        infer_request.set_output_tensor(0, add_tensor);
+        infer_request.set_output_tensor(1, sub_tensor);
+        infer_request.infer();
+
+        auto input = input_tensor.data<int64_t>();
+        auto add_output = add_tensor.data<int64_t>();
+        for (size_t j = 0; j < input_tensor.get_size(); j++) {
+            ASSERT_EQ(input[j] + 1, add_output[j]);
+        }
+        EXPECT_EQ(memcmp(input_tensor.data(), sub_tensor.data(), input_tensor.get_byte_size()), 0);
+    }
+}
+
+TEST_F(HeteroTests, compile_with_indivisible_micro_batches_throw) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), {"HETERO_MICRO_BATCHES", "3"}};
+    auto model = create_model_with_subtract(false, 4);
+    EXPECT_THROW(core.compile_model(model, "HETERO", config), ov::Exception);
+}
+
+TEST_F(HeteroTests, compile_with_micro_batches_and_not_batched_output_throw) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), {"HETERO_MICRO_BATCHES", "2"}};
+    // the output [3, 16] can't be concatenated from the micro-batch outputs [3, 8]
+    auto param = std::make_shared<ov::opset11::Parameter>(ov::element::i64, ov::PartialShape{4, 3, 2, 2});
+    auto reshape_val = ov::opset11::Constant::create(ov::element::i64, ov::Shape{2}, {3, -1});
+    auto reshape = std::make_shared<ov::opset11::Reshape>(param, reshape_val, false);
+    auto result = std::make_shared<ov::opset11::Result>(reshape);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+    EXPECT_THROW(core.compile_model(model, "HETERO", config), ov::Exception);
+}
+
 TEST_F(HeteroTests, get_runtime_model) {
     ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1")};
     auto model = create_model_with_subtract_reshape();
@@ -69,8 +69,8 @@ ov::Tensor ov::hetero::tests::HeteroTests::create_and_fill_tensor(const ov::elem
     OPENVINO_THROW("Cannot generate tensor. Unsupported element type.");
 }
 
-std::shared_ptr<ov::Model> ov::hetero::tests::HeteroTests::create_model_with_subtract(bool dynamic) {
-    int64_t bs = dynamic ? -1 : 1;
+std::shared_ptr<ov::Model> ov::hetero::tests::HeteroTests::create_model_with_subtract(bool dynamic, int64_t batch) {
+    int64_t bs = dynamic ? -1 : batch;
     auto param = std::make_shared<ov::opset11::Parameter>(ov::element::i64, ov::PartialShape{bs, 3, 2, 2});
     param->set_friendly_name("input");
     auto const_value = ov::opset11::Constant::create(ov::element::i64, ov::Shape{1, 1, 1, 1}, {1});
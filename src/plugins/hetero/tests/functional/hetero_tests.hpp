@@ -20,7 +20,7 @@ public:
 
     void SetUp() override;
 
-    std::shared_ptr<ov::Model> create_model_with_subtract(bool dynamic = false);
+    std::shared_ptr<ov::Model> create_model_with_subtract(bool dynamic = false, int64_t batch = 1);
     std::shared_ptr<ov::Model> create_model_with_subtract_reshape(bool dynamic = false);
     std::shared_ptr<ov::Model> create_model_with_subtract_reshape_relu(bool dynamic = false);
     std::shared_ptr<ov::Model> create_model_with_reshape(bool dynamic = false);
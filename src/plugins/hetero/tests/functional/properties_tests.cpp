@@ -10,7 +10,8 @@ TEST_F(HeteroTests, get_property_supported_properties) {
     const std::vector<ov::PropertyName> supported_properties = {ov::supported_properties,
                                                                 ov::device::full_name,
                                                                 ov::device::capabilities,
-                                                                ov::device::priorities};
+                                                                ov::device::priorities,
+                                                                ov::PropertyName("HETERO_MICRO_BATCHES")};
     auto actual_supported_properties = core.get_property("HETERO", ov::supported_properties);
     EXPECT_EQ(supported_properties.size(), actual_supported_properties.size());
     for (auto& supported_property : supported_properties) {
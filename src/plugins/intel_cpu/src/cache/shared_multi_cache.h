@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+#include "multi_cache.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Thread safe MultiCache shared by the graphs of all the streams which run on the same socket.
+ * The first graph which needs a value creates it, the graphs of the other streams reuse it, so e.g. the code is
+ * generated once per socket instead of once per stream.
+ *
+ * @attention The values are used by several streams concurrently, so only the values which are never modified after
+ * the creation (like generated code) may be stored. The builder is called without the lock, the values of different
+ * keys are created in parallel, while the concurrent requests of a value being created wait for it.
+ */
+
+class SharedMultiCache {
+public:
+    /**
+    * @param capacity maximum records limit for each entry specified by a pair of Key/Value types, see MultiCache
+    */
+    explicit SharedMultiCache(size_t capacity) : _cache(capacity) {}
+
+    template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
+    typename CacheEntry<KeyType, ValueType>::ResultType
+    getOrCreate(const KeyType& key, BuilderType builder) {
+        std::shared_ptr<std::promise<ValueType>> promise;
+        std::shared_future<ValueType> future;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            // the builder returning the empty value only looks the value up, since the empty values aren't stored
+            auto result = _cache.getOrCreate(key, [](const KeyType&) {
+                return ValueType();
+            });
+            if (result.first != ValueType())
+                return result;
+
+            auto& inFlight = getInFlight<KeyType, ValueType>();
+            auto itr = inFlight.find(key);
+            if (itr != inFlight.end()) {
+                future = itr->second;
+            } else {
+                promise = std::make_shared<std::promise<ValueType>>();
+                inFlight.emplace(key, promise->get_future().share());
+            }
+        }
+
+        if (!promise) {
+            // another stream is creating the value
+            return {future.get(), CacheEntryBase::LookUpStatus::Hit};
+        }
+
+        _createdNumber++;
+        ValueType value;
+        try {
+            value = builder(key);
+        } catch (...) {
+            finishCreation<KeyType, ValueType>(key, nullptr);
+            promise->set_exception(std::current_exception());
+            throw;
+        }
+        finishCreation<KeyType, ValueType>(key, &value);
+        promise->set_value(value);
+        return {value, CacheEntryBase::LookUpStatus::Miss};
+    }
+
+    /**
+    * @return the number of the values created by the cache, e.g. the number of the generated kernels
+    */
+    size_t getCreatedNumber() const {
+        return _createdNumber;
+    }
+
+private:
+    template<typename KeyType>
+    struct KeyHasher {
+        size_t operator()(const KeyType& key) const {
+            return key.hash();
+        }
+    };
+
+    template<typename KeyType, typename ValueType>
+    using InFlightMap = std::unordered_map<KeyType, std::shared_future<ValueType>, KeyHasher<KeyType>>;
+
+    // the values being created, the map of each Key/Value types pair is created on the first request
+    template<typename KeyType, typename ValueType>
+    InFlightMap<KeyType, ValueType>& getInFlight() {
+        auto& map = _inFlight[std::type_index(typeid(InFlightMap<KeyType, ValueType>))];
+        if (!map)
+            map = std::make_shared<InFlightMap<KeyType, ValueType>>();
+        return *std::static_pointer_cast<InFlightMap<KeyType, ValueType>>(map);
+    }
+
+    // stores the created value (if any) and removes the key from the values being created
+    template<typename KeyType, typename ValueType>
+    void finishCreation(const KeyType& key, const ValueType* value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (value) {
+            _cache.getOrCreate(key, [value](const KeyType&) {
+                return *value;
+            });
+        }
+        getInFlight<KeyType, ValueType>().erase(key);
+    }
+
+    std::mutex _mutex;
+    MultiCache _cache;
+    std::unordered_map<std::type_index, std::shared_ptr<void>> _inFlight;
+    std::atomic_size_t _createdNumber{0};
+};
+
+using SharedMultiCachePtr = std::shared_ptr<SharedMultiCache>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -8,6 +8,7 @@
 #include "itt.h"
 #include "low_precision/low_precision.hpp"
 #include "memory_state.h"
+#include "request_scheduler.h"
 #include "nodes/memory.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
@@ -18,9 +19,11 @@
 #include "openvino/util/common_util.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "transformations/utils/utils.hpp"
+#include "utils/numa.h"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include <cstring>
+#include <unordered_set>
 #include <utility>
 
 using namespace ov::threading;
@@ -39,13 +42,17 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
 CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              const Config& cfg,
-                             const bool loaded_from_cache)
+                             const bool loaded_from_cache,
+                             const std::shared_ptr<SocketsWeights>& socketWeights,
+                             const PackedWeights::CPtr& packedWeights)
     : ov::ICompiledModel::ICompiledModel(model, plugin),
       m_model(model),
       m_plugin(plugin),
       m_cfg{cfg},
       m_name{model->get_name()},
-      m_loaded_from_cache(loaded_from_cache) {
+      m_loaded_from_cache(loaded_from_cache),
+      m_socketWeights(socketWeights ? socketWeights : std::make_shared<SocketsWeights>()),
+      m_packedWeights(packedWeights) {
     m_mutex = std::make_shared<std::mutex>();
     const auto& core = m_plugin->get_core();
     if (!core)
@@ -65,43 +72,116 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
         m_callback_executor = m_task_executor;
     }
 
+    if (m_cfg.kvCacheBlockSize > 0) {
+        m_kv_cache_block_pool = std::make_shared<KVCacheBlockPool>();
+    }
+
     if (m_task_executor)
         set_task_executor(m_task_executor);
+    if (m_task_executor && (m_cfg.requestPrioritySetExplicitly || m_cfg.requestDeadline > 0)) {
+        m_scheduling_executor = std::make_shared<SchedulingExecutor>(m_task_executor,
+                                                                     m_cfg.requestPriority,
+                                                                     std::chrono::milliseconds(m_cfg.requestDeadline));
+    }
     if (m_callback_executor)
         set_callback_executor(m_callback_executor);
 
     int streams = std::max(1, m_cfg.streamExecutorConfig.get_streams());
-    std::vector<Task> tasks;
-    tasks.resize(streams);
     m_graphs.resize(streams);
-    if (m_cfg.streams != 0) {
-        auto all_graphs_ready = [&] {
-            return std::all_of(m_graphs.begin(), m_graphs.end(), [&](Graph& graph) {
-                return graph.IsReady();
-            });
-        };
-        do {
-            for (auto&& task : tasks) {
-                task = [this] {
-                    CompiledModel::get_graph();
-                };
-            }
-            m_task_executor->run_and_wait(tasks);
-        } while (!all_graphs_ready());
+    if (m_cfg.streams != 0 && m_cfg.lazyStreamsCompilation && streams > 1) {
+        // the first graph is enough to start the inference, the requests are executed with the ready graphs
+        // until every stream has created its own one
+        m_task_executor->run_and_wait({[this] {
+            CompiledModel::get_graph(true);
+        }});
+        m_lazy_compilation = std::make_shared<LazyCompilation>();
+        for (int i = 0; i < streams; i++) {
+            create_graph_async();
+        }
+    } else if (m_cfg.streams != 0) {
+        create_graphs();
     } else {
         CompiledModel::get_graph();
     }
 }
 
-CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
+CompiledModel::~CompiledModel() {
+    if (m_lazy_compilation) {
+        // the destructor may run on a stream thread, so it doesn't wait for the queued tasks, which may need this
+        // stream, but only for the ones already creating the graphs on the other streams
+        std::unique_lock<std::mutex> lock(m_lazy_compilation->mutex);
+        m_lazy_compilation->stopped = true;
+        m_lazy_compilation->cv.wait(lock, [&] {
+            return m_lazy_compilation->running == 0;
+        });
+    }
+}
+
+bool CompiledModel::all_graphs_ready() const {
+    return std::all_of(m_graphs.begin(), m_graphs.end(), [&](const GraphGuard& graph) {
+        return graph._ready.load();
+    });
+}
+
+void CompiledModel::create_graph_async() const {
+    auto state = m_lazy_compilation;
+    m_task_executor->run([this, state] {
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->stopped)
+                return;
+            state->running++;
+        }
+        try {
+            CompiledModel::get_graph(true);
+        } catch (...) {
+            // the graph is created again on the first inference in the stream, which reports the error
+        }
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->running--;
+        // the task may run on a stream which has its graph already, so it's run again for the other streams
+        if (!state->stopped && !all_graphs_ready()) {
+            create_graph_async();
+        }
+        state->cv.notify_all();
+    });
+}
+
+void CompiledModel::create_graphs() const {
+    std::vector<Task> tasks(m_graphs.size());
+    do {
+        for (auto&& task : tasks) {
+            task = [this] {
+                CompiledModel::get_graph(true);
+            };
+        }
+        m_task_executor->run_and_wait(tasks);
+    } while (!all_graphs_ready());
+}
+
+CompiledModel::GraphGuard::Lock CompiledModel::get_graph(bool stream_graph_only) const {
     int streamId = 0;
     int socketId = 0;
+    int numaNodeId = -1;
     auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
     if (nullptr != streamsExecutor) {
         streamId = streamsExecutor->get_stream_id();
         socketId = streamsExecutor->get_socket_id();
+        numaNodeId = getOrgNumaNodeId(streamsExecutor->get_numa_node_id());
     }
-    auto graphLock = GraphGuard::Lock(m_graphs[streamId % m_graphs.size()]);
+    auto& streamGraph = m_graphs[streamId % m_graphs.size()];
+    if (m_cfg.lazyStreamsCompilation && !stream_graph_only && !streamGraph._ready) {
+        // the graph of the stream is not created yet, so take any ready graph of the same NUMA node which is not used
+        // at the moment, the memory of the graphs is allocated on the node they are created on
+        for (auto& graph : m_graphs) {
+            if (!graph._ready || graph.getGraphContext()->getNumaNodeId() != numaNodeId)
+                continue;
+            auto readyGraphLock = GraphGuard::Lock(graph, std::try_to_lock);
+            if (readyGraphLock.owns_lock())
+                return readyGraphLock;
+        }
+    }
+    auto graphLock = GraphGuard::Lock(streamGraph);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
@@ -109,16 +189,28 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                 GraphContext::Ptr ctx;
                 {
                     std::lock_guard<std::mutex> lock{*m_mutex.get()};
-                    // disable weights caching if graph was created only once
-                    auto weightsCache = m_cfg.streams != 1 ? m_socketWeights[socketId] : nullptr;
+                    // disable weights caching if graph was created only once and is not shared with other models
+                    auto weightsCache = (m_cfg.streams != 1 || !m_cfg.weightsSharingId.empty())
+                                            ? (*m_socketWeights)[socketId]
+                                            : nullptr;
                     auto isQuantizedFlag =
                         (m_cfg.lpTransformsMode == Config::On) &&
                         ov::pass::low_precision::LowPrecision::isFunctionQuantized(m_model);
 
-                    ctx = std::make_shared<GraphContext>(m_cfg, weightsCache, isQuantizedFlag);
+                    auto& socketCache = m_socketCaches[socketId];
+                    if (!socketCache)
+                        socketCache = std::make_shared<SharedMultiCache>(m_cfg.rtCacheCapacity);
+
+                    ctx = std::make_shared<GraphContext>(m_cfg,
+                                                         weightsCache,
+                                                         isQuantizedFlag,
+                                                         m_packedWeights,
+                                                         socketCache,
+                                                         numaNodeId);
                 }
                 const std::shared_ptr<const ov::Model> model = m_model;
                 graphLock._graph.CreateGraph(model, ctx);
+                graphLock._graph._ready = true;
             } catch (...) {
                 exception = std::current_exception();
             }
@@ -135,6 +227,39 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
     return graphLock;
 }
 
+std::map<std::string, uint64_t> CompiledModel::get_numa_memory_usage() const {
+    std::map<std::string, uint64_t> usage;
+    uint64_t local = 0;
+    uint64_t remote = 0;
+    auto account = [&](const std::string& kind, int localNumaNodeId, const std::map<int, size_t>& bytesPerNode) {
+        for (const auto& item : bytesPerNode) {
+            usage[kind + "." + std::to_string(item.first)] += item.second;
+            if (localNumaNodeId < 0)
+                continue;
+            (item.first == localNumaNodeId ? local : remote) += item.second;
+        }
+    };
+
+    // the weights caches may be shared with the other models compiled with the same weights sharing id
+    for (const auto& cache : m_socketWeights->caches()) {
+        std::map<int, size_t> bytesPerNode;
+        cache.second->countNumaResidentBytes(bytesPerNode);
+        account("weights", cache.second->getNumaNodeId(), bytesPerNode);
+    }
+    for (auto& graph : m_graphs) {
+        if (!graph._ready)
+            continue;
+        // the arenas may be reallocated by the inference
+        GraphGuard::Lock graphLock(graph);
+        std::map<int, size_t> bytesPerNode;
+        graphLock._graph.countNumaResidentBytes(bytesPerNode);
+        account("activations", graphLock._graph.getGraphContext()->getNumaNodeId(), bytesPerNode);
+    }
+    usage["local"] = local;
+    usage["remote"] = remote;
+    return usage;
+}
+
 std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request() const {
     m_numRequests++;
     return std::make_shared<SyncInferRequest>(std::static_pointer_cast<const CompiledModel>(shared_from_this()));
@@ -144,7 +269,7 @@ std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() co
     auto internal_request = create_sync_infer_request();
     auto async_infer_request =
         std::make_shared<AsyncInferRequest>(std::static_pointer_cast<SyncInferRequest>(internal_request),
-                                            get_task_executor(),
+                                            m_scheduling_executor ? m_scheduling_executor : get_task_executor(),
                                             get_callback_executor());
     return async_infer_request;
 }
@@ -170,6 +295,23 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         return option->second;
     }
 
+    if (name == ov::intel_cpu::numa_memory_usage) {
+        return decltype(ov::intel_cpu::numa_memory_usage)::value_type(get_numa_memory_usage());
+    }
+    if (name == ov::intel_cpu::shared_kernels_number) {
+        std::lock_guard<std::mutex> lock{*m_mutex.get()};
+        uint64_t number = 0;
+        for (const auto& socketCache : m_socketCaches)
+            number += socketCache.second->getCreatedNumber();
+        return decltype(ov::intel_cpu::shared_kernels_number)::value_type(number);
+    }
+    if (name == ov::intel_cpu::weights_cache_hits) {
+        uint64_t number = 0;
+        for (const auto& cache : m_socketWeights->caches())
+            number += cache.second->getHitsNumber();
+        return decltype(ov::intel_cpu::weights_cache_hits)::value_type(number);
+    }
+
     // @todo Can't we just use local copy (_cfg) instead?
     auto graphLock = get_graph();
     const auto& graph = graphLock._graph;
@@ -267,6 +409,28 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
 }
 
 void CompiledModel::export_model(std::ostream& modelStream) const {
+    // the weights reordered into the layouts of the selected kernels go first,
+    // so the import doesn't need to reorder them again
+    PackedWeights::Entries packedWeights;
+    {
+        auto graphLock = get_graph();
+        std::unordered_set<std::string> keys;
+        for (const auto& node : graphLock._graph.GetNodes()) {
+            for (const auto& weights : node->getPrivateWeightCache()) {
+                if (!weights.second || !weights.second->isAllocated()) {
+                    continue;
+                }
+                auto key = PackedWeights::key(node->getName(),
+                                              weights.first,
+                                              weights.second->getDesc().getPrecision());
+                if (keys.insert(key).second) {
+                    packedWeights.emplace_back(std::move(key), weights.second);
+                }
+            }
+        }
+    }
+    PackedWeights::write(modelStream, packedWeights);
+
     ModelSerializer serializer(modelStream);
     serializer << m_model;
 }
@@ -4,11 +4,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "graph.h"
 #include "graph_context.h"
+#include "kv_cache_block_pool.h"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/iplugin.hpp"
@@ -25,7 +30,11 @@ public:
     CompiledModel(const std::shared_ptr<ov::Model>& model,
                   const std::shared_ptr<const ov::IPlugin>& plugin,
                   const Config& cfg,
-                  const bool loaded_from_cache);
+                  const bool loaded_from_cache,
+                  const std::shared_ptr<SocketsWeights>& socketWeights = nullptr,
+                  const PackedWeights::CPtr& packedWeights = nullptr);
+
+    ~CompiledModel() override;
 
     std::shared_ptr<ov::IAsyncInferRequest> create_infer_request() const override;
 
@@ -48,6 +57,8 @@ private:
     const std::shared_ptr<const ov::IPlugin> m_plugin;
     std::shared_ptr<ov::threading::ITaskExecutor> m_task_executor = nullptr;      //!< Holds a task executor
     std::shared_ptr<ov::threading::ITaskExecutor> m_callback_executor = nullptr;  //!< Holds a callback executor
+    // orders the infer requests of the compiled models by the request priority and deadline, if any is set
+    std::shared_ptr<ov::threading::ITaskExecutor> m_scheduling_executor = nullptr;
 
     // Generic synchronization primitive on CompiledModel level.
     // Usage example: helps to avoid data races during CPU Graph initialization in multi-streams scenario
@@ -57,8 +68,11 @@ private:
     std::string m_name;
     struct GraphGuard : public Graph {
         std::mutex _mutex;
+        // may be checked without locking the mutex, unlike the status of the graph
+        std::atomic<bool> _ready = {false};
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(GraphGuard& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
+            Lock(GraphGuard& graph, std::try_to_lock_t) : std::unique_lock<std::mutex>(graph._mutex, std::try_to_lock), _graph(graph) {}
             GraphGuard& _graph;
         };
     };
@@ -66,13 +80,46 @@ private:
     const bool m_loaded_from_cache;
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
-    mutable SocketsWeights m_socketWeights;
+    // may be shared with other compiled models, see Config::weightsSharingId
+    std::shared_ptr<SocketsWeights> m_socketWeights;
+    // weights packed by the graph the model was exported from, if the model is imported from the model cache
+    PackedWeights::CPtr m_packedWeights;
+    // generated kernels shared by the graphs of the streams on the same socket, the key is the socket id
+    mutable std::map<int, SharedMultiCachePtr> m_socketCaches;
+    // blocks of the paged KV cache states, shared by all the infer requests
+    KVCacheBlockPool::Ptr m_kv_cache_block_pool;
+    // the state of the tasks which create the graphs of the streams after the compiled model is returned, see
+    // Config::lazyStreamsCompilation. The tasks outlive the compiled model, so they check whether it's stopped before
+    // accessing it, and the destructor waits only for the running ones instead of the queued ones.
+    struct LazyCompilation {
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool stopped = false;
+        int running = 0;
+    };
+    std::shared_ptr<LazyCompilation> m_lazy_compilation;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
      */
-    GraphGuard::Lock get_graph() const;
+    /* NOTE: In the lazy streams compilation mode the ready graph of another stream may be returned, unless
+     *       stream_graph_only is set, until the graph of the current stream is created. Only the graphs created on the
+     *       NUMA node of the current stream are lent, so the inference doesn't access the memory of the remote node.
+     */
+    GraphGuard::Lock get_graph(bool stream_graph_only = false) const;
+    /* Creates the graphs of all the streams, the streams executor runs the tasks until every stream has created its graph
+     */
+    void create_graphs() const;
+    /* Runs the task which creates the graph of the stream it is executed on, the task is run again until every stream
+     * has created its graph, see Config::lazyStreamsCompilation
+     */
+    void create_graph_async() const;
+    bool all_graphs_ready() const;
+    /* Returns the bytes of the weights and of the memory arenas of the graphs resident on every numa node,
+     * see ov::intel_cpu::numa_memory_usage
+     */
+    std::map<std::string, uint64_t> get_numa_memory_usage() const;
 };
 
 }   // namespace intel_cpu
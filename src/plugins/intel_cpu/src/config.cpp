@@ -235,6 +235,8 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::internal::exclusive_async_requests.name(),
                                ". Expected only true/false");
             }
+        } else if (key == ov::internal::weights_sharing_id.name()) {
+            weightsSharingId = val.as<std::string>();
         } else if (key == ov::intel_cpu::lp_transforms_mode.name()) {
             try {
                 lpTransformsMode = val.as<bool>() ? LPTransformsMode::On : LPTransformsMode::Off;
@@ -245,6 +247,77 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                key,
                                ". Expected value only ov::intel_cpu::Config::LPTransformsMode::On/Off");
             }
+        } else if (key == ov::intel_cpu::enable_parallel_branches.name()) {
+            try {
+                enableParallelBranches = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::enable_parallel_branches.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::lazy_streams_compilation.name()) {
+            try {
+                lazyStreamsCompilation = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::lazy_streams_compilation.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::request_priority.name()) {
+            try {
+                requestPriority = val.as<ov::hint::Priority>();
+                requestPrioritySetExplicitly = true;
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::request_priority.name(),
+                               ". Expected only LOW/MEDIUM/HIGH");
+            }
+        } else if (key == ov::intel_cpu::request_deadline.name()) {
+            int val_i = -1;
+            try {
+                ov::Any value = val.as<std::string>();
+                val_i = value.as<int>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::request_deadline.name(),
+                               ". Expected only non negative integer numbers");
+            }
+            if (val_i < 0) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::request_deadline.name(),
+                               ". Expected only non negative integer numbers");
+            }
+            requestDeadline = static_cast<uint32_t>(val_i);
+        } else if (key == ov::intel_cpu::kv_cache_block_size.name()) {
+            int val_i = -1;
+            try {
+                ov::Any value = val.as<std::string>();
+                val_i = value.as<int>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::kv_cache_block_size.name(),
+                               ". Expected only non negative integer numbers");
+            }
+            if (val_i < 0) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::kv_cache_block_size.name(),
+                               ". Expected only non negative integer numbers");
+            }
+            kvCacheBlockSize = static_cast<size_t>(val_i);
         } else if (key == ov::device::id.name()) {
             device_id = val.as<std::string>();
             if (!device_id.empty()) {
@@ -51,6 +51,16 @@ struct Config {
 
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
+    bool enableParallelBranches = false;
+    bool lazyStreamsCompilation = false;
+    ov::hint::Priority requestPriority = ov::hint::Priority::MEDIUM;
+    bool requestPrioritySetExplicitly = false;
+    // milliseconds, 0 - no deadline
+    uint32_t requestDeadline = 0;
+    // 0 - contiguous KV cache, otherwise the number of tokens in a paged KV cache block
+    size_t kvCacheBlockSize = 0;
+    // the compiled models with the same non empty id share the weights cache
+    std::string weightsSharingId = {};
     SnippetsMode snippetsMode = SnippetsMode::Enable;
     std::string dumpToDot = {};
     std::string device_id = {};
@@ -217,6 +217,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
             { "ScaledDotProductAttention", Type::ScaledDotProductAttention},
             { "ScaledDotProductAttentionWithKVCache", Type::ScaledDotProductAttention},
             { "RoPE", Type::RoPE},
+            { "Preprocess", Type::Preprocess},
     };
     return type_to_name_tbl;
 }
@@ -332,6 +333,7 @@ std::string NameFromType(const Type type) {
         CASE(Ngram);
         CASE(ScaledDotProductAttention);
         CASE(RoPE);
+        CASE(Preprocess);
         CASE(Unknown);
     }
 #undef CASE
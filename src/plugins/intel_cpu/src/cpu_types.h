@@ -115,6 +115,7 @@ enum class Type {
     Ngram,
     ScaledDotProductAttention,
     RoPE,
+    Preprocess,
 };
 
 enum class Algorithm {
@@ -0,0 +1,162 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_mem_planner.h"
+
+#include <algorithm>
+#include <common/utils.hpp>
+
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+#include "utils/numa.h"
+
+namespace ov {
+namespace intel_cpu {
+
+class DynamicMemoryPlanner::PlannedMemoryMngr : public IMemoryMngrObserver {
+public:
+    PlannedMemoryMngr() : m_overflow(nullptr, release) {}
+
+    void* getRawPtr() const noexcept override {
+        if (m_overflow) {
+            return m_overflow.get();
+        }
+        return m_arena ? static_cast<uint8_t*>(m_arena.get()) + m_offset : nullptr;
+    }
+
+    void setExtBuff(void* ptr, size_t size) override {
+        m_useExternalStorage = true;
+        m_overflowSize = size;
+        m_overflow = decltype(m_overflow)(ptr, release);
+        notifyUpdate();
+    }
+
+    bool resize(size_t size) override {
+        m_requiredSize = std::max(m_requiredSize, size);
+        if (size <= (m_overflow ? m_overflowSize : m_capacity)) {
+            return false;
+        }
+        // the partition is too small, use a private buffer till the plan is updated
+        constexpr int cacheLineSize = 64;
+        const size_t overflowSize = std::max(size, m_overflowSize * growFactor);
+        void* ptr = dnnl::impl::malloc(overflowSize, cacheLineSize);
+        if (!ptr) {
+            OPENVINO_THROW("Failed to allocate ", overflowSize, " bytes of memory");
+        }
+        m_useExternalStorage = false;
+        m_overflowSize = overflowSize;
+        m_overflow = decltype(m_overflow)(ptr, destroy);
+        notifyUpdate();
+        return true;
+    }
+
+    bool hasExtBuffer() const noexcept override {
+        return m_useExternalStorage;
+    }
+
+    void registerMemory(Memory* memPtr) override {
+        if (memPtr) {
+            m_setMemPtrs.insert(memPtr);
+        }
+    }
+
+    void unregisterMemory(Memory* memPtr) override {
+        if (memPtr) {
+            m_setMemPtrs.erase(memPtr);
+        }
+    }
+
+    bool outgrown() const {
+        return m_requiredSize > m_capacity;
+    }
+
+    size_t requiredCapacity() const {
+        return outgrown() ? std::max(m_requiredSize, m_capacity * growFactor) : m_capacity;
+    }
+
+    void setPartition(std::shared_ptr<void> arena, size_t offset, size_t capacity) {
+        m_arena = std::move(arena);
+        m_offset = offset;
+        m_capacity = capacity;
+        m_useExternalStorage = false;
+        m_overflowSize = 0;
+        m_overflow.reset();
+        notifyUpdate();
+    }
+
+private:
+    void notifyUpdate() {
+        for (auto& item : m_setMemPtrs) {
+            if (item) {
+                item->update();
+            }
+        }
+    }
+
+    static void release(void* ptr) {}
+    static void destroy(void* ptr) {
+        dnnl::impl::free(ptr);
+    }
+
+    std::shared_ptr<void> m_arena;
+    size_t m_offset = 0;
+    size_t m_capacity = 0;
+    // max size requested since the last plan update
+    size_t m_requiredSize = 0;
+
+    bool m_useExternalStorage = false;
+    size_t m_overflowSize = 0;
+    std::unique_ptr<void, void (*)(void*)> m_overflow;
+
+    std::unordered_set<Memory*> m_setMemPtrs;
+};
+
+MemoryMngrPtr DynamicMemoryPlanner::addBox(int start, int finish) {
+    ov::MemorySolver::Box box = {start, finish, 1, static_cast<int64_t>(m_boxes.size())};
+    m_boxes.push_back(box);
+    m_mngrs.push_back(std::make_shared<PlannedMemoryMngr>());
+    return m_mngrs.back();
+}
+
+void DynamicMemoryPlanner::update() {
+    bool outgrown = false;
+    for (const auto& mngr : m_mngrs) {
+        outgrown |= mngr->outgrown();
+    }
+    // the shapes fit into the current plan
+    if (!outgrown) {
+        return;
+    }
+
+    std::vector<size_t> capacities(m_mngrs.size());
+    for (size_t i = 0; i < m_mngrs.size(); i++) {
+        capacities[i] = rnd_up(m_mngrs[i]->requiredCapacity(), alignment);
+        m_boxes[i].size = static_cast<int64_t>(std::max<size_t>(1, capacities[i] / alignment));
+    }
+
+    ov::MemorySolver solver(m_boxes);
+    const size_t totalSize = static_cast<size_t>(solver.solve()) * alignment;
+    if (totalSize > m_arenaSize) {
+        constexpr int cacheLineSize = 64;
+        const size_t arenaSize = std::max(totalSize, m_arenaSize * growFactor);
+        void* ptr = dnnl::impl::malloc(arenaSize, cacheLineSize);
+        if (!ptr) {
+            OPENVINO_THROW("Failed to allocate ", arenaSize, " bytes of memory");
+        }
+        placeOnNumaNode(ptr, arenaSize, m_numaNodeId);
+        m_arena = std::shared_ptr<void>(ptr, [](void* p) {
+            dnnl::impl::free(p);
+        });
+        m_arenaSize = arenaSize;
+    }
+    DEBUG_LOG("Dynamic memory plan: ", totalSize, " bytes of ", m_arenaSize, " bytes arena");
+
+    for (size_t i = 0; i < m_mngrs.size(); i++) {
+        const auto offset = static_cast<size_t>(solver.get_offset(static_cast<int>(i))) * alignment;
+        m_mngrs[i]->setPartition(m_arena, offset, capacities[i]);
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "openvino/runtime/memory_solver.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Memory planner for the edges with undefined shapes.
+ * Every edge cluster gets a partition of one arena, the offsets are solved by MemorySolver for the sizes seen in the
+ * previous inferences, so while the shapes don't outgrow the plan (e.g. they only shrink) no memory is allocated.
+ * A cluster which outgrows its partition gets a private buffer till the end of the inference. After such an
+ * inference the plan is solved again for the new sizes and the arena grows geometrically.
+ */
+class DynamicMemoryPlanner {
+public:
+    using Ptr = std::shared_ptr<DynamicMemoryPlanner>;
+
+    /**
+     * @param numaNodeId the original (OS) id of the numa node the arena is placed on, -1 - no placement
+     */
+    explicit DynamicMemoryPlanner(int numaNodeId = -1) : m_numaNodeId(numaNodeId) {}
+
+    /**
+     * @brief Registers the memory of an edge cluster
+     * @param start the execution order index of the first use
+     * @param finish the execution order index of the last use, -1 means till the end of the inference
+     * @return the memory manager of the cluster
+     */
+    MemoryMngrPtr addBox(int start, int finish);
+
+    /**
+     * @brief Solves the plan again if some of the clusters outgrew their partitions during the last inference.
+     * Must be called between the inferences, when the content of the planned memory may be discarded.
+     */
+    void update();
+
+    // the arena size in bytes, for the debugging purposes
+    size_t arenaSize() const {
+        return m_arenaSize;
+    }
+
+    const void* arena() const {
+        return m_arena.get();
+    }
+
+private:
+    class PlannedMemoryMngr;
+
+    static constexpr size_t alignment = 64;
+    static constexpr size_t growFactor = 2;
+
+    std::vector<ov::MemorySolver::Box> m_boxes;
+    std::vector<std::shared_ptr<PlannedMemoryMngr>> m_mngrs;
+    std::shared_ptr<void> m_arena;
+    size_t m_arenaSize = 0;
+    const int m_numaNodeId;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
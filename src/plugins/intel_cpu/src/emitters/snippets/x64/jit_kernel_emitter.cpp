@@ -33,6 +33,7 @@ jit_kernel_emitter::jit_kernel_emitter(jit_generator* h, cpu_isa_t isa, const ov
 
     body = kernel->region;
     jcp = *reinterpret_cast<const jit_snippets_compile_args*>(kernel->compile_params);
+    runtime_config = kernel->runtime_config;
     master_shape = body.get_master_shape();
 
     // Note: plugin can prepend master shape with 1 to facilitate parallel execution (usually up to 6D tensor)
@@ -122,9 +123,11 @@ jit_kernel_emitter::jit_kernel_emitter(jit_generator* h, cpu_isa_t isa, const ov
     for (const auto& abstract_to_physical : gpr_map_pool.first)
         data_ptr_regs_idx.push_back(abstract_to_physical.second);
     // However we can use reg_indexes_idx and reg_const_params_idx for other operations since we won't need them
-    // after offsets calculation
+    // after offsets calculation. The only exception is shape-agnostic kernel: reg_const_params_idx holds runtime args
+    // that are read by the dynamic Loops
     gpr_map_pool.second.push_back(reg_indexes_idx);
-    gpr_map_pool.second.push_back(reg_const_params_idx);
+    if (!runtime_config)
+        gpr_map_pool.second.push_back(reg_const_params_idx);
     map_abstract_registers(gpr_map_pool, vec_map_pool, general_exprs);
 }
 
@@ -183,7 +186,8 @@ void jit_kernel_emitter::init_data_pointers(const Xbyak::Reg64& reg_indexes, con
 
         return strides;
     };
-    for (size_t i = 0; i < num_params; i++) {
+    // Note: the offsets of shape-agnostic kernel are read from runtime args
+    for (size_t i = 0; i < num_params && !runtime_config; i++) {
         data_offsets[i] = offset_calculation(io_shapes[i],  io_data_layouts[i], io_data_sizes[i], i < num_inputs);
     }
     // master_shape size must be valid in both static and dynamic cases
@@ -211,6 +215,29 @@ void jit_kernel_emitter::init_data_pointers(const Xbyak::Reg64& reg_indexes, con
     for (size_t i = 0; i < num_unique_buffers; ++i) {
         h->mov(data_ptr_regs[num_params + i], h->ptr[reg_const_params + GET_OFF(buffer_scratchpad_ptr)]);
     }
+    if (runtime_config) {
+        OV_CPU_JIT_EMITTER_ASSERT(!last_iter_explicitly, "shape-agnostic kernel requires a spare gpr to calculate the offsets");
+        for (size_t i = 0; i < num_params; i++) {
+            if (i < num_inputs)
+                h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
+            else
+                h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
+        }
+        // From now on reg_const_params points to runtime args
+        h->mov(reg_const_params, h->ptr[reg_const_params + GET_OFF(runtime_args)]);
+        const auto data_offsets_idx = runtime_config->get_data_offsets_idx();
+        for (size_t i = 0; i < num_params; i++) {
+            for (size_t j = 0; j < offset_rank; j++) {
+                if (master_shape[j] == 1)
+                    continue;
+                const auto arg_idx = data_offsets_idx + i * offset_rank + j;
+                h->mov(reg_tmp, h->ptr[reg_const_params + arg_idx * sizeof(int64_t)]);
+                h->imul(reg_tmp, h->ptr[reg_indexes + j * sizeof(size_t)]);
+                h->add(data_ptr_regs[i], reg_tmp);
+            }
+        }
+        return;
+    }
     size_t i = 0;
     for (; i < num_params - last_iter_explicitly; i++) {
         if (i < num_inputs)
@@ -21,6 +21,9 @@ struct jit_snippets_call_args {
     const void *src_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *dst_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *buffer_scratchpad_ptr = nullptr;
+    // Shape dependent values of shape-agnostic kernel: Loop work amounts, ptr increments and data offsets
+    // (see snippets::RuntimeConfig for the layout), nullptr for the kernels generated for static shapes
+    const int64_t *runtime_args = nullptr;
 };
 
 struct jit_snippets_compile_args {
@@ -42,6 +45,8 @@ struct jit_snippets_compile_args {
 ///     1.E jit_loop_end_emitter          /* Scalar Loop over the outer dimension [END] */
 /// }
 /// Note that Kernel doesn't accept any input arguments.
+/// Shape-agnostic Kernel keeps the pointer to jit_snippets_call_args::runtime_args in abi_param2
+/// during the whole execution, so the dynamic Loop emitters can read their work amounts and ptr increments from it.
 ///
 
 class jit_kernel_emitter : public jit_container_emitter {
@@ -59,6 +64,7 @@ private:
     void init_data_pointers(const Xbyak::Reg64&, const Xbyak::Reg64&, const std::vector<Xbyak::Reg64>&) const;
 
     jit_snippets_compile_args jcp;
+    std::shared_ptr<const snippets::RuntimeConfig> runtime_config;
     std::vector<size_t> gp_regs_pool;
     std::vector<size_t> master_shape;
     size_t num_inputs;
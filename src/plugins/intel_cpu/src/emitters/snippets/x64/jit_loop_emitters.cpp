@@ -19,6 +19,12 @@ jit_loop_begin_emitter::jit_loop_begin_emitter(jit_generator* h, cpu_isa_t isa,
     const auto loop_end = get_loop_end(expr);
     work_amount = loop_end->get_work_amount();
     evaluate_once = loop_end->get_evaluate_once();
+    is_dynamic = loop_end->is_dynamic();
+    if (is_dynamic) {
+        runtime_args_idx = loop_end->get_runtime_args_idx();
+        wa_increment = loop_end->get_increment();
+        loop_end_label = std::make_shared<Xbyak::Label>();
+    }
     in_out_type_ = emitter_in_out_map::gpr_to_gpr;
 }
 
@@ -47,7 +53,12 @@ void jit_loop_begin_emitter::emit_impl(const std::vector<size_t>& in, const std:
     Reg64 reg_work_amount = Reg64(static_cast<int>(out.back()));
     Label for_body;
     // save previous register state (if there is an outer loop that uses this reg for example)
-    if (!evaluate_once) {
+    if (is_dynamic) {
+        // Note: shape-agnostic kernel keeps runtime args in abi_param2, see jit_kernel_emitter
+        h->mov(reg_work_amount, h->ptr[abi_param2 + runtime_args_idx * sizeof(int64_t)]);
+        h->cmp(reg_work_amount, wa_increment);
+        h->jl(*loop_end_label, T_NEAR);
+    } else if (!evaluate_once) {
         h->mov(reg_work_amount, work_amount);
     }
     // Note: loop address is not calculated at this point, so need to call calcJmpAddress() which is protected
@@ -71,6 +82,14 @@ jit_loop_end_emitter::jit_loop_end_emitter(jit_generator* h, cpu_isa_t isa, cons
     finalization_offsets = loop_end->get_finalization_offsets();
     evaluate_once = loop_end->get_evaluate_once();
     io_data_size = loop_end->get_element_type_sizes();
+    is_dynamic = loop_end->is_dynamic();
+    if (is_dynamic) {
+        runtime_args_idx = loop_end->get_runtime_args_idx();
+        const auto& begin_expr = expr->get_input_port_connector(num_inputs - 1)->get_source().get_expr();
+        const auto begin_emitter = std::dynamic_pointer_cast<jit_loop_begin_emitter>(begin_expr->get_emitter());
+        OV_CPU_JIT_EMITTER_ASSERT(begin_emitter && begin_emitter->loop_end_label, "has invalid LoopBegin emitter");
+        loop_end_label = begin_emitter->loop_end_label;
+    }
     in_out_type_ = emitter_in_out_map::gpr_to_gpr;
 }
 
@@ -97,6 +116,29 @@ void jit_loop_end_emitter::emit_impl(const std::vector<size_t>& in, const std::v
     std::copy(in.begin(), in.end() - 1, std::back_inserter(data_ptr_reg_idxs));
 
     Reg64 reg_work_amount = Reg64(in.back());
+    if (is_dynamic) {
+        // runtime args of the Loop: [work_amount, ptr_increments x io_size, finalization_offsets x io_size]
+        const auto io_size = data_ptr_reg_idxs.size();
+        auto runtime_arg = [&](size_t idx) {
+            return h->qword[abi_param2 + (runtime_args_idx + idx) * sizeof(int64_t)];
+        };
+        for (size_t idx = 0; idx < io_size; idx++) {
+            if (!is_incremented[idx] || ptr_increments[idx] == 0)
+                continue;
+            h->add(Reg64(static_cast<int>(data_ptr_reg_idxs[idx])), runtime_arg(1 + idx));
+        }
+        h->sub(reg_work_amount, wa_increment);
+        h->cmp(reg_work_amount, wa_increment);
+        h->jge(loop_begin->begin_address);
+
+        h->L(*loop_end_label);
+        for (size_t idx = 0; idx < io_size; idx++) {
+            if (!is_incremented[idx] || ptr_increments[idx] == 0)
+                continue;
+            h->add(Reg64(static_cast<int>(data_ptr_reg_idxs[idx])), runtime_arg(1 + io_size + idx));
+        }
+        return;
+    }
     if (!evaluate_once) {
         for (size_t idx = 0; idx < data_ptr_reg_idxs.size(); idx++) {
             if (!is_incremented[idx] || ptr_increments[idx] == 0)
@@ -30,6 +30,13 @@ private:
     std::shared_ptr<snippets::op::LoopBegin> loop_begin;
     bool evaluate_once = false;
     size_t work_amount = 0; // need to store work_amount explicitly, since two loops can work on the same dim (e.g. vector + scalar)
+    // dynamic Loop reads work_amount from runtime args and skips the body if the work_amount is less than the increment
+    bool is_dynamic = false;
+    size_t runtime_args_idx = 0;
+    size_t wa_increment = 0;
+    std::shared_ptr<Xbyak::Label> loop_end_label = nullptr;
+
+    friend class jit_loop_end_emitter;
 };
 
 class jit_loop_end_emitter : public jit_emitter {
@@ -58,6 +65,10 @@ private:
     std::vector<bool> is_incremented;
     std::vector<int64_t> ptr_increments;
     std::vector<int64_t> finalization_offsets;
+    // dynamic Loop reads ptr_increments and finalization_offsets (in bytes) from runtime args
+    bool is_dynamic = false;
+    size_t runtime_args_idx = 0;
+    std::shared_ptr<Xbyak::Label> loop_end_label = nullptr;
 };
 
 }   // namespace intel_cpu
@@ -15,6 +15,7 @@
 #include <utility>
 #include <vector>
 
+#include "dynamic_mem_planner.h"
 #include "edge.h"
 #include "graph_dumper.h"
 #include "graph_optimizer.h"
@@ -32,13 +33,16 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/core/node.hpp"
+#include "request_scheduler.h"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #include "utils/ngraph_utils.hpp"
 #include "utils/node_dumper.h"
+#include "utils/numa.h"
 #include "utils/verbose.h"
 
 #include <oneapi/dnnl/dnnl.hpp>
+#include "common/primitive_hashing_utils.hpp"
 #if defined(OV_CPU_ARM_ENABLE_FP16)
 #include "common/primitive_desc_iface.hpp"
 #endif
@@ -245,6 +249,9 @@ void Graph::InitGraph(bool optimize) {
 
     const auto hasDynNodes = ProcessDynNodes();
 
+    if (getConfig().enableParallelBranches && !hasDynNodes)
+        SplitIntoParallelWaves();
+
     Allocate();
 
     CreatePrimitivesAndExecConstants();
@@ -332,6 +339,25 @@ void Graph::InitOptimalPrimitiveDescriptors() {
 
 void Graph::ExtractExecutableNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ExtractExecutableNodes");
+    // The output shapes of a node are defined by the graph input shapes, if neither the node nor its predecessors
+    // have the output shapes depending on the data or on the state
+    std::unordered_set<const Node*> dataDependentShapes;
+    for (const auto& graphNode : graphNodes) {
+        bool dependent = graphNode->isDynamicNode() &&
+                         (graphNode->outputShapeDataDependency() ||
+                          one_of(graphNode->getType(),
+                                 Type::MemoryInput,
+                                 Type::Reference,
+                                 Type::If,
+                                 Type::TensorIterator));
+        for (size_t i = 0; i < graphNode->getParentEdges().size() && !dependent; i++) {
+            dependent = dataDependentShapes.count(graphNode->getParentEdgeAt(i)->getParent().get()) > 0;
+        }
+        if (dependent) {
+            dataDependentShapes.insert(graphNode.get());
+        }
+    }
+
     for (const auto& graphNode : graphNodes) {
         if ((!graphNode->isConstant() && CPU_DEBUG_CAPS_ALWAYS_TRUE(graphNode->isExecutable())) || graphNode->isDynamicNode()) {
             /* @todo
@@ -344,8 +370,19 @@ void Graph::ExtractExecutableNodes() {
                 itr->second = executableGraphNodes.size();
             }
             executableGraphNodes.emplace_back(graphNode);
+            cacheableOutputDims.push_back(dataDependentShapes.count(graphNode.get()) == 0);
         }
     }
+
+    if (execWaves.empty())
+        return;
+
+    execWavesBounds.push_back(0);
+    for (size_t i = 1; i < executableGraphNodes.size(); i++) {
+        if (execWaves[executableGraphNodes[i].get()] != execWaves[executableGraphNodes[i - 1].get()])
+            execWavesBounds.push_back(i);
+    }
+    execWavesBounds.push_back(executableGraphNodes.size());
 }
 
 void Graph::CreatePrimitivesAndExecConstants() const {
@@ -517,11 +554,15 @@ void Graph::ResolveComplexInplaceConflicts() {
     };
 
     // secondary pass to eliminate complex inplace conflicts
-    auto needReorder = [](const EdgePtr& edge) -> bool {
+    const bool parallelBranches = getConfig().enableParallelBranches;
+    auto needReorder = [parallelBranches](const EdgePtr& edge) -> bool {
         int inNumber = edge->getInputNum();
         const auto portChildEdges = edge->getParent()->getChildEdgesAtPort(inNumber);
         if (portChildEdges.size() > 1) {
             if (auto modifyingNode = edge->modifiedInPlace()) {
+                // the other consumers may run concurrently with the modifying node when the branches are executed in parallel
+                if (parallelBranches)
+                    return true;
                 auto execIndex = modifyingNode->getExecIndex();
                 for (auto pEdgePeer : portChildEdges) {
                     if (pEdgePeer == edge)
@@ -602,6 +643,13 @@ static edge_clusters_t findEdgeClusters(const std::vector<EdgePtr> & graphEdges)
 void Graph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
+    // In the parallel branches mode the nodes of one wave may run at the same time,
+    // so the lifetime of a tensor is measured in waves rather than in execution indices
+    auto getExecTimestamp = [this](const NodePtr& node) {
+        auto itr = execWaves.find(node.get());
+        return itr != execWaves.end() ? itr->second : node->execIndex;
+    };
+
     size_t remaining_edge_clusters_count = edge_clusters.size();
 
     // Resolve special cases:
@@ -681,8 +729,8 @@ void Graph::AllocateWithReuse() {
         ov::MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, static_cast<int64_t>(i) };
         int64_t boxSize = 0;
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = getExecTimestamp(edge->getParent());
+            int e_finish = getExecTimestamp(edge->getChild());
 
             if (boxSize != -1 && edge->getDesc().isDefined()) {
                 int64_t e_size = edge->getDesc().getCurrentMemSize();  // size in bytes (from the beginning of data to the last element)
@@ -729,6 +777,8 @@ void Graph::AllocateWithReuse() {
     size_t total_size = static_cast<size_t>(staticMemSolver.solve()) * alignment;
 
     memWorkspace = std::make_shared<Memory>(getEngine(), DnnlBlockedMemoryDesc(ov::element::i8, Shape(VectorDims{total_size})));
+    // the workspace is not touched yet, so its pages are allocated on the numa node of the stream
+    placeOnNumaNode(memWorkspace->getData(), total_size, context->getNumaNodeId());
 
     if (edge_clusters.empty())
         return;
@@ -810,42 +860,31 @@ void Graph::AllocateWithReuse() {
 
         ov::MemorySolver::normalize_boxes(undefinedBoxes);
 
-        std::vector<std::vector<ov::MemorySolver::Box>> groups; //groups of nonoverlapping boxes
-        constexpr bool enableMemReuse = true; // set false to disable mem reuse for debug purposes
-        if (enableMemReuse) {
-            groups.push_back({undefinedBoxes.front()});
-            for (size_t i = 1; i < undefinedBoxes.size(); ++i) {
-                const auto& box = undefinedBoxes[i];
-                bool groupFound = false;
-                for (auto& group : groups) {
-                    const auto& lastBox = group.back();
-                    if (lastBox.start > box.finish || lastBox.finish < box.start) {
-                        group.push_back(box);
-                        groupFound = true;
-                        break;
-                    }
-                }
-
-                if (!groupFound) {
-                    groups.push_back({box});
-                }
-            }
-        } else {
-            for (auto& box : undefinedBoxes) {
-                groups.push_back({box});
-            }
-        }
-        for (auto& group : groups) {
-            auto grpMemMngr =
-                std::make_shared<DnnlMemoryMngr>(make_unique<MemoryMngrWithReuse>());
-            for (auto& box : group) {
-                for (auto& edge : edge_clusters[box.id]) {
-                    if (edge->getStatus() == Edge::Status::NeedAllocation) {
-                        edge->allocate(grpMemMngr);
+        // The clusters get the partitions of one arena planned for the actual shapes, see DynamicMemoryPlanner.
+        // The plan is updated at the end of the inference, so the clusters which keep the data for the infer request
+        // after it (inputs, outputs and states) get their own memory managers, as the plan would move them.
+        auto isIOCluster = [](const edge_cluster_t& cluster) {
+            return std::any_of(cluster.begin(), cluster.end(), [](const EdgePtr& edge) {
+                return edge->getParent()->getType() == Type::Input ||
+                       one_of(edge->getChild()->getType(), Type::Output, Type::MemoryOutput);
+            });
+        };
+        dynamicMemPlanner = std::make_shared<DynamicMemoryPlanner>(context->getNumaNodeId());
+        for (auto& box : undefinedBoxes) {
+            MemoryMngrPtr boxMemMngr;
+            for (auto& edge : edge_clusters[box.id]) {
+                if (edge->getStatus() == Edge::Status::NeedAllocation) {
+                    if (!boxMemMngr) {
+                        boxMemMngr = isIOCluster(edge_clusters[box.id])
+                                         ? std::make_shared<DnnlMemoryMngr>(make_unique<MemoryMngrWithReuse>())
+                                         : dynamicMemPlanner->addBox(box.start, box.finish);
                     }
+                    edge->allocate(boxMemMngr);
                 }
             }
         }
+    } else {
+        dynamicMemPlanner.reset();
     }
 
     // Resolve all other edges with status NotAllocated and in-place
@@ -909,6 +948,15 @@ void Graph::Allocate() {
     for (auto& edge : graphEdges) edge->validate();
 }
 
+void Graph::countNumaResidentBytes(std::map<int, size_t>& bytesPerNode) const {
+    if (memWorkspace) {
+        ov::intel_cpu::countNumaResidentBytes(memWorkspace->getData(), memWorkspace->getSize(), bytesPerNode);
+    }
+    if (dynamicMemPlanner) {
+        ov::intel_cpu::countNumaResidentBytes(dynamicMemPlanner->arena(), dynamicMemPlanner->arenaSize(), bytesPerNode);
+    }
+}
+
 bool Graph::ProcessDynNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ProcessDynNodes");
 
@@ -939,6 +987,43 @@ bool Graph::ProcessDynNodes() {
     return result;
 }
 
+void Graph::SplitIntoParallelWaves() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::SplitIntoParallelWaves");
+
+    // The state nodes depend on each other implicitly (not via edges), so their relative order must be preserved
+    const bool hasStateNodes = std::any_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+        return one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput);
+    });
+    if (hasStateNodes || parallel_get_max_threads() == 1)
+        return;
+
+    // Constant nodes are executed once on load, so only the non constant parents define the wave of the node
+    for (const auto& node : graphNodes) {
+        int wave = 0;
+        if (!node->isConstant()) {
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                const auto parent = node->getParentEdgeAt(i)->getParent();
+                if (!parent->isConstant())
+                    wave = std::max(wave, execWaves.at(parent.get()) + 1);
+            }
+        }
+        execWaves[node.get()] = wave;
+    }
+
+    // The stable sort by the wave keeps the topological order
+    std::stable_sort(graphNodes.begin(), graphNodes.end(), [this](const NodePtr& lhs, const NodePtr& rhs) {
+        return execWaves.at(lhs.get()) < execWaves.at(rhs.get());
+    });
+
+    std::unordered_map<int, size_t> waveLanes;
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto& node = graphNodes[i];
+        node->execIndex = static_cast<int>(i);
+        if (!node->isConstant())
+            node->setScratchPadLane(waveLanes[execWaves.at(node.get())]++);
+    }
+}
+
 void Graph::PushInputData(const std::string& name, const ov::SoPtr<ITensor>& input) {
     if (!IsReady()) OPENVINO_THROW("Wrong state. Topology not ready.");
     auto input_itr = inputNodesMap.find(name);
@@ -947,6 +1032,9 @@ void Graph::PushInputData(const std::string& name, const ov::SoPtr<ITensor>& inp
         auto childEdge = node->getChildEdgeAt(0);
         auto edgeMemory = childEdge->getMemoryPtr();
 
+        // the data is read from the input memory again
+        std::static_pointer_cast<node::Input>(node)->setBatchItems({});
+
         const void* ext_data_ptr = input->data();
         void* inter_data_ptr = edgeMemory->getData();
 
@@ -970,6 +1058,45 @@ void Graph::PushInputData(const std::string& name, const ov::SoPtr<ITensor>& inp
     }
 }
 
+bool Graph::CanPushInputBatch(const std::string& name, const std::vector<ov::SoPtr<ITensor>>& batch) const {
+    if (Status::ReadyStatic != status)
+        return false;
+    auto input_itr = inputNodesMap.find(name);
+    if (input_itr == inputNodesMap.end())
+        return false;
+
+    const auto& childEdges = input_itr->second->getChildEdgesAtPort(0);
+    const bool consumersCanRead = std::all_of(childEdges.begin(), childEdges.end(), [](const EdgePtr& edge) {
+        const auto& child = edge->getChild();
+        return !edge->inPlace() && !child->isConstant() && child->canReadBatchItems();
+    });
+    if (!consumersCanRead)
+        return false;
+
+    const auto& desc = childEdges.front()->getMemory().getDesc();
+    auto itemDims = desc.getShape().getStaticDims();
+    if (itemDims.empty() || itemDims.front() != batch.size() || !MemoryDescUtils::isDenseByBatch(desc))
+        return false;
+    itemDims[0] = 1;
+    const auto itemDesc = desc.cloneWithNewDims(itemDims);
+    return std::all_of(batch.begin(), batch.end(), [&itemDesc](const ov::SoPtr<ITensor>& item) {
+        return MemoryDescUtils::generateCpuBlockedMemoryDesc(item)->isCompatible(*itemDesc);
+    });
+}
+
+void Graph::PushInputBatch(const std::string& name, const std::vector<ov::SoPtr<ITensor>>& batch) {
+    if (!IsReady()) OPENVINO_THROW("Wrong state. Topology not ready.");
+    auto input_itr = inputNodesMap.find(name);
+    if (input_itr == inputNodesMap.end())
+        OPENVINO_THROW("Input blob for infer '", name, "' doesn't correspond to input in network");
+
+    std::vector<const void*> items(batch.size());
+    std::transform(batch.begin(), batch.end(), items.begin(), [](const ov::SoPtr<ITensor>& item) {
+        return item->data();
+    });
+    std::static_pointer_cast<node::Input>(input_itr->second)->setBatchItems(std::move(items));
+}
+
 // suppose always being shared infer_request intel_cpu::Tensor to Graph if isDynamic.
 void Graph::PullOutputData(std::unordered_map<std::string, ov::SoPtr<ITensor>>& output) {
     if (!IsReady())
@@ -1053,18 +1180,63 @@ void Graph::PullOutputData(std::unordered_map<std::string, ov::SoPtr<ITensor>>&
 void Graph::InferStatic(SyncInferRequest* request) {
     dnnl::stream stream(getEngine());
 
+    if (!execWavesBounds.empty()) {
+        InferParallelWaves(request, stream);
+        return;
+    }
+
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, getConfig().debugCaps.verbose);
         PERF(node, getConfig().collectPerfCounters);
 
         if (request)
             request->throw_if_canceled();
+        RequestScheduler::preemption_point();
         ExecuteNode(node, stream);
     }
 }
 
+void Graph::InferParallelWaves(SyncInferRequest* request, const dnnl::stream& stream) {
+    for (size_t w = 1; w < execWavesBounds.size(); w++) {
+        const size_t waveStart = execWavesBounds[w - 1];
+        const size_t waveSize = execWavesBounds[w] - waveStart;
+
+        if (request)
+            request->throw_if_canceled();
+        RequestScheduler::preemption_point();
+
+        if (waveSize == 1) {
+            const auto& node = executableGraphNodes[waveStart];
+            VERBOSE(node, getConfig().debugCaps.verbose);
+            PERF(node, getConfig().collectPerfCounters);
+            ExecuteNode(node, stream);
+            continue;
+        }
+
+        // the nodes of the wave are independent, the inner parallel regions of the nodes are balanced by the threading runtime
+        parallel_for(waveSize, [&](size_t i) {
+            const auto& node = executableGraphNodes[waveStart + i];
+            VERBOSE(node, getConfig().debugCaps.verbose);
+            PERF(node, getConfig().collectPerfCounters);
+            // dnnl::stream is not thread safe, so every concurrent task uses its own one
+            dnnl::stream taskStream(getEngine());
+            ExecuteNode(node, taskStream);
+        });
+    }
+}
+
 namespace {
 
+// The output dims of the executable nodes cached for the current graph input shapes
+struct CachedOutputDims {
+    std::vector<std::vector<VectorDims>>* dims;
+    const std::vector<bool>& cacheable;
+
+    std::vector<VectorDims>* at(size_t nodeIndx) const {
+        return dims && cacheable[nodeIndx] ? &(*dims)[nodeIndx] : nullptr;
+    }
+};
+
 class IUpdateNodes {
 public:
     virtual void run(size_t stopIndx) = 0;
@@ -1073,12 +1245,13 @@ public:
 
 class UpdateNodesSeq : public IUpdateNodes {
 public:
-    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes) : m_executableGraphNodes(executableGraphNodes) {}
+    UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes, const CachedOutputDims& cachedDims)
+        : m_executableGraphNodes(executableGraphNodes), m_cachedDims(cachedDims) {}
     void run(size_t stopIndx) override {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                node->updateShapes(m_cachedDims.at(prepareCounter));
                 node->updateDynamicParams();
             }
         }
@@ -1087,6 +1260,7 @@ public:
 private:
     size_t prepareCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
+    CachedOutputDims m_cachedDims;
 };
 
 #if (OV_THREAD == OV_THREAD_SEQ)
@@ -1096,13 +1270,14 @@ private:
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_OMP)
 class UpdateNodesBase : public IUpdateNodes {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes) : m_executableGraphNodes(executableGraphNodes) {}
+    UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes, const CachedOutputDims& cachedDims)
+        : m_executableGraphNodes(executableGraphNodes), m_cachedDims(cachedDims) {}
     void updateShapes(size_t node_indx, size_t stop_indx) {
         try {
             for (size_t i = node_indx; i < stop_indx; i++) {
                 const auto& node = m_executableGraphNodes[i];
                 if (node->isDynamicNode()) {
-                    node->updateShapes();
+                    node->updateShapes(m_cachedDims.at(i));
                 }
                 m_prepareCounter.store(i, std::memory_order::memory_order_release);
             }
@@ -1136,6 +1311,7 @@ protected:
     std::atomic<size_t> m_prepareCounter{0};
     std::atomic<bool> m_completion{false};
     std::vector<NodePtr>& m_executableGraphNodes;
+    CachedOutputDims m_cachedDims;
 };
 
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
@@ -1258,6 +1434,17 @@ public:
 } // namespace
 
 
+size_t Graph::InputShapesKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& item : dims) {
+        seed = get_vector_hash(seed, item);
+    }
+    return seed;
+}
+
 void Graph::InferDynamic(SyncInferRequest* request) {
     dnnl::stream stream(getEngine());
 
@@ -1270,11 +1457,27 @@ void Graph::InferDynamic(SyncInferRequest* request) {
     }
     syncIndsWorkSet.insert(executableGraphNodes.size());
 
+    // the output dims of the nodes for the current input shapes, they are filled on the first inference with
+    // these shapes and reused later
+    InputShapesKey inputShapes;
+    inputShapes.dims.reserve(inputNodesMap.size());
+    for (const auto& input : inputNodesMap) {
+        const auto& node = input.second;
+        inputShapes.dims.push_back(node->getChildEdges().empty() ? VectorDims{}
+                                                                 : node->getChildEdgeAt(0)->getMemory().getStaticDims());
+    }
+    auto outputDims = outputDimsCache.get(inputShapes);
+    if (!outputDims) {
+        outputDims = std::make_shared<NodesOutputDims>(executableGraphNodes.size());
+        outputDimsCache.put(inputShapes, outputDims);
+    }
+    const CachedOutputDims cachedDims{outputDims.get(), cacheableOutputDims};
+
     std::unique_ptr<IUpdateNodes> updateNodes{};
     if (parallel_get_max_threads() > 1) {
-        updateNodes.reset(new UpdateNodes(executableGraphNodes));
+        updateNodes.reset(new UpdateNodes(executableGraphNodes, cachedDims));
     } else {
-        updateNodes.reset(new UpdateNodesSeq(executableGraphNodes));
+        updateNodes.reset(new UpdateNodesSeq(executableGraphNodes, cachedDims));
     }
     size_t inferCounter = 0;
 
@@ -1290,6 +1493,12 @@ void Graph::InferDynamic(SyncInferRequest* request) {
             ExecuteNode(node, stream);
         }
     }
+
+    // only the intermediate tensors are planned and they are not needed anymore, so the plan may be updated
+    // for the new shapes; the outputs and the states are kept in their own memory
+    if (dynamicMemPlanner) {
+        dynamicMemPlanner->update();
+    }
 }
 
 inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const {
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include "cache/lru_cache.h"
 #include "config.h"
 #include "cpu_memory.h"
+#include "dynamic_mem_planner.h"
 #include "openvino/runtime/profiling_info.hpp"
 #include "node.h"
 #include "edge.h"
@@ -59,6 +61,12 @@ public:
                      std::string name);
 
     void PushInputData(const std::string& name, const ov::SoPtr<ITensor>& input);
+    /**
+     * @brief Checks if all the consumers of the input can read the batch items from their own buffers,
+     * so the items don't have to be gathered into one tensor
+     */
+    bool CanPushInputBatch(const std::string& name, const std::vector<ov::SoPtr<ITensor>>& batch) const;
+    void PushInputBatch(const std::string& name, const std::vector<ov::SoPtr<ITensor>>& batch);
     void PullOutputData(std::unordered_map<std::string, ov::SoPtr<ITensor>>& output);
 
     void Infer(SyncInferRequest* request = nullptr);
@@ -188,6 +196,11 @@ public:
     }
 
     Status getStatus() const {return status;}
+
+    /**
+     * @brief Adds the bytes of the memory arenas of the graph resident on every numa node to bytesPerNode
+     */
+    void countNumaResidentBytes(std::map<int, size_t>& bytesPerNode) const;
     const std::unordered_map<std::string, std::shared_ptr<node::MemoryStateNode>>&
     getInternalStateNodes() const {
         return internalStateNodes;
@@ -203,6 +216,10 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         syncNodesInds.clear();
+        outputDimsCache.evict(outputDimsCache.getCapacity());
+        cacheableOutputDims.clear();
+        execWaves.clear();
+        execWavesBounds.clear();
     }
     Status status { Status::NotReady };
 
@@ -213,6 +230,7 @@ protected:
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
+    DynamicMemoryPlanner::Ptr dynamicMemPlanner;
 
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
@@ -229,6 +247,7 @@ protected:
     void ResolveEdgeConflicts();
     void ResolveComplexInplaceConflicts();
     bool ProcessDynNodes();
+    void SplitIntoParallelWaves();
     void Allocate();
     void AllocateWithReuse();
     void ExtractExecutableNodes();
@@ -236,6 +255,7 @@ protected:
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void CreatePrimitivesAndExecConstants() const;
     void InferStatic(SyncInferRequest* request);
+    void InferParallelWaves(SyncInferRequest* request, const dnnl::stream& stream);
     void InferDynamic(SyncInferRequest* request);
 
     friend class intel_cpu::SyncInferRequest;
@@ -256,6 +276,28 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // Dynamic shapes: the output dims of the executable nodes cached per the graph input shapes, so the shape inference
+    // is skipped when the input shapes repeat. Only the nodes which output shapes are defined by the graph input shapes
+    // (not by the data or the state) are cached, see cacheableOutputDims.
+    struct InputShapesKey {
+        std::vector<VectorDims> dims;
+
+        size_t hash() const;
+        bool operator==(const InputShapesKey& rhs) const {
+            return dims == rhs.dims;
+        }
+    };
+    using NodesOutputDims = std::vector<std::vector<VectorDims>>;
+    static constexpr size_t outputDimsCacheCapacity = 64;
+    LruCache<InputShapesKey, std::shared_ptr<NodesOutputDims>> outputDimsCache{outputDimsCacheCapacity};
+    std::vector<bool> cacheableOutputDims;
+
+    // Parallel branches mode: the wave (the length of the longest path from the graph inputs) of each node
+    // and the boundaries of the waves in executableGraphNodes. Nodes of the same wave are independent
+    // from each other and may be executed concurrently.
+    std::unordered_map<const Node*, int> execWaves;
+    std::vector<size_t> execWavesBounds;
+
     GraphContext::CPtr context;
 
     void EnforceInferencePrecision();
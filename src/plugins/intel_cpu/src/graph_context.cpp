@@ -12,5 +12,13 @@ const dnnl::engine& GraphContext::getEngine() {
     return eng;
 }
 
+DnnlScratchPadPtr GraphContext::getScratchPad(size_t lane) const {
+    std::lock_guard<std::mutex> lock(rtScratchPadsMutex);
+    while (rtScratchPads.size() <= lane) {
+        rtScratchPads.emplace_back(std::make_shared<DnnlScratchPad>(getEngine()));
+    }
+    return rtScratchPads[lane];
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -5,10 +5,15 @@
 #pragma once
 
 #include "cache/multi_cache.h"
+#include "cache/shared_multi_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
+#include "packed_weights.h"
 #include "weights_cache.hpp"
 
+#include <mutex>
+#include <vector>
+
 namespace ov {
 namespace intel_cpu {
 
@@ -19,12 +24,20 @@ public:
 
     GraphContext(const Config& config,
                  WeightsSharing::Ptr w_cache,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 PackedWeights::CPtr packedWeights = nullptr,
+                 SharedMultiCachePtr socketCache = nullptr,
+                 int numaNodeId = -1)
         : config(config),
           weightsCache(w_cache),
-          isGraphQuantizedFlag(isGraphQuantized) {
+          packedWeights(std::move(packedWeights)),
+          socketCache(std::move(socketCache)),
+          isGraphQuantizedFlag(isGraphQuantized),
+          numaNodeId(numaNodeId) {
         rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
-        rtScratchPad = std::make_shared<DnnlScratchPad>(getEngine());
+        if (!this->socketCache)
+            this->socketCache = std::make_shared<SharedMultiCache>(config.rtCacheCapacity);
+        rtScratchPads.emplace_back(std::make_shared<DnnlScratchPad>(getEngine()));
     }
 
     const Config& getConfig() const {
@@ -35,30 +48,59 @@ public:
         return weightsCache;
     }
 
+    /**
+     * @brief Returns the weights packed by the graph the model cache blob was exported from, nullptr if there are none
+     */
+    PackedWeights::CPtr getPackedWeights() const {
+        return packedWeights;
+    }
 
     MultiCachePtr getParamsCache() const {
         return rtParamsCache;
     }
 
-    DnnlScratchPadPtr getScratchPad() const {
-        return rtScratchPad;
+    /**
+     * @brief Returns the cache shared with the graphs of the other streams on the same socket.
+     * Unlike the params cache, it may hold only the values which are never modified after the creation.
+     */
+    SharedMultiCachePtr getSocketCache() const {
+        return socketCache;
     }
 
+    /**
+     * @brief Returns the scratch pad of the given lane.
+     * Nodes which may be executed concurrently (see ov::intel_cpu::enable_parallel_branches) are assigned
+     * to different lanes, so they never share the scratch pad memory.
+     */
+    DnnlScratchPadPtr getScratchPad(size_t lane = 0) const;
+
     static const dnnl::engine& getEngine();
 
     bool isGraphQuantized() const {
         return isGraphQuantizedFlag;
     }
 
+    /**
+     * @brief Returns the original (OS) id of the numa node of the stream the graph is created for,
+     * -1 if the memory of the graph doesn't need to be placed explicitly.
+     */
+    int getNumaNodeId() const {
+        return numaNodeId;
+    }
+
 private:
     Config config;  // network-level config
 
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    PackedWeights::CPtr packedWeights;        // packed weights imported from the model cache
 
     MultiCachePtr rtParamsCache;     // primitive cache
-    DnnlScratchPadPtr rtScratchPad;  // scratch pad
+    SharedMultiCachePtr socketCache;  // immutable kernels shared by the streams on the socket
+    mutable std::vector<DnnlScratchPadPtr> rtScratchPads;  // scratch pads, one per parallel lane
+    mutable std::mutex rtScratchPadsMutex;
 
     bool isGraphQuantizedFlag = false;
+    int numaNodeId = -1;  // the memory arenas of the graph are placed on this numa node
 };
 
 }  // namespace intel_cpu
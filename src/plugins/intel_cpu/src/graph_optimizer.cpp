@@ -10,6 +10,7 @@
 #include "nodes/conv.h"
 #include "nodes/deconv.h"
 #include "nodes/eltwise.h"
+#include "nodes/embedding_bag_sum.h"
 #include "nodes/fake_quantize.h"
 #include "nodes/fullyconnected.h"
 #include "nodes/gather.h"
@@ -76,6 +77,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseGatherAndWeightsDecompression(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndWeightsDecompression");
+    FuseEmbeddingBagAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulDeconvAndBias(graph);
     graph.RemoveDroppedNodes();
@@ -609,6 +614,111 @@ void GraphOptimizer::FuseGatherAndWeightsDecompression(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseEmbeddingBagAndWeightsDecompression(Graph &graph) {
+    std::set<ov::element::Type> supportedWeightsPrecisions{ov::element::u8, ov::element::i8};
+    auto expectedNode = [](NodePtr node, Type expectedType) {
+        return node->getType() == expectedType && node->getChildEdges().size() == 1;
+    };
+
+    auto& graphNodes = graph.GetNodes();
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto& embeddingNode = graphNodes[i];
+        const auto embeddingBagNode = dynamic_cast<node::EmbeddingBagSum*>(embeddingNode.get());
+        if (embeddingBagNode == nullptr)
+            continue;
+
+        // Multiply
+        const auto multiplyNode = embeddingNode->getParentEdgeAt(0)->getParent();
+        if (!expectedNode(multiplyNode, Type::Eltwise) || multiplyNode->getAlgorithm() != Algorithm::EltwiseMultiply ||
+            !multiplyNode->isConstant())
+            continue;
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseEmbeddingBagAndWeightsDecompression);
+        const auto multiplyConstNode = multiplyNode->getParentEdgeAt(1)->getParent();
+        if (!expectedNode(multiplyConstNode, Type::Input))
+            continue;
+
+        // Subtract is optional, the symmetrically quantized table has no zero points
+        const auto mulParent = multiplyNode->getParentEdgeAt(0)->getParent();
+        NodePtr subtractNode = nullptr;
+        NodePtr subtractConstNode = nullptr;
+        NodePtr convertNode = mulParent;
+        if (expectedNode(mulParent, Type::Eltwise) && mulParent->getAlgorithm() == Algorithm::EltwiseSubtract) {
+            subtractNode = mulParent;
+            subtractConstNode = subtractNode->getParentEdgeAt(1)->getParent();
+            if (!expectedNode(subtractConstNode, Type::Input))
+                continue;
+            convertNode = subtractNode->getParentEdgeAt(0)->getParent();
+        }
+
+        if (!expectedNode(convertNode, Type::Convert))
+            continue;
+        const auto weightsNode = convertNode->getParentEdgeAt(0)->getParent();
+        if (!expectedNode(weightsNode, Type::Input))
+            continue;
+
+        // Precision limitations
+        if (supportedWeightsPrecisions.find(weightsNode->getOriginalOutputPrecisionAtPort(0)) == supportedWeightsPrecisions.end())
+            continue;
+
+        // Shape limitations
+        const auto weightsShape = weightsNode->getOutputShapeAtPort(0);
+        if (weightsShape != multiplyNode->getOutputShapeAtPort(0))
+            continue;
+        if (weightsShape.getRank() < 2u || !weightsShape.isStatic())
+            continue;
+
+        // Should be [num_emb, 1, ..., 1], one scale and zero point per row of the table
+        VectorDims decompressionConstShape(weightsShape.getRank(), 1);
+        decompressionConstShape[0] = weightsShape.getDims()[0];
+
+        auto check_decompression_shape = [&decompressionConstShape](const VectorDims& shape_to_check) {
+            if (shape_to_check.size() != decompressionConstShape.size())
+                return false;
+            return std::equal(shape_to_check.begin(), shape_to_check.end(), decompressionConstShape.begin());
+        };
+        if (!check_decompression_shape(multiplyConstNode->getOutputShapeAtPort(0).getDims()))
+            continue;
+        if (subtractConstNode && !check_decompression_shape(subtractConstNode->getOutputShapeAtPort(0).getDims()))
+            continue;
+
+        // Fusion processing
+        auto *multiplyInputNode = dynamic_cast<node::Input *>(multiplyConstNode.get());
+        if (!multiplyInputNode) {
+            OPENVINO_THROW("Cannot cast ", multiplyConstNode->getName(), " to Input node.");
+        }
+        embeddingBagNode->fuseDecompressionMultiply(multiplyInputNode->getMemoryPtr());
+
+        if (subtractConstNode) {
+            auto *subtractInputNode = dynamic_cast<node::Input *>(subtractConstNode.get());
+            if (!subtractInputNode) {
+                OPENVINO_THROW("Cannot cast ", subtractConstNode->getName(), " to Input node.");
+            }
+            embeddingBagNode->fuseDecompressionSubtract(subtractInputNode->getMemoryPtr());
+        }
+
+        embeddingNode->addOriginalLayer(multiplyNode->getOriginalLayers());
+        embeddingNode->addOriginalLayer(convertNode->getOriginalLayers());
+
+        if (subtractNode) {
+            embeddingNode->addOriginalLayer(subtractNode->getOriginalLayers());
+            auto subtractConstEdge = subtractConstNode->getChildEdges()[0].lock();
+            graph.RemoveEdge(subtractConstEdge);
+        }
+
+        auto multiplyConstEdge = multiplyConstNode->getChildEdges()[0].lock();
+        graph.RemoveEdge(multiplyConstEdge);
+
+        graph.DropNode(convertNode);
+        if (subtractNode)
+            graph.DropNode(subtractNode);
+        graph.DropNode(multiplyNode);
+
+        const auto& weightsPrecision = weightsNode->getOriginalOutputPrecisionAtPort(0);
+        embeddingNode->setOriginalInputPrecisionAtPort(0, weightsPrecision);
+    }
+}
+
 void GraphOptimizer::FuseConvolutionMatMulDeconvAndBias(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
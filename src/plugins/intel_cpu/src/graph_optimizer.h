@@ -22,6 +22,7 @@ private:
     void FuseConvMatmulFCDeconvAndDQScales(Graph &graph);
     void FuseFCAndWeightsDecompression(Graph &graph);
     void FuseGatherAndWeightsDecompression(Graph &graph);
+    void FuseEmbeddingBagAndWeightsDecompression(Graph &graph);
     void FuseConvolutionMatMulDeconvAndBias(Graph &graph);
     void FuseDeconvolutionAndSimpleOperation(Graph &graph);
     void FuseMultiplyAndAdd(Graph &graph);
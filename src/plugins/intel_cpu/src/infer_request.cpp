@@ -60,6 +60,17 @@ void SyncInferRequest::create_infer_request() {
     for (auto&& node : m_graph->getInternalStateNodes()) {
         m_memory_states.emplace_back(node.second->makeState());
     }
+
+    if (m_compiled_model->m_kv_cache_block_pool) {
+        const auto block_size = m_compiled_model->m_cfg.kvCacheBlockSize;
+        for (auto&& state : m_memory_states) {
+            auto kv_state = std::dynamic_pointer_cast<VariableStateKVcache>(state);
+            // u8 cache keeps per token scales and zero points, it's not supported by the paged mode
+            if (kv_state && kv_state->internal_desc()->getPrecision() != ov::element::u8) {
+                kv_state->enable_paging(m_compiled_model->m_kv_cache_block_pool, block_size);
+            }
+        }
+    }
 }
 
 SyncInferRequest::~SyncInferRequest() {
@@ -341,6 +352,9 @@ ov::SoPtr<ov::ITensor> SyncInferRequest::get_tensor(const ov::Output<const ov::N
 
 std::vector<ov::SoPtr<ov::ITensor>> SyncInferRequest::get_tensors(const ov::Output<const ov::Node>& in_port) const {
     auto port = get_internal_port(in_port);
+    auto batched = m_batched_inputs.find(get_port_name(port, m_is_legacy_api));
+    if (batched != m_batched_inputs.end())
+        return batched->second;
     return ov::ISyncInferRequest::get_tensors(port);
 }
 
@@ -416,6 +430,7 @@ void SyncInferRequest::set_tensor(const ov::Output<const ov::Node>& in_port, con
         } else if (m_external_ptr.find(name) != m_external_ptr.end()) {
             m_external_ptr.erase(name);
         }
+        m_batched_inputs.erase(name);
     } else {
         const auto netOutPrc = port.get_element_type();
         if (netOutPrc != tensor->get_element_type()) {
@@ -464,7 +479,16 @@ void SyncInferRequest::set_tensor(const ov::Output<const ov::Node>& in_port, con
 void SyncInferRequest::set_tensors_impl(const ov::Output<const ov::Node> port, const std::vector<ov::SoPtr<ITensor>>& tensors) {
     for (const auto& input : get_inputs()) {
         if (input == port) {
-            m_batched_tensors[input.get_tensor_ptr()] = tensors;
+            // if the graph allows, the batch items are read from their own buffers,
+            // otherwise they are gathered into one tensor before each inference
+            const auto name = get_port_name(input, m_is_legacy_api);
+            if (m_graph->CanPushInputBatch(name, tensors)) {
+                m_batched_inputs[name] = tensors;
+                m_batched_tensors.erase(input.get_tensor_ptr());
+            } else {
+                m_batched_inputs.erase(name);
+                m_batched_tensors[input.get_tensor_ptr()] = tensors;
+            }
             return;
         }
     }
@@ -636,6 +660,11 @@ void SyncInferRequest::push_input_data() {
             OPENVINO_THROW("Input tensor map contains not registered during IPlugin::compile_model tensor with name ",
                            input_name);
         }
+        auto batched = m_batched_inputs.find(input_name);
+        if (batched != m_batched_inputs.end()) {
+            m_graph->PushInputBatch(input_name, batched->second);
+            continue;
+        }
         auto tensor = get_tensor(input);
         m_graph->PushInputData(input_name, tensor);
     }
@@ -121,6 +121,8 @@ private:
     std::unordered_map<std::string, ov::Output<const ov::Node>> m_input_ports_map;
     std::unordered_map<std::string, ov::Output<const ov::Node>> m_output_ports_map;
     std::unordered_map<std::string, ov::SoPtr<ov::ITensor>> m_outputs;
+    // the inputs set by several tensors which the graph consumes without gathering them into one tensor
+    std::unordered_map<std::string, std::vector<ov::SoPtr<ov::ITensor>>> m_batched_inputs;
 };
 
 }  // namespace intel_cpu
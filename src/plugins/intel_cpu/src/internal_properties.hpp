@@ -21,6 +21,65 @@ static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_cap
  */
 static constexpr Property<bool, PropertyMutability::RW> lp_transforms_mode{"LP_TRANSFORMS_MODE"};
 
+/**
+ * @brief Enables concurrent execution of independent graph branches within a single stream.
+ * Nodes are grouped into waves of mutually independent nodes which are dispatched as parallel tasks on the stream
+ * threads. Applies to graphs with static shapes only.
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_parallel_branches{"CPU_ENABLE_PARALLEL_BRANCHES"};
+
+/**
+ * @brief Number of tokens in a block of the paged KV cache used by the fused ScaledDotProductAttention states.
+ * The blocks are taken from a pool shared by all the infer requests of a compiled model, so the cache grows without
+ * reallocation and copying of the cached tokens. 0 (default) keeps the contiguous KV cache.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> kv_cache_block_size{"CPU_KV_CACHE_BLOCK_SIZE"};
+
+/**
+ * @brief Returns the compiled model as soon as the graph of the first stream is created, the graphs of the other
+ * streams are created by a background task. Until then the infer requests are executed with the ready graphs.
+ */
+static constexpr Property<bool, PropertyMutability::RW> lazy_streams_compilation{"CPU_LAZY_STREAMS_COMPILATION"};
+
+/**
+ * @brief Priority of the infer requests of the compiled model.
+ * The pending requests of the higher priority are executed first, and the running ones pause the inference of
+ * the lower priority requests of all the compiled models of the process between the graph nodes.
+ * The requests of the compiled models which set neither the priority nor the deadline are not scheduled.
+ */
+static constexpr Property<ov::hint::Priority, PropertyMutability::RW> request_priority{"CPU_REQUEST_PRIORITY"};
+
+/**
+ * @brief Latency budget of an infer request of the compiled model in milliseconds, the deadline of a request is
+ * the time it is started plus the budget. The pending requests of the same priority are executed in the earliest
+ * deadline first order. 0 (default) - no deadline.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> request_deadline{"CPU_REQUEST_DEADLINE"};
+
+/**
+ * @brief Bytes of the memory of the compiled model resident on every numa node, by the original (OS) numa node ids.
+ * "weights.<node>" - the weights copied to the caches of the sockets, "activations.<node>" - the memory arenas of
+ * the graphs of the streams, "local" and "remote" - the bytes resident on the numa node of the socket or the stream
+ * using them and on the other numa nodes. The pages of the big buffers are sampled, so the numbers are estimates.
+ * The weights caches are shared by all the models compiled with the same ov::internal::weights_sharing_id,
+ * so the weights figures include the weights of all of them.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> numa_memory_usage{
+    "CPU_NUMA_MEMORY_USAGE"};
+
+/**
+ * @brief Number of the kernels generated by the compiled model and shared by the streams on the sockets (the Snippets
+ * code). E.g. the code of the dynamic element-wise Subgraphs is generated once per broadcasting pattern of the shapes.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> shared_kernels_number{"CPU_SHARED_KERNELS_NUMBER"};
+
+/**
+ * @brief Number of the weights found in the weights caches of the sockets instead of being created. The caches are
+ * shared by the models compiled with the same ov::internal::weights_sharing_id, so the weights created by one of them
+ * are found by the others.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> weights_cache_hits{"CPU_WEIGHTS_CACHE_HITS"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
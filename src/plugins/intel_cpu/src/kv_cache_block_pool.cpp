@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache_block_pool.h"
+
+#include <common/utils.hpp>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+KVCacheBlockPool::Block KVCacheBlockPool::allocate(size_t block_bytes) {
+    OPENVINO_ASSERT(block_bytes > 0, "KV cache block size must be positive");
+    uint8_t* ptr = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& size_class = m_size_classes[block_bytes];
+        if (size_class.free_blocks.empty()) {
+            constexpr int cacheLineSize = 64;
+            const size_t slab_bytes = block_bytes * blocks_per_slab;
+            auto slab_ptr = static_cast<uint8_t*>(dnnl::impl::malloc(slab_bytes, cacheLineSize));
+            if (!slab_ptr) {
+                OPENVINO_THROW("Failed to allocate ", slab_bytes, " bytes of memory for the KV cache");
+            }
+            size_class.slabs.emplace_back(slab_ptr, [](uint8_t* p) {
+                dnnl::impl::free(p);
+            });
+            for (size_t i = blocks_per_slab; i > 0; i--) {
+                size_class.free_blocks.push_back(slab_ptr + (i - 1) * block_bytes);
+            }
+            m_allocated_bytes += slab_bytes;
+        }
+        ptr = size_class.free_blocks.back();
+        size_class.free_blocks.pop_back();
+        m_used_bytes += block_bytes;
+    }
+
+    auto pool = shared_from_this();
+    return Block(ptr, [pool, block_bytes](uint8_t* p) {
+        pool->release(block_bytes, p);
+    });
+}
+
+void KVCacheBlockPool::release(size_t block_bytes, uint8_t* ptr) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_size_classes[block_bytes].free_blocks.push_back(ptr);
+    m_used_bytes -= block_bytes;
+}
+
+size_t KVCacheBlockPool::allocated_bytes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_allocated_bytes;
+}
+
+size_t KVCacheBlockPool::used_bytes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_used_bytes;
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
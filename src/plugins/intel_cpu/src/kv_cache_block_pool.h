@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Fixed size blocks allocator for the paged KV cache.
+ * The blocks are carved out of bigger slabs and go back to the pool free list (not to the system) when the last
+ * reference to a block is dropped. The pool is thread safe, so it may be shared by all the infer requests of
+ * a compiled model.
+ */
+class KVCacheBlockPool : public std::enable_shared_from_this<KVCacheBlockPool> {
+public:
+    using Ptr = std::shared_ptr<KVCacheBlockPool>;
+    using Block = std::shared_ptr<uint8_t>;
+
+    /**
+     * @brief Takes a block of block_bytes size from the pool.
+     * The block is returned to the pool when the last copy of the returned pointer is destroyed.
+     */
+    Block allocate(size_t block_bytes);
+
+    // total size of the slabs owned by the pool
+    size_t allocated_bytes() const;
+    // total size of the blocks which are currently in use
+    size_t used_bytes() const;
+
+private:
+    void release(size_t block_bytes, uint8_t* ptr);
+
+    struct SizeClass {
+        std::vector<std::shared_ptr<uint8_t>> slabs;
+        std::vector<uint8_t*> free_blocks;
+    };
+
+    static constexpr size_t blocks_per_slab = 16;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<size_t, SizeClass> m_size_classes;
+    size_t m_allocated_bytes = 0;
+    size_t m_used_bytes = 0;
+};
+
+/**
+ * @brief Paged view of a K or V cache consumed by the attention kernels.
+ * Every block holds block_size tokens of one sequence laid out as [H, block_size, S]. The token l of the sequence b
+ * is stored in the block blocks[b * max_blocks + l / block_size].
+ */
+struct PagedKVCacheView {
+    uint8_t* const* blocks = nullptr;
+    size_t max_blocks = 0;
+    size_t block_size = 0;
+    size_t B = 0;
+    size_t H = 0;
+    size_t L = 0;
+    size_t S = 0;
+    ov::element::Type precision;
+
+    explicit operator bool() const {
+        return blocks != nullptr;
+    }
+
+    template <typename T>
+    T* ptr(size_t b, size_t h, size_t l) const {
+        return reinterpret_cast<T*>(blocks[b * max_blocks + l / block_size]) + (h * block_size + l % block_size) * S;
+    }
+
+    void* ptr_v(size_t b, size_t h, size_t l) const {
+        return blocks[b * max_blocks + l / block_size] + (h * block_size + l % block_size) * S * precision.size();
+    }
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
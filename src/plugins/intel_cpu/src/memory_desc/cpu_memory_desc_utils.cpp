@@ -10,6 +10,7 @@
 #include <vector>
 #include <cpu_memory.h>
 #include <dnnl_types.h>
+#include <algorithm>
 #include <numeric>
 #include <vector>
 
@@ -92,6 +93,21 @@ CpuBlockedMemoryDescPtr MemoryDescUtils::generateCpuBlockedMemoryDesc(const ov::
         blk_strides);
 }
 
+bool MemoryDescUtils::isDenseByBatch(const MemoryDesc& desc) {
+    if (!desc.isDefined() || desc.getShape().getRank() == 0 || !(desc.getType() & MemoryDescType::Blocked) ||
+        desc.getOffsetPadding() != 0)
+        return false;
+
+    const auto blockedDesc = desc.as<BlockedMemoryDesc>();
+    const auto& order = blockedDesc->getOrder();
+    // the batch must be the outermost dim and must not be blocked
+    if (order.front() != 0 || std::count(order.begin(), order.end(), 0) != 1)
+        return false;
+
+    const auto batch = desc.getShape().getStaticDims().front();
+    return blockedDesc->getStrides().front() * batch == blockedDesc->getPaddedElementsCount();
+}
+
 std::string MemoryDescUtils::dim2str(Dim dim) {
     return dim == Shape::UNDEFINED_DIM ? "?" : std::to_string(dim);
 }
@@ -53,6 +53,14 @@ public:
      */
     static std::shared_ptr<CpuBlockedMemoryDesc> generateCpuBlockedMemoryDesc(const ov::SoPtr<ov::ITensor>& tensor);
 
+    /**
+     * @brief Checks if the memory of the descriptor is a sequence of dense batch items, i.e. the item n
+     * starts at n * (item size) and has the layout of the same descriptor with the batch equal to 1
+     * @param desc MemoryDesc to be checked
+     * @return true if the batch items follow each other without gaps
+     */
+    static bool isDenseByBatch(const MemoryDesc& desc);
+
     static constexpr Dim DEFAULT_DUMMY_VAL = 64;
 
     /**
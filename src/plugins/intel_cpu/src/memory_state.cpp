@@ -12,7 +12,9 @@
 #include "utils/plain_tensor.hpp"
 #include "openvino/core/parallel.hpp"
 #include "nodes/common/cpu_convert.h"
+#include "nodes/common/cpu_memcpy.h"
 #include "nodes/kernels/scaled_attn/attn_quant.hpp"
+#include "utils/general_utils.h"
 
 using namespace ov::Extensions::Cpu::XARCH;
 
@@ -155,6 +157,105 @@ MemoryPtr VariableStateDoubleBuffer::internal_state_mem() const {
     return prime_mem();
 }
 
+namespace {
+/**
+ * @brief The state tensor of a paged KV cache.
+ * Holds the references to the cache blocks and a copy of the beam table instead of the dense data, so setting it to
+ * a state of another infer request forks the cache without copying: the blocks are shared and copied only when
+ * one of the owners writes to them. The dense data is gathered at the first data() call.
+ */
+class PagedKVCacheStateTensor : public ITensor {
+public:
+    PagedKVCacheStateTensor(const dnnl::engine& engine, const MemoryDescPtr& desc)
+        : m_engine(engine),
+          m_desc(desc),
+          m_element_type(desc->getPrecision()),
+          m_shape(desc->getShape().getStaticDims()) {
+        auto&& strides = desc->as<BlockedMemoryDesc>()->getStrides();
+        m_strides.resize(strides.size());
+        std::transform(strides.cbegin(), strides.cend(), m_strides.begin(), [this](const size_t stride) {
+            return stride * m_element_type.size();
+        });
+    }
+
+    void set_shape(ov::Shape shape) override {
+        OPENVINO_THROW("The shape of a KV cache state tensor can't be changed");
+    }
+
+    const ov::element::Type& get_element_type() const override {
+        return m_element_type;
+    }
+
+    const ov::Shape& get_shape() const override {
+        return m_shape;
+    }
+
+    const ov::Strides& get_strides() const override {
+        return m_strides;
+    }
+
+    void* data(const element::Type& element_type = {}) const override {
+        if (element_type != element::undefined && element_type != element::dynamic) {
+            OPENVINO_ASSERT(element_type == get_element_type(),
+                            "Tensor data with element type ",
+                            get_element_type(),
+                            ", is not representable as pointer to ",
+                            element_type);
+        }
+        std::lock_guard<std::mutex> lock(m_lock);
+        if (!m_dense_mem) {
+            m_dense_mem = std::make_shared<Memory>(m_engine, m_desc);
+            std::vector<uint8_t*> block_ptrs;
+            auto view = make_view(block_ptrs);
+            PlainTensor output;
+            output.reset(m_dense_mem);
+            output = output.permute(order);
+            parallel_for3d(view.B, view.H, view.L, [&](size_t b, size_t h, size_t m) {
+                auto b_kv = static_cast<size_t>(beam_table[b * view.L + m]);
+                cpu_convert(view.ptr_v(b_kv, h, m), output.ptr_v(b, h, m), view.precision, output.m_dt, view.S);
+            });
+        }
+        return m_dense_mem->getData();
+    }
+
+    PagedKVCacheView make_view(std::vector<uint8_t*>& block_ptrs) const {
+        PagedKVCacheView view;
+        view.max_blocks = blocks.empty() ? 0 : blocks.front().size();
+        block_ptrs.resize(blocks.size() * view.max_blocks);
+        for (size_t b = 0; b < blocks.size(); b++) {
+            for (size_t i = 0; i < view.max_blocks; i++) {
+                block_ptrs[b * view.max_blocks + i] = blocks[b][i].get();
+            }
+        }
+        view.blocks = block_ptrs.data();
+        view.block_size = block_size;
+        view.B = dims[0];
+        view.H = dims[1];
+        view.L = dims[2];
+        view.S = dims[3];
+        view.precision = precision;
+        return view;
+    }
+
+    // the cache snapshot, dims are in the internal [B, H, L, S] order
+    std::vector<std::vector<KVCacheBlockPool::Block>> blocks;
+    std::vector<int32_t> beam_table;
+    VectorDims dims;
+    VectorDims order;
+    size_t block_size = 0;
+    ov::element::Type precision;
+
+private:
+    dnnl::engine m_engine;
+    MemoryDescPtr m_desc;
+    ov::element::Type m_element_type;
+    ov::Shape m_shape;
+    ov::Strides m_strides;
+    mutable MemoryPtr m_dense_mem;
+    mutable std::mutex m_lock;
+};
+}  // namespace
+
 VariableStateKVcache::VariableStateKVcache(
     const std::string& name,
     const MemoryDescPtr& external_desc,
@@ -176,7 +277,6 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
     auto&& dims = actual_internal_desc->getShape().getStaticDims();
 
     auto actual_external_desc = get_external_desc()->cloneWithNewDims(dims);
-    auto external_mem = std::make_shared<Memory>(get_engine(), actual_external_desc);
 
     // let's assume 4th rank KV tensors. This may be extended later
     OPENVINO_ASSERT(actual_internal_desc->getShape().getRank() == 4);
@@ -186,11 +286,31 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
     //sanity check
     OPENVINO_ASSERT(actual_internal_order == m_dense_internal_desc->getOrder());
 
+    if (is_paged()) {
+        // no copy here, the tensor shares the blocks with this state
+        auto tensor = std::make_shared<PagedKVCacheStateTensor>(get_engine(), actual_external_desc);
+        tensor->blocks = m_blocks;
+        tensor->dims.assign(std::begin(m_paged_dims), std::end(m_paged_dims));
+        tensor->order = actual_internal_order;
+        tensor->block_size = m_block_size;
+        tensor->precision = m_dense_internal_desc->getPrecision();
+        PlainTensor beam_table;
+        beam_table.reset(m_hidden_state);
+        const auto B = m_paged_dims[0];
+        const auto L = m_paged_dims[2];
+        tensor->beam_table.resize(B * L);
+        for (size_t b = 0; b < B; b++) {
+            std::copy_n(beam_table.ptr<int32_t>(b), L, tensor->beam_table.begin() + b * L);
+        }
+        return tensor;
+    }
+
+    auto external_mem = std::make_shared<Memory>(get_engine(), actual_external_desc);
     PlainTensor output, pastkv, beam_table;
     output.reset(external_mem);
     beam_table.reset(m_hidden_state);
-    pastkv.reset(m_internal_mem);
     output = output.permute(actual_internal_order);
+    pastkv.reset(m_internal_mem);
     pastkv = pastkv.permute(actual_internal_order);
     // S should be always the last dimension
     OPENVINO_ASSERT(pastkv.stride(3) == 1 && output.stride(3) == 1);
@@ -230,6 +350,27 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
 }
 
 void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
+    if (is_paged()) {
+        auto snapshot = std::dynamic_pointer_cast<PagedKVCacheStateTensor>(state._ptr);
+        if (snapshot && snapshot->block_size == m_block_size &&
+            snapshot->precision == m_dense_internal_desc->getPrecision() &&
+            snapshot->order == m_dense_internal_desc->getOrder()) {
+            // fork: share the blocks of the snapshot, they will be copied on write
+            m_blocks = snapshot->blocks;
+            std::copy(snapshot->dims.begin(), snapshot->dims.end(), std::begin(m_paged_dims));
+            paged_update_tables();
+
+            const size_t size_B = m_paged_dims[0];
+            const size_t size_L = m_paged_dims[2];
+            auto mem_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32, Shape{size_B, size_L});
+            m_hidden_state = std::make_shared<Memory>(get_engine(), mem_desc);
+            std::copy(snapshot->beam_table.begin(), snapshot->beam_table.end(), m_hidden_state->getDataAs<int32_t>());
+            m_internal_mem_max_size = size_B * m_paged_dims[1] * size_L * m_paged_dims[3];
+            m_hidden_state_max_size = size_B * size_L;
+            return;
+        }
+    }
+
     //1. reset the memory object
     m_state = state; // simply to extend the lifetime
     auto state_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(m_state);
@@ -237,10 +378,27 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     //May be optimized by reusing the state tensor underlining memory pointer, but corner cases should be considered
     auto dense_internal_desc = m_dense_internal_desc->cloneWithNewDims(state_desc->getShape().getStaticDims());
 
-    m_internal_mem = std::make_shared<Memory>(get_engine(), dense_internal_desc);
+    if (!is_paged()) {
+        m_internal_mem = std::make_shared<Memory>(get_engine(), dense_internal_desc);
+    }
     Memory external_mem(get_engine(), state_desc, m_state->data());
 
-    if (dense_internal_desc->getPrecision() == element::u8) {
+    if (is_paged()) {
+        PlainTensor external;
+        auto&& actual_internal_order = m_dense_internal_desc->getOrder();
+        external.resize(external_mem.getStaticDims(), state_desc->getPrecision().size(), state_desc->getPrecision(), m_state->data());
+        external = external.permute(actual_internal_order);
+        paged_clear();
+        paged_resize(external.size(0), external.size(1), external.size(2), external.size(3));
+        auto view = paged_view();
+        parallel_for3d(view.B, view.H, view.L, [&](size_t b, size_t h, size_t m) {
+            cpu_convert(external.ptr_v(b, h, m),
+                        view.ptr_v(b, h, m),
+                        external.m_dt,
+                        view.precision,
+                        view.S);
+        });
+    } else if (dense_internal_desc->getPrecision() == element::u8) {
         PlainTensor external, internal;
         auto&& actual_internal_order = m_dense_internal_desc->getOrder();
         external.resize(external_mem.getStaticDims(), state_desc->getPrecision().size(), state_desc->getPrecision(), m_state->data());
@@ -291,7 +449,9 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
 }
 
 void VariableStateKVcache::reset_impl() {
-    //nothing to do
+    if (is_paged()) {
+        paged_clear();
+    }
 }
 
 void VariableStateKVcache::commit_impl() {
@@ -325,5 +485,103 @@ MemoryPtr VariableStateKVcache::hidden_state_mem() const {
 void VariableStateKVcache::assign_hidden_state(const MemoryPtr& mem) {
     m_hidden_state = mem;
 }
+
+void VariableStateKVcache::enable_paging(const KVCacheBlockPool::Ptr& pool, size_t block_size) {
+    OPENVINO_ASSERT(pool && block_size > 0, "Paged KV cache requires a blocks pool and a positive block size");
+    OPENVINO_ASSERT(m_dense_internal_desc->getPrecision() != element::u8,
+                    "Paged KV cache doesn't support u8 precision, state: ", get_name());
+    m_block_pool = pool;
+    m_block_size = block_size;
+}
+
+void VariableStateKVcache::paged_resize(size_t B, size_t H, size_t L, size_t S) {
+    OPENVINO_ASSERT(is_paged(), "KV cache state ", get_name(), " is not paged");
+    if (m_paged_dims[1] != H || m_paged_dims[3] != S) {
+        // the layout of the blocks has changed, the stored tokens can't be reused
+        paged_clear();
+    }
+    const auto precision = m_dense_internal_desc->getPrecision();
+    const size_t block_bytes = H * m_block_size * S * precision.size();
+    const size_t num_blocks = div_up(L, m_block_size);
+
+    m_blocks.resize(B);
+    for (auto& sequence_blocks : m_blocks) {
+        if (sequence_blocks.size() > num_blocks) {
+            sequence_blocks.resize(num_blocks);
+        }
+        while (sequence_blocks.size() < num_blocks) {
+            sequence_blocks.push_back(m_block_pool->allocate(block_bytes));
+        }
+    }
+
+    m_paged_dims[0] = B;
+    m_paged_dims[1] = H;
+    m_paged_dims[2] = L;
+    m_paged_dims[3] = S;
+    paged_update_tables();
+}
+
+void VariableStateKVcache::paged_update_tables() {
+    const size_t B = m_paged_dims[0];
+    m_max_blocks = div_up(m_paged_dims[2], m_block_size);
+    m_block_ptrs.resize(B * m_max_blocks);
+    for (size_t b = 0; b < B; b++) {
+        for (size_t i = 0; i < m_max_blocks; i++) {
+            m_block_ptrs[b * m_max_blocks + i] = m_blocks[b][i].get();
+        }
+    }
+
+    // the graph sees only the dims of the cache, the data is accessed via the paged view
+    auto&& order = m_dense_internal_desc->getOrder();
+    VectorDims dims(4);
+    for (size_t i = 0; i < dims.size(); i++) {
+        dims[order[i]] = m_paged_dims[i];
+    }
+    m_internal_mem = std::make_shared<MemoryStub>(get_engine(), m_dense_internal_desc->cloneWithNewDims(dims));
+}
+
+void VariableStateKVcache::paged_prepare_write(size_t l_begin, size_t l_end) {
+    if (l_begin >= l_end) {
+        return;
+    }
+    const size_t block_bytes = m_paged_dims[1] * m_block_size * m_paged_dims[3] *
+                               m_dense_internal_desc->getPrecision().size();
+    bool copied = false;
+    for (auto& sequence_blocks : m_blocks) {
+        for (size_t i = l_begin / m_block_size; i < div_up(l_end, m_block_size); i++) {
+            auto& block = sequence_blocks[i];
+            // the block is shared with a snapshot or another request, copy it before the modification
+            if (block.use_count() > 1) {
+                auto private_block = m_block_pool->allocate(block_bytes);
+                cpu_memcpy(private_block.get(), block.get(), block_bytes);
+                block = std::move(private_block);
+                copied = true;
+            }
+        }
+    }
+    if (copied) {
+        paged_update_tables();
+    }
+}
+
+void VariableStateKVcache::paged_clear() {
+    m_blocks.clear();
+    m_block_ptrs.clear();
+    m_max_blocks = 0;
+    std::fill(std::begin(m_paged_dims), std::end(m_paged_dims), 0);
+}
+
+PagedKVCacheView VariableStateKVcache::paged_view() const {
+    PagedKVCacheView view;
+    view.blocks = m_block_ptrs.data();
+    view.max_blocks = m_max_blocks;
+    view.block_size = m_block_size;
+    view.B = m_paged_dims[0];
+    view.H = m_paged_dims[1];
+    view.L = m_paged_dims[2];
+    view.S = m_paged_dims[3];
+    view.precision = m_dense_internal_desc->getPrecision();
+    return view;
+}
 }  // namespace intel_cpu
 }  // namespace ov
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "cpu_memory.h"
+#include "kv_cache_block_pool.h"
 #include "memory_desc/blocked_memory_desc.h"
 #include "openvino/runtime/ivariable_state.hpp"
 #include "openvino/runtime/tensor.hpp"
@@ -136,12 +137,27 @@ public:
         m_scale_zp = t;
     }
 
+    // paged mode: K/V are stored in fixed size blocks from the shared pool, growth never copies the cached tokens
+    void enable_paging(const KVCacheBlockPool::Ptr& pool, size_t block_size);
+    bool is_paged() const {
+        return m_block_pool != nullptr;
+    }
+    // makes room for L tokens in every of B sequences, the dims are given in the internal [B, H, L, S] order
+    void paged_resize(size_t B, size_t H, size_t L, size_t S);
+    // gives back all the blocks to the pool
+    void paged_clear();
+    // copies the blocks holding the tokens [l_begin, l_end) if they are shared with other states (copy on write)
+    void paged_prepare_write(size_t l_begin, size_t l_end);
+    PagedKVCacheView paged_view() const;
+
 private:
     //ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
     void reset_impl() override;
     void commit_impl() override;
 
+    void paged_update_tables();
+
 private:
     MemoryPtr m_internal_mem; // kv cache
     MemoryPtr m_hidden_state; // beam access table
@@ -153,6 +169,14 @@ private:
 
     // for u8 kv cache: [B, H, L, 2], 0 for scale, 1 for zp
     PlainTensor m_scale_zp;
+
+    // paged mode: per sequence block tables and the flattened table of block pointers [B, max_blocks]
+    KVCacheBlockPool::Ptr m_block_pool;
+    size_t m_block_size = 0;
+    std::vector<std::vector<KVCacheBlockPool::Block>> m_blocks;
+    std::vector<uint8_t*> m_block_ptrs;
+    size_t m_max_blocks = 0;
+    size_t m_paged_dims[4] = {};
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
@@ -503,6 +503,14 @@ EdgePtr Node::getChildEdgeAt(size_t idx) const {
     return childEdgePtr;
 }
 
+const std::vector<const void*>& Node::getSrcBatchItemsAtPort(size_t idx) const {
+    static const std::vector<const void*> noItems;
+    const auto parent = getParentEdgeAt(idx)->getParent();
+    if (parent->getType() != Type::Input)
+        return noItems;
+    return std::static_pointer_cast<node::Input>(parent)->getBatchItems();
+}
+
 std::vector<EdgePtr> Node::getChildEdgesAtPort(int inputNum) const {
     if (inputNum < 0)
         OPENVINO_THROW("Node ", getName(), ". negative input number is not supported ", inputNum);
@@ -538,16 +546,23 @@ std::vector<memory::format_tag> Node::getAvailableFormatsForDims(const Shape &di
     return {memory::format_tag::any};
 }
 
-void Node::updateShapes() {
+void Node::updateShapes(std::vector<VectorDims>* outputDims) {
     OPENVINO_ASSERT(isDynamicNode(),
                     "Node::updateShapes() is called to a static shape node of type: ",
                     getTypeStr(),
                     " with name: ",
                     getName());
     if (needShapeInfer()) {
+        if (outputDims && !outputDims->empty()) {
+            redefineOutputMemory(*outputDims);
+            return;
+        }
         auto result = shapeInfer();
         if (ShapeInferStatus::success == result.status) {
             redefineOutputMemory(result.dims);
+            if (outputDims) {
+                *outputDims = std::move(result.dims);
+            }
         }
     }
 }
@@ -869,6 +884,12 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
     }
 
     auto create = [&] () {
+        if (auto packedWeights = context->getPackedWeights()) {
+            const auto key = PackedWeights::key(getName(), dstWeightDesc->serializeFormat(), dstWeightDesc->getPrecision());
+            if (auto packed = packedWeights->find(key, getEngine(), dstWeightDesc))
+                return packed;
+        }
+
         Memory srcMemory{ getEngine(), srcWeightDesc, edgeMem->getData() };
         MemoryPtr _ptr = std::make_shared<Memory>(getEngine(), dstWeightDesc);
         node::Reorder::reorderData(srcMemory, *_ptr, context->getParamsCache());
@@ -253,6 +253,12 @@ public:
         return getDstMemoryAtPort(idx)->getDataAs<T>();
     }
 
+    /**
+     * Returns the data pointers of the batch items of the input if the parent is a graph input
+     * set by several tensors which haven't been gathered into the input memory, otherwise an empty vector.
+     */
+    const std::vector<const void*>& getSrcBatchItemsAtPort(size_t idx) const;
+
     int inPlaceInputPort(int portIdx) const;
     int inPlaceOutPort(int portIdx) const;
 
@@ -271,6 +277,12 @@ public:
         return !hasEmptyInputTensors();
     }
 
+    // must be called only after Graph::Allocate()
+    // true if the node can read the batch items of the input from their own buffers (see getSrcBatchItemsAtPort())
+    virtual bool canReadBatchItems() const {
+        return false;
+    }
+
     enum class ConstantType {
         Const,          // Node is placed in a constant subgraph
         NoConst,        // Node is placed in a non-constant subgraph
@@ -358,6 +370,13 @@ public:
         return type;
     }
 
+    /**
+     * @brief Returns the weights the node has reordered into the layouts of the selected kernels, keyed by the format
+     */
+    const std::unordered_map<std::string, MemoryPtr>& getPrivateWeightCache() const {
+        return *privateWeightCache;
+    }
+
     const std::vector<NodeDesc>& getSupportedPrimitiveDescriptors() const {
         return supportedPrimitiveDescriptors;
     }
@@ -432,7 +451,12 @@ public:
     virtual void resolveInPlaceEdges(Edge::LOOK look = Edge::LOOK_BOTH);
 
     virtual void execute(dnnl::stream strm) = 0;
-    void updateShapes();
+    /**
+     * @brief Updates the output shapes for the current input shapes
+     * @param outputDims optional output dims cached for the current input shapes. If not empty, they are used instead
+     * of the shape inference, otherwise they are filled with the shape inference result
+     */
+    void updateShapes(std::vector<VectorDims>* outputDims = nullptr);
     void updateDynamicParams();
     void executeDynamic(dnnl::stream strm);
     virtual void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
@@ -470,6 +494,17 @@ public:
         return execIndex;
     }
 
+    /**
+     * @brief Assigns the scratch pad lane, so the nodes executed concurrently do not share the scratch pad memory.
+     */
+    void setScratchPadLane(size_t lane) {
+        scratchpadLane = lane;
+    }
+
+    size_t getScratchPadLane() const {
+        return scratchpadLane;
+    }
+
     const std::string & getTypeStr() const {
         return typeStr;
     }
@@ -762,7 +797,7 @@ protected:
 
     MemoryPtr getScratchPadMem(const DnnlMemoryDescPtr& desc) {
         if (!scratchpadMem || !scratchpadMem->getDesc().isCompatible(*desc)) {
-            scratchpadMem = context->getScratchPad()->createScratchPadMem(desc);
+            scratchpadMem = context->getScratchPad(scratchpadLane)->createScratchPadMem(desc);
         }
         return scratchpadMem;
     }
@@ -812,6 +847,7 @@ private:
     PerfCounters profiling;
 
     MemoryPtr scratchpadMem;
+    size_t scratchpadLane = 0;
 
     // Hold output scales
     std::vector<float> DQScales;
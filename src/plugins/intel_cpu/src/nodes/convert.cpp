@@ -6,6 +6,8 @@
 
 #include "common/blocked_desc_creator.h"
 #include "dnnl_extension_utils.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
+#include "nodes/common/cpu_convert.h"
 #include "openvino/opsets/opset1.hpp"
 #include "shape_inference/shape_inference_pass_through.hpp"
 
@@ -163,7 +165,25 @@ void Convert::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
+bool Convert::canReadBatchItems() const {
+    return MemoryDescUtils::isDenseByBatch(getParentEdgeAt(0)->getMemory().getDesc()) &&
+           MemoryDescUtils::isDenseByBatch(getChildEdgeAt(0)->getMemory().getDesc());
+}
+
 void Convert::execute(dnnl::stream strm) {
+    const auto& batchItems = getSrcBatchItemsAtPort(0);
+    if (!batchItems.empty()) {
+        // the layouts of the input and the output are the same, so each item is converted to its part of the output
+        auto dstMemPtr = getDstMemoryAtPort(0);
+        const auto itemSize = convertParams.size / batchItems.size();
+        const auto dstItemSize = dstMemPtr->getSize() / batchItems.size();
+        for (size_t i = 0; i < batchItems.size(); i++) {
+            cpu_convert(batchItems[i], dstMemPtr->getDataAs<uint8_t>() + i * dstItemSize,
+                        convertParams.srcPrc, convertParams.origPrc, convertParams.dstPrc, itemSize);
+        }
+        return;
+    }
+
     auto& parentMem = getParentEdgeAt(0)->getMemory();
     auto& childMem = getChildEdgeAt(0)->getMemory();
 
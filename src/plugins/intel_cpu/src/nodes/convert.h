@@ -26,6 +26,7 @@ public:
     bool canBeInPlace() const override {
         return false;
     }
+    bool canReadBatchItems() const override;
 
     // This is the interface extension designed to provide inp and output tensor descriptors without the CNNLayer.
     // In that case the Convert node is instantiated with default CNNLayer and inp/out tensor descriptors are set via this method.
@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <set>
 #include <vector>
 #include <string>
 #include "dnnl_types.h"
@@ -10,6 +13,12 @@
 #include "embedding_bag_sum.h"
 #include "openvino/opsets/opset1.hpp"
 #include "common/cpu_memcpy.h"
+#include "common/cpu_convert.h"
+#include "dnnl_extension_utils.h"
+#include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "utils/general_utils.h"
+
+using namespace dnnl::impl::cpu;
 
 namespace ov {
 namespace intel_cpu {
@@ -37,11 +46,83 @@ EmbeddingBagSum::EmbeddingBagSum(
     }
 }
 
+bool EmbeddingBagSum::hasKernel(const ov::element::Type& tablePrecision) const {
+#if defined(OPENVINO_ARCH_X86_64)
+    if (tablePrecision == ov::element::f16)
+        return x64::mayiuse(x64::avx2);
+    if (one_of(tablePrecision, ov::element::u8, ov::element::i8))
+        return _decompressionMultiplyPtr && x64::mayiuse(x64::sse41);
+    return one_of(tablePrecision, ov::element::f32, ov::element::bf16) && x64::mayiuse(x64::sse41);
+#else
+    return false;
+#endif // OPENVINO_ARCH_X86_64
+}
+
+void EmbeddingBagSum::initPrecisions(const ov::element::Type& originalTablePrecision) {
+    std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
+    static const std::set<ov::element::Type> supportedPrecisions =
+            {ov::element::f32, ov::element::i8, ov::element::u8, ov::element::i32};
+
+    _tablePrecision = originalTablePrecision;
+    _outputPrecision = originalTablePrecision;
+    if (_decompressionMultiplyPtr) {
+        if (!one_of(_tablePrecision, ov::element::u8, ov::element::i8))
+            OPENVINO_THROW(logPrefix, "has unsupported compressed table precision: ", _tablePrecision);
+        _outputPrecision = ov::element::f32;
+        return;
+    }
+    if (one_of(_tablePrecision, ov::element::bf16, ov::element::f16)) {
+        _outputPrecision = ov::element::f32;
+        // the kernel converts the gathered rows, so the whole table isn't converted to f32
+        if (!hasKernel(_tablePrecision))
+            _tablePrecision = ov::element::f32;
+        return;
+    }
+    if (supportedPrecisions.find(_tablePrecision) == supportedPrecisions.end())
+        OPENVINO_THROW(logPrefix, "has unsupported precision: ", _tablePrecision);
+}
+
+impl_desc_type EmbeddingBagSum::getImplType() const {
+#if defined(OPENVINO_ARCH_X86_64)
+    if (hasKernel(_tablePrecision)) {
+        if (x64::mayiuse(x64::avx512_core))
+            return impl_desc_type::jit_avx512;
+        if (x64::mayiuse(x64::avx2))
+            return impl_desc_type::jit_avx2;
+        return impl_desc_type::jit_sse42;
+    }
+#endif // OPENVINO_ARCH_X86_64
+    return impl_desc_type::ref_any;
+}
+
 void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
+    const auto prevEmbDepth = _embDepth;
     _embDepth = 1lu;
     for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+#if defined(OPENVINO_ARCH_X86_64)
+    if (_kernel && prevEmbDepth == _embDepth)
+        return;
+    _kernel = nullptr;
+    // the kernel addresses the rows with 32-bit offsets
+    if (!hasKernel(_tablePrecision) || _embDepth == 0lu ||
+        _embDepth * _tablePrecision.size() > static_cast<size_t>(std::numeric_limits<int>::max()))
+        return;
+
+    kernel::EmbeddingBagSumCompileParams jcp;
+    jcp.src_prc = _tablePrecision;
+    jcp.emb_depth = _embDepth;
+    jcp.with_weights = _withWeights;
+    jcp.with_scales = _decompressionMultiplyPtr != nullptr;
+    jcp.with_zero_points = _decompressionSubtractPtr != nullptr;
+
+    _kernel = kernel::JitKernel<kernel::EmbeddingBagSumCompileParams, kernel::EmbeddingBagSumCallArgs>::createInstance<
+            kernel::EmbeddingBagSum>(jcp);
+#else
+    (void)prevEmbDepth;
+#endif // OPENVINO_ARCH_X86_64
 }
 
 template<typename T>
@@ -117,8 +198,142 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
     parallel_nt(0, threadBody);
 }
 
+template<typename T>
+void EmbeddingBagSum::processDataToF32(const T* srcData, const float* weightsData,
+                                       const VectorDims& inDataDims, const MemoryPtr& outMemory) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
+    auto *dstData = outMemory->getDataAs<float>();
+    const float* scales = _decompressionMultiplyPtr ? _decompressionMultiplyPtr->getDataAs<const float>() : nullptr;
+    const float* zeroPoints = _decompressionSubtractPtr ? _decompressionSubtractPtr->getDataAs<const float>() : nullptr;
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(outputBagsNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = start; obi < end; obi++) {
+            float* dst = dstData + obi * _embDepth;
+            std::fill(dst, dst + _embDepth, 0.f);
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            if (indices == nullptr)
+                continue;
+            withWeights = withWeights & _withWeights;
+
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                const auto idx = static_cast<size_t>(indices[inIdx]);
+                if (idx >= inDataDims[0]) {
+                    OPENVINO_THROW(msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
+                }
+                const T* src = srcData + idx * _embDepth;
+                const float zeroPoint = zeroPoints ? zeroPoints[idx] : 0.f;
+                float scale = scales ? scales[idx] : 1.f;
+                if (withWeights)
+                    scale *= weightsData[weightsIdx++];
+
+                for (size_t i = 0lu; i < _embDepth; i++) {
+                    dst[i] += (static_cast<float>(src[i]) - zeroPoint) * scale;
+                }
+            }
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
+void EmbeddingBagSum::processDataJit(const uint8_t* srcData, const float* weightsData,
+                                     const VectorDims& inDataDims, const MemoryPtr& outMemory) {
+#if defined(OPENVINO_ARCH_X86_64)
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
+    auto *dstData = outMemory->getDataAs<float>();
+    const float* scales = _decompressionMultiplyPtr ? _decompressionMultiplyPtr->getDataAs<const float>() : nullptr;
+    const float* zeroPoints = _decompressionSubtractPtr ? _decompressionSubtractPtr->getDataAs<const float>() : nullptr;
+    // the weight of the default index which is added to the empty bag
+    static const float defaultWeight = 1.f;
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(outputBagsNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+
+        kernel::EmbeddingBagSumCallArgs args;
+        args.table = srcData;
+        args.scales = scales;
+        args.zero_points = zeroPoints;
+
+        for (size_t obi = start; obi < end; obi++) {
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            if (indices == nullptr)
+                indicesSize = 0lu;
+            withWeights = withWeights & _withWeights;
+
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                    OPENVINO_THROW(msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
+                }
+            }
+
+            args.indices = indices;
+            args.indices_num = indicesSize;
+            args.weights = withWeights ? weightsData + weightsIdx : &defaultWeight;
+            args.dst = dstData + obi * _embDepth;
+            (*_kernel)(&args);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+#else
+    OPENVINO_THROW("EmbeddingBagSum layer with name '", _layerName, "' doesn't have the kernel on this platform");
+#endif // OPENVINO_ARCH_X86_64
+}
+
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, const ov::element::Type &srcPrc,
                               const VectorDims& inDims, const MemoryPtr& outMemory) {
+    if (_kernel) {
+        return processDataJit(srcData, reinterpret_cast<const float*>(weightsData), inDims, outMemory);
+    }
+    // the rows of the low precision or the compressed table are accumulated in f32
+    if (srcPrc != _outputPrecision) {
+        switch (srcPrc) {
+            case ov::element::bf16: {
+                return processDataToF32(reinterpret_cast<const ov::bfloat16*>(srcData),
+                                        reinterpret_cast<const float*>(weightsData), inDims, outMemory);
+            }
+            case ov::element::f16: {
+                return processDataToF32(reinterpret_cast<const ov::float16*>(srcData),
+                                        reinterpret_cast<const float*>(weightsData), inDims, outMemory);
+            }
+            case ov::element::i8: {
+                return processDataToF32(reinterpret_cast<const int8_t*>(srcData),
+                                        reinterpret_cast<const float*>(weightsData), inDims, outMemory);
+            }
+            case ov::element::u8: {
+                return processDataToF32(srcData, reinterpret_cast<const float*>(weightsData), inDims, outMemory);
+            }
+            default: {
+                OPENVINO_THROW("EmbeddingBagSum layer does not support precision '" + std::string(srcPrc.get_type_name()) + "'");
+            }
+        }
+    }
     switch (srcPrc) {
         case ov::element::f32: {
             return processData<element_type_traits<ov::element::f32>::value_type>(reinterpret_cast<const float*>(srcData),
@@ -141,6 +356,30 @@ void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData
     }
 }
 
+void EmbeddingBagSum::fuseDecompressionMultiply(const MemoryCPtr& memory) {
+    fuseDecompressionConstant(memory, _decompressionMultiplyPtr);
+}
+
+void EmbeddingBagSum::fuseDecompressionSubtract(const MemoryCPtr& memory) {
+    fuseDecompressionConstant(memory, _decompressionSubtractPtr);
+}
+
+void EmbeddingBagSum::fuseDecompressionConstant(const MemoryCPtr& memory, MemoryCPtr& decompressionValuesPtr) {
+    const auto decompression_prc = ov::element::f32;
+    if (memory->getDesc().getPrecision() == decompression_prc) {
+        decompressionValuesPtr = memory;
+    } else {
+        DnnlBlockedMemoryDesc memoryDesc(decompression_prc, memory->getShape());
+        decompressionValuesPtr = std::make_shared<Memory>(GraphContext::getEngine(), memoryDesc, nullptr, false);
+        const auto elementsCount = memory->getDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
+        cpu_convert(memory->getData(),
+                    decompressionValuesPtr->getData(),
+                    DnnlExtensionUtils::DataTypeToElementType(memory->getDataType()),
+                    ov::element::f32,
+                    elementsCount);
+    }
+}
+
 }   // namespace node
 }   // namespace intel_cpu
 }   // namespace ov
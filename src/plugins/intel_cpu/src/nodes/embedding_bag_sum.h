@@ -5,6 +5,7 @@
 #pragma once
 
 #include "node.h"
+#include "kernels/x64/embedding_bag_sum.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -24,6 +25,9 @@ public:
 
     ~EmbeddingBagSum() = default;
 
+    void fuseDecompressionMultiply(const MemoryCPtr& memory);
+    void fuseDecompressionSubtract(const MemoryCPtr& memory);
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(
@@ -33,11 +37,24 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
+    /**
+     * @brief Selects the precisions of the table and the output.
+     * The tables of the low precisions are not converted, their rows are accumulated in f32 on the fly,
+     * and so are the rows of the compressed table which are decompressed with the per row scales and zero points.
+     */
+    void initPrecisions(const ov::element::Type& originalTablePrecision);
+    impl_desc_type getImplType() const;
+
     void prepareParams(const VectorDims& indexStaticShape);
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData,
                      const VectorDims& inDataDims, const MemoryPtr& outMemory);
+    template<typename T>
+    void processDataToF32(const T* srcData, const float* weightsData,
+                          const VectorDims& inDataDims, const MemoryPtr& outMemory);
+    void processDataJit(const uint8_t* srcData, const float* weightsData,
+                        const VectorDims& inDataDims, const MemoryPtr& outMemory);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -47,6 +64,18 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    ov::element::Type _tablePrecision = ov::element::f32;
+    ov::element::Type _outputPrecision = ov::element::f32;
+
+private:
+    bool hasKernel(const ov::element::Type& tablePrecision) const;
+    void fuseDecompressionConstant(const MemoryCPtr& memory, MemoryCPtr& decompressionValuesPtr);
+
+    MemoryCPtr _decompressionSubtractPtr = nullptr;
+    MemoryCPtr _decompressionMultiplyPtr = nullptr;
+
+    std::shared_ptr<kernel::JitKernelBase> _kernel;
 };
 
 }   // namespace node
@@ -39,6 +39,9 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr srcWeightDesc,
     }
 
     auto create = [&]() {
+        if (auto packed = context->findPackedWeights(dstWeightDesc))
+            return packed;
+
         Memory srcMemory{eng, srcWeightDesc, weightsMem->getData()};
         MemoryPtr _ptr = std::make_shared<Memory>(eng, dstWeightDesc);
         auto rtCache = context->getRuntimeCache();
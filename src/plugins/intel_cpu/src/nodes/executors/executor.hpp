@@ -75,13 +75,16 @@ public:
 
     ExecutorContext(const GraphContext::CPtr graphContext,
                     const std::vector<impl_desc_type>& implPriorities,
-                    std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> privateWeighCache = nullptr)
+                    std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> privateWeighCache = nullptr,
+                    std::string nodeName = {})
         : runtimeCache(graphContext->getParamsCache()),
-          scratchPad(graphContext->getScratchPad()),
+          graphContext(graphContext),
           weightsCache(graphContext->getWeightsCache()),
+          packedWeights(graphContext->getPackedWeights()),
           engine(graphContext->getEngine()),
           implPriorities(implPriorities),
-          privateWeighCache(std::move(privateWeighCache))
+          privateWeighCache(std::move(privateWeighCache)),
+          nodeName(std::move(nodeName))
     {}
 
     MultiCachePtr getRuntimeCache() const {
@@ -91,7 +94,17 @@ public:
     }
 
     DnnlScratchPadPtr getScratchPad() const {
-        return scratchPad;
+        auto graphContextPtr = graphContext.lock();
+        assert(graphContextPtr);
+        return graphContextPtr->getScratchPad(scratchPadLane);
+    }
+
+    /**
+     * @brief Sets the scratch pad lane of the node, so the executors of the nodes executed concurrently
+     * do not share the scratch pad memory. The lane is known after the executor context is created.
+     */
+    void setScratchPadLane(size_t lane) {
+        scratchPadLane = lane;
     }
 
     std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> getPrivateWeighCache() const {
@@ -110,16 +123,32 @@ public:
         return weightsCache;
     }
 
+    /**
+     * @brief Returns the packed weights of the node imported from the model cache in the layout of the given descriptor
+     * @return nullptr if there are none and the weights have to be reordered
+     */
+    MemoryPtr findPackedWeights(const MemoryDescPtr& desc) const {
+        if (!packedWeights || nodeName.empty())
+            return nullptr;
+        const auto key = PackedWeights::key(nodeName, desc->serializeFormat(), desc->getPrecision());
+        return packedWeights->find(key, engine, desc);
+    }
+
 private:
     // weak_ptr is required to avoid cycle dependencies with MultiCache
     // since ExecutorContext is stored in Executor itself
     MultiCacheWeakPtr runtimeCache;
-    DnnlScratchPadPtr scratchPad;
+    // the scratch pads of the lanes are created on demand by the graph context
+    std::weak_ptr<const GraphContext> graphContext;
+    size_t scratchPadLane = 0;
     WeightsSharing::Ptr weightsCache;
+    PackedWeights::CPtr packedWeights;
     const dnnl::engine& engine;
     std::vector<impl_desc_type> implPriorities;
     // @todo remove after global cache is used exclusevly
     std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> privateWeighCache;
+    // the name of the node the weights belong to, identifies the packed weights
+    std::string nodeName;
 };
 
 class ExecutorFactoryLegacy {
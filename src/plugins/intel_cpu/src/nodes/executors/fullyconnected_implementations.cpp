@@ -25,6 +25,10 @@
 #include "ov_optional.hpp"
 #include "utils/cpp/maybe_unused.hpp"
 
+#if defined(OPENVINO_ARCH_X86_64)
+#include "nodes/executors/x64/gemv_decompression.hpp"
+#endif
+
 namespace ov {
 namespace intel_cpu {
 
@@ -268,6 +272,34 @@ const std::vector<ExecutorImplementation<FCAttrs>>& getImplementations() {
                     context,
                     false);
             })
+#if defined(OPENVINO_ARCH_X86_64)
+        OV_CPU_INSTANCE_X64(
+            "fullyconnected_gemv_decompression",
+            ExecutorType::x64,
+            OperationType::FullyConnected,
+            ShapeTolerance::Dependant,
+            // supports
+            [](const FCConfig& config) -> bool {
+                return GemvDecompressionExecutor::supports(config);
+            },
+            // requiresFallback
+            [](const FCConfig& config) -> ov::optional<executor::Config<FCAttrs>> {
+                // the same descriptors as the oneDNN FullyConnected the bigger inputs fall back to
+                return requiresFallbackCommon(config,
+                                              dnnlFCTypeMapping,
+                                              dnnlFCLayoutConfig,
+                                              dnnlFCMappingNotation);
+            },
+            // acceptsShapes
+            [](const MemoryArgs& memory) -> bool {
+                // the decoding of a few tokens
+                return GemvDecompressionExecutor::acceptsShapes(memory);
+            },
+            // create
+            [](const FCAttrs& attrs, const PostOps& postOps, const MemoryArgs& memory, ExecutorContext::CPtr context) {
+                return std::make_shared<GemvDecompressionExecutor>(attrs, postOps, memory, context);
+            })
+#endif
         OV_CPU_INSTANCE_DNNL(
             "fullyconnected_dnnl",
             ExecutorType::Dnnl,
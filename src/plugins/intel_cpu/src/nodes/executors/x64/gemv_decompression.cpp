@@ -0,0 +1,332 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gemv_decompression.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <tuple>
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/common/cpu_convert.h"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/nf4.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+
+using namespace executor;
+using namespace dnnl::impl::cpu;
+using namespace ov::element;
+
+// the rows of the src (the tokens) up to which the FullyConnected is bound by the weights streaming
+static constexpr size_t gemvMaxRows = 16;
+
+// K and N of the weights [N, K] or [K, N] if the weights are not transposed
+static std::pair<size_t, size_t> weightsKN(const VectorDims& weiDims, const bool weightsNonTransposed) {
+    return weightsNonTransposed ? std::make_pair(weiDims[0], weiDims[1]) : std::make_pair(weiDims[1], weiDims[0]);
+}
+
+// scales or zero points are either scalar, or per output channel, or per output channel and group of K
+static size_t decompressionGroups(const MemoryCPtr& params, const size_t N) {
+    if (!params)
+        return 1;
+    const auto count = params->getShape().getElementsCount();
+    return count == 1 ? 1 : count / N;
+}
+
+bool GemvDecompressionExecutor::supports(const FCConfig& config) {
+    VERIFY(x64::mayiuse(x64::avx2), UNSUPPORTED_ISA);
+    VERIFY(config.postOps.empty(), UNSUPPORTED_POST_OPS);
+    VERIFY(!config.attrs.sparseWeights, UNSUPPORTED_SPARSE_WEIGHTS);
+    VERIFY(config.attrs.dequantizationScales.empty(), UNSUPPORTED_POST_OPS);
+    VERIFY(config.attrs.decompressionMultiplyPtr, UNSUPPORTED_WEIGHTS_DECOMPRESSION);
+    VERIFY(one_of(srcType(config), f32, bf16), UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(one_of(weiType(config), u8, u4, i4, nf4), UNSUPPORTED_WEI_PRECISIONS);
+    VERIFY(weiRank(config) == 2, UNSUPPORTED_WEI_RANK);
+
+    const auto& weiDims = config.descs.at(ARG_WEI)->getShape().getStaticDims();
+    size_t K, N;
+    std::tie(K, N) = weightsKN(weiDims, config.attrs.weightsNonTransposed);
+    const auto scalesGroups = decompressionGroups(config.attrs.decompressionMultiplyPtr, N);
+    const auto zeroPointsGroups = decompressionGroups(config.attrs.decompressionSubtractPtr, N);
+    const auto groups = std::max(scalesGroups, zeroPointsGroups);
+    VERIFY(K != 0 && N != 0 && groups != 0 && K % groups == 0, HEURISTICS_MISMATCH);
+    VERIFY(groups % scalesGroups == 0 && groups % zeroPointsGroups == 0, HEURISTICS_MISMATCH);
+    // the pairs of K elements share a byte of the 4-bit weights
+    VERIFY(weiType(config) == u8 || (K / groups) % 2 == 0, HEURISTICS_MISMATCH);
+    // the kernel addresses the src rows with 32-bit offsets
+    VERIFY(gemvMaxRows * K * sizeof(float) < static_cast<size_t>(std::numeric_limits<int>::max()), HEURISTICS_MISMATCH);
+
+    return true;
+}
+
+bool GemvDecompressionExecutor::acceptsShapes(const MemoryArgs& memory) {
+    const auto& srcShape = memory.at(ARG_SRC)->getShape();
+    if (!srcShape.isStatic())
+        return false;
+    const auto& srcDims = srcShape.getStaticDims();
+    const auto M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    VERIFY(M != 0 && M <= gemvMaxRows, HEURISTICS_MISMATCH);
+
+    return true;
+}
+
+GemvDecompressionExecutor::GemvDecompressionExecutor(const FCAttrs& attrs,
+                                                     const PostOps& postOps,
+                                                     const MemoryArgs& memory,
+                                                     const ExecutorContext::CPtr context)
+    : m_isa(x64::mayiuse(x64::avx512_core) ? x64::avx512_core : x64::avx2) {
+    const auto weiPrc = memory.at(ARG_WEI)->getPrecision();
+    std::tie(m_K, m_N) = weightsKN(memory.at(ARG_WEI)->getStaticDims(), attrs.weightsNonTransposed);
+    m_groups = std::max(decompressionGroups(attrs.decompressionMultiplyPtr, m_N),
+                        decompressionGroups(attrs.decompressionSubtractPtr, m_N));
+    if (m_isa == x64::avx512_core) {
+        m_tileSize = kernel::GemvDecompression<x64::avx512_core>::tile_size;
+        m_maxRows = kernel::GemvDecompression<x64::avx512_core>::max_rows;
+    } else {
+        m_tileSize = kernel::GemvDecompression<x64::avx2>::tile_size;
+        m_maxRows = kernel::GemvDecompression<x64::avx2>::max_rows;
+    }
+    m_tiles = div_up(m_N, m_tileSize);
+
+    m_jcp.wei_prc = weiPrc == i4 ? u4 : weiPrc;
+    m_jcp.group_size = m_K / m_groups;
+    m_jcp.src_stride = m_K;
+    m_jcp.src_sums_stride = m_groups;
+    m_jcp.dst_stride = m_tiles * m_tileSize;
+    // i4 is packed as u4 shifted by 8, so the zero points are always there
+    m_jcp.with_zero_points = attrs.decompressionSubtractPtr != nullptr || weiPrc == i4;
+
+    for (size_t i = 0; i < m_nf4Lut.size(); i++) {
+        m_nf4Lut[i] = ConvertNF4::dequantize(static_cast<uint8_t>(i));
+    }
+
+    if (attrs.withBias) {
+        m_bias.resize(m_N);
+        const auto& bias = memory.at(ARG_BIAS);
+        cpu_convert(bias->getData(), m_bias.data(), bias->getPrecision(), f32, m_N);
+    }
+
+    m_packedWeights = packWeights(attrs, memory, context);
+}
+
+MemoryPtr GemvDecompressionExecutor::packWeights(const FCAttrs& attrs,
+                                                 const MemoryArgs& memory,
+                                                 const ExecutorContext::CPtr context) const {
+    const auto& weightsMemory = memory.at(ARG_WEI);
+    const auto weiPrc = weightsMemory->getPrecision();
+    const size_t paramsBytes = m_isa == x64::avx512_core
+                                   ? kernel::GemvDecompression<x64::avx512_core>::params_bytes(m_jcp)
+                                   : kernel::GemvDecompression<x64::avx2>::params_bytes(m_jcp);
+    const size_t groupBytes = m_isa == x64::avx512_core
+                                  ? kernel::GemvDecompression<x64::avx512_core>::group_bytes(m_jcp)
+                                  : kernel::GemvDecompression<x64::avx2>::group_bytes(m_jcp);
+
+    auto create = [&]() {
+        DEBUG_LOG("GemvDecompressionExecutor: cache miss, perform packing");
+        MemoryPtr packed = std::make_shared<Memory>(context->getEngine(),
+                                                    CpuBlockedMemoryDesc(i8, Shape{m_tiles * m_groups * groupBytes}));
+        const auto N = m_N;
+        const auto K = m_K;
+        const auto groups = m_groups;
+        const auto groupSize = m_jcp.group_size;
+        const auto nonTransposed = attrs.weightsNonTransposed;
+        const auto weights = weightsMemory->getDataAs<const uint8_t>();
+
+        auto weight = [&](size_t n, size_t k) -> uint8_t {
+            const size_t idx = nonTransposed ? k * N + n : n * K + k;
+            if (weiPrc == u8)
+                return weights[idx];
+            const uint8_t code = (weights[idx / 2] >> (4 * (idx % 2))) & 0xF;
+            // i4 -> u4: w_i4 - zp = w_u4 - (zp + 8)
+            return weiPrc == i4 ? code ^ 0x8 : code;
+        };
+        auto param = [&](const MemoryCPtr& params, size_t n, size_t g) {
+            const auto values = params->getDataAs<const float>();
+            const auto paramsGroups = decompressionGroups(params, N);
+            if (params->getShape().getElementsCount() == 1)
+                return values[0];
+            const auto paramsGroup = g * paramsGroups / groups;
+            return nonTransposed ? values[paramsGroup * N + n] : values[n * paramsGroups + paramsGroup];
+        };
+
+        auto dst = packed->getDataAs<uint8_t>();
+        parallel_for2d(m_tiles, groups, [&](size_t tile, size_t g) {
+            auto group = dst + (tile * groups + g) * groupBytes;
+            auto scales = reinterpret_cast<float*>(group);
+            auto zeroPoints = scales + m_tileSize;
+            auto groupWeights = group + paramsBytes;
+            for (size_t i = 0; i < m_tileSize; i++) {
+                // the tail of the output channels is padded with zeros
+                const size_t n = tile * m_tileSize + i;
+                scales[i] = n < N ? param(attrs.decompressionMultiplyPtr, n, g) : 0.f;
+                if (m_jcp.with_zero_points) {
+                    const float zp = n < N && attrs.decompressionSubtractPtr
+                                         ? param(attrs.decompressionSubtractPtr, n, g) : 0.f;
+                    zeroPoints[i] = weiPrc == i4 ? zp + 8.f : zp;
+                }
+            }
+            const size_t k0 = g * groupSize;
+            if (m_jcp.wei_prc == u8) {
+                for (size_t k = 0; k < groupSize; k++) {
+                    for (size_t i = 0; i < m_tileSize; i++) {
+                        const size_t n = tile * m_tileSize + i;
+                        groupWeights[k * m_tileSize + i] = n < N ? weight(n, k0 + k) : 0;
+                    }
+                }
+            } else {
+                for (size_t k = 0; k < groupSize; k += 2) {
+                    for (size_t i = 0; i < m_tileSize; i++) {
+                        const size_t n = tile * m_tileSize + i;
+                        groupWeights[k / 2 * m_tileSize + i] =
+                            n < N ? static_cast<uint8_t>(weight(n, k0 + k) | (weight(n, k0 + k + 1) << 4)) : 0;
+                    }
+                }
+            }
+        });
+        return packed;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const auto zeroPointsData = attrs.decompressionSubtractPtr ? attrs.decompressionSubtractPtr->getData() : nullptr;
+        const std::string string_hash =
+            "gemv_decompression_" + std::to_string(m_N) + "_" + std::to_string(m_K) + "_" + std::to_string(m_groups) +
+            "_" + std::to_string(m_tileSize) + "_" + std::to_string(weightsMemory->getSize()) + "_" +
+            std::to_string(reinterpret_cast<uint64_t>(weightsMemory->getData())) + "_" +
+            std::to_string(reinterpret_cast<uint64_t>(attrs.decompressionMultiplyPtr->getData())) + "_" +
+            std::to_string(reinterpret_cast<uint64_t>(zeroPointsData));
+        DEBUG_LOG("GemvDecompressionExecutor: findOrCreate, string_hash: ", string_hash);
+        return *weightCache->findOrCreate(string_hash, create);
+    }
+
+    DEBUG_LOG("GemvDecompressionExecutor: Weights cache is not available");
+    return create();
+}
+
+GemvDecompressionExecutor::KernelPtr GemvDecompressionExecutor::createKernel(size_t rows) const {
+    auto jcp = m_jcp;
+    jcp.rows = rows;
+    KernelPtr kernel;
+    if (m_isa == x64::avx512_core)
+        kernel = std::make_shared<kernel::GemvDecompression<x64::avx512_core>>(jcp);
+    else
+        kernel = std::make_shared<kernel::GemvDecompression<x64::avx2>>(jcp);
+    kernel->create_kernel();
+    return kernel;
+}
+
+impl_desc_type GemvDecompressionExecutor::implType() const {
+    return m_isa == x64::avx512_core ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+}
+
+void GemvDecompressionExecutor::update(const MemoryArgs& memory) {
+    const auto& srcDims = memory.at(ARG_SRC)->getStaticDims();
+    m_M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+
+    m_kernels.resize(m_maxRows);
+    for (const auto rows : {std::min(m_M, m_maxRows), m_M % m_maxRows}) {
+        if (rows != 0 && !m_kernels[rows - 1])
+            m_kernels[rows - 1] = createKernel(rows);
+    }
+
+    // there are too few tiles to occupy all the threads, so K is split too
+    const size_t threads = parallel_get_max_threads();
+    const size_t splits = m_tiles < threads ? std::min(m_groups, div_up(threads, m_tiles)) : 1;
+    m_groupsPerSplit = div_up(m_groups, splits);
+    m_splits = div_up(m_groups, m_groupsPerSplit);
+
+    m_partialSums.resize(m_splits * m_M * m_jcp.dst_stride);
+    if (memory.at(ARG_SRC)->getPrecision() != f32)
+        m_src.resize(m_M * m_K);
+    if (m_jcp.with_zero_points)
+        m_srcSums.resize(m_M * m_groups);
+}
+
+void GemvDecompressionExecutor::execute(const MemoryArgs& memory) {
+    const auto& srcMemory = memory.at(ARG_SRC);
+    const auto& dstMemory = memory.at(ARG_DST);
+    const auto M = m_M;
+    const auto K = m_K;
+    const auto N = m_N;
+    const auto groups = m_groups;
+    const auto groupSize = m_jcp.group_size;
+    const auto dstStride = m_jcp.dst_stride;
+
+    const float* src = nullptr;
+    if (srcMemory->getPrecision() == f32) {
+        src = srcMemory->getDataAs<const float>();
+    } else {
+        cpu_convert(srcMemory->getData(), m_src.data(), srcMemory->getPrecision(), f32, M * K);
+        src = m_src.data();
+    }
+
+    if (m_jcp.with_zero_points) {
+        parallel_for2d(M, groups, [&](size_t m, size_t g) {
+            const auto groupSrc = src + m * K + g * groupSize;
+            m_srcSums[m * groups + g] = std::accumulate(groupSrc, groupSrc + groupSize, 0.f);
+        });
+    }
+
+    const auto packed = m_packedWeights->getDataAs<const uint8_t>();
+    const size_t groupBytes = m_isa == x64::avx512_core
+                                  ? kernel::GemvDecompression<x64::avx512_core>::group_bytes(m_jcp)
+                                  : kernel::GemvDecompression<x64::avx2>::group_bytes(m_jcp);
+    const size_t work = m_tiles * m_splits;
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(work, nthr, ithr, start, end);
+
+        kernel::GemvDecompressionCallArgs args;
+        args.lut = m_nf4Lut.data();
+        for (size_t w = start; w < end; w++) {
+            // the neighbouring threads stream the neighbouring tiles
+            const size_t tile = w / m_splits;
+            const size_t split = w % m_splits;
+            const size_t g0 = split * m_groupsPerSplit;
+            const size_t g1 = std::min(groups, g0 + m_groupsPerSplit);
+            args.groups = g1 - g0;
+            for (size_t m = 0; m < M; m += m_maxRows) {
+                const size_t rows = std::min(m_maxRows, M - m);
+                args.weights = packed + (tile * groups + g0) * groupBytes;
+                args.src = src + m * K + g0 * groupSize;
+                args.src_sums = m_srcSums.data() + m * groups + g0;
+                args.dst = m_partialSums.data() + (split * M + m) * dstStride + tile * m_tileSize;
+                (*m_kernels[rows - 1])(&args);
+            }
+        }
+    });
+
+    // reduction of the partial sums of the K splits
+    const auto dstPrc = dstMemory->getPrecision();
+    auto dst = dstMemory->getData();
+    parallel_for2d(M, m_tiles, [&](size_t m, size_t tile) {
+        const size_t n0 = tile * m_tileSize;
+        const size_t n1 = std::min(N, n0 + m_tileSize);
+        for (size_t n = n0; n < n1; n++) {
+            float value = m_bias.empty() ? 0.f : m_bias[n];
+            for (size_t split = 0; split < m_splits; split++) {
+                value += m_partialSums[(split * M + m) * dstStride + n];
+            }
+            if (dstPrc == bf16)
+                reinterpret_cast<ov::bfloat16*>(dst)[m * N + n] = ov::bfloat16(value);
+            else
+                reinterpret_cast<float*>(dst)[m * N + n] = value;
+        }
+    });
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/kernels/x64/gemv_decompression.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief FullyConnected executor for a few src rows (the token by token decoding of LLMs) and the compressed weights.
+ * Such a FullyConnected is bound by the memory bandwidth, so the weights are prepacked once into the tiles which are
+ * streamed linearly with the scales and the zero points of every group next to its weights, unpacked in the registers,
+ * and the work is split over all the cores by the output channels and, if there are not enough tiles, by the groups
+ * of K followed by the reduction of the partial sums.
+ */
+class GemvDecompressionExecutor : public Executor {
+public:
+    GemvDecompressionExecutor(const FCAttrs& attrs,
+                              const PostOps& postOps,
+                              const MemoryArgs& memory,
+                              const ExecutorContext::CPtr context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    impl_desc_type implType() const override;
+
+    // offloads execution data preparation from the exec call
+    void update(const MemoryArgs& memory) override;
+
+    static bool supports(const FCConfig& config);
+
+    static bool acceptsShapes(const MemoryArgs& memory);
+
+private:
+    using KernelPtr =
+        std::shared_ptr<kernel::JitKernel<kernel::GemvDecompressionCompileParams, kernel::GemvDecompressionCallArgs>>;
+
+    KernelPtr createKernel(size_t rows) const;
+    MemoryPtr packWeights(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr context) const;
+
+    const dnnl::impl::cpu::x64::cpu_isa_t m_isa;
+    kernel::GemvDecompressionCompileParams m_jcp;
+    size_t m_N = 0lu;
+    size_t m_K = 0lu;
+    size_t m_groups = 0lu;
+    size_t m_tileSize = 0lu;
+    size_t m_tiles = 0lu;
+    size_t m_maxRows = 0lu;
+    size_t m_M = 0lu;
+    // K is split by the groups if there are not enough tiles for all the threads
+    size_t m_splits = 1lu;
+    size_t m_groupsPerSplit = 0lu;
+    std::array<float, 16> m_nf4Lut{};
+    std::vector<float> m_bias;
+    MemoryCPtr m_packedWeights;
+    // kernels by the number of the rows minus one
+    std::vector<KernelPtr> m_kernels;
+    // f32 src (if the src is bf16) and the src sums by the groups
+    std::vector<float> m_src;
+    std::vector<float> m_srcSums;
+    // partial sums of the K splits
+    std::vector<float> m_partialSums;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
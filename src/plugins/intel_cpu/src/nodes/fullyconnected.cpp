@@ -242,7 +242,7 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
         {ARG_DST, dstDescs[0]},
     };
 
-    auto executionContext = std::make_shared<ExecutorContext>(context, getImplPriority(), privateWeightCache);
+    executionContext = std::make_shared<ExecutorContext>(context, getImplPriority(), privateWeightCache, getName());
     factory = std::make_shared<ExecutorFactory<FCAttrs, node::FullyConnected>>(attrs, postOps, executionContext, descs);
     const auto nodeDescriptors = factory->getProperMemoryDescriptors(descs);
 
@@ -262,6 +262,8 @@ void FullyConnected::createPrimitive() {
     memory[ARG_WEI] = getSrcMemoryAtPort(WEIGHTS_ID);
     memory[ARG_BIAS] = attrs.withBias ? getSrcMemoryAtPort(BIAS_ID) : emptyMemory;
     memory[ARG_DST] = getDstMemoryAtPort(0);
+    // the lane is assigned after the supported descriptors are initialized
+    executionContext->setScratchPadLane(getScratchPadLane());
     // @todo should we preconfigure only for dynamic shapes?
     // Since for static shapes primitive is created in scope of compile_model() anyway
     factory->preconfigure(memory);
@@ -74,6 +74,7 @@ private:
     PostOps postOps;
     MemoryArgs memory;
     MemoryPtr emptyMemory;
+    ExecutorContext::Ptr executionContext;
     ExecutorFactoryPtr<FCAttrs, node::FullyConnected> factory;
     ExecutorPtr executor = nullptr;
     std::string errorPrefix;
@@ -29,6 +29,14 @@ public:
     void withMeanImage();
     MemoryCPtr getMemoryPtr() const;
 
+    // the batch items set by several tensors are read by the consumers from their own buffers
+    void setBatchItems(std::vector<const void*> items) {
+        batchItems = std::move(items);
+    }
+    const std::vector<const void*>& getBatchItems() const {
+        return batchItems;
+    }
+
     void execute(dnnl::stream strm) override {}
     void executeDynamicImpl(dnnl::stream strm) override {}
     bool isExecutable() const override {
@@ -48,6 +56,7 @@ private:
     MemoryCPtr memoryPtr;
     MemoryDescPtr extMemDesc = nullptr;
     bool isMeanImage = false;
+    std::vector<const void*> batchItems;
 };
 
 }   // namespace node
@@ -602,15 +602,25 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                              float d_scale,
                              const ov::intel_cpu::PlainTensor& past_k_scale_zp,
                              const ov::intel_cpu::PlainTensor& past_v_scale_zp,
-                             ov::intel_cpu::PlainTensor& head_sum) {
+                             ov::intel_cpu::PlainTensor& head_sum,
+                             const ov::intel_cpu::PagedKVCacheView& paged_key,
+                             const ov::intel_cpu::PagedKVCacheView& paged_value) {
     ov::intel_cpu::PlainTensor causal_mask;
     bool select_nfltmax_at_0 = false;
     auto B = query.size(0);
     auto H = query.size(1);
     auto q_len = query.size(2);
     auto S = query.size(3);
-    auto kv_len = present_key.size(2);
-    auto h_group_num = present_key.size(1);
+    // paged cache: the tokens are scattered over the blocks, present_key/present_value are not used
+    const bool is_paged = static_cast<bool>(paged_key);
+    auto kv_len = is_paged ? paged_key.L : present_key.size(2);
+    auto h_group_num = is_paged ? paged_key.H : present_key.size(1);
+    auto key_ptr = [&](size_t b, size_t h, size_t l) {
+        return is_paged ? paged_key.ptr<T2>(b, h, l) : present_key.ptr<T2>(b, h, l);
+    };
+    auto value_ptr = [&](size_t b, size_t h, size_t l) {
+        return is_paged ? paged_value.ptr<T2>(b, h, l) : present_value.ptr<T2>(b, h, l);
+    };
     size_t h_each_group_len = 1;
     if (h_group_num != H) {
         h_each_group_len = H / h_group_num;
@@ -647,7 +657,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                     // the memory will be continuous when b==1
                     for (size_t iwork = start; iwork < end; ++iwork) {
                         auto p = past_k_scale_zp.ptr<float>(0, h_group, pk);
-                        auto p_k = present_key.ptr<T2>(0, h_group, pk);
+                        auto p_k = key_ptr(0, h_group, pk);
                         prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
                         buf_attn_w.ptr<float>(0, h_group, 0)[pk] =
                                 dot_product(query.ptr<T>(0, h_group), p_k,
@@ -658,7 +668,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                     for (size_t iwork = start; iwork < end; ++iwork) {
                         auto b_kv = beams ? beams.ptr<int32_t>(b)[pk] : b;
                         auto p = past_k_scale_zp.ptr<float>(b_kv, h_group, pk);
-                        auto p_k = present_key.ptr<T2>(b_kv, h_group, pk);
+                        auto p_k = key_ptr(b_kv, h_group, pk);
                         buf_attn_w.ptr<float>(b, h_group, 0)[pk] =
                                 dot_product(query.ptr<T>(b, h_group), p_k,
                                     S, p, p + 1, head_sum.ptr<float>(b, h_group));
@@ -672,7 +682,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                         auto p = past_k_scale_zp.ptr<float>(b_kv, h_group, pk);
                         for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
                             buf_attn_w.ptr<float>(b, h, pq)[pk] =
-                                    dot_product(query.ptr<T>(b, h, pq), present_key.ptr<T2>(b_kv, h_group, pk),
+                                    dot_product(query.ptr<T>(b, h, pq), key_ptr(b_kv, h_group, pk),
                                         S, p, p + 1, head_sum.ptr<float>(b, h, pq));
                         }
                     }
@@ -718,7 +728,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
             if (q_len == 1 && h_each_group_len == 1) {
                 for (size_t iwork = start; iwork < end; ++iwork) {
                     auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
-                    auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
+                    auto* v = value_ptr(b_kv, h_group, pv);
                     auto p = past_v_scale_zp.ptr<float>(b_kv, h_group, pv);
                     attn_acc_value(buf_attn_score.ptr<float>(ithr, b, 0, h_group),
                                 buf_attn_w.ptr<float>(b, h_group, 0, pv)[0],
@@ -731,7 +741,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
             } else {
                 for (size_t iwork = start; iwork < end; ++iwork) {
                     auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
-                    auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
+                    auto* v = value_ptr(b_kv, h_group, pv);
                     auto p = past_v_scale_zp.ptr<float>(b_kv, h_group, pv);
                     for (size_t pq = 0; pq < q_len; pq++) {
                         for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
@@ -771,9 +781,12 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                       float d_scale,
                       const ov::intel_cpu::PlainTensor& past_k_scale_zp,
                       const ov::intel_cpu::PlainTensor& past_v_scale_zp,
-                      ov::intel_cpu::PlainTensor& head_sum) {
+                      ov::intel_cpu::PlainTensor& head_sum,
+                      const ov::intel_cpu::PagedKVCacheView& paged_key,
+                      const ov::intel_cpu::PagedKVCacheView& paged_value) {
+    auto kv_precision = paged_key ? paged_key.precision : present_key.get_precision();
     if (query.get_precision() == ov::element::bf16) {
-        if (present_key.get_precision() == ov::element::u8) {
+        if (kv_precision == ov::element::u8) {
             mha_single_token_kernel<ov::bfloat16, uint8_t>(query,
                                                            present_key,
                                                            present_value,
@@ -788,7 +801,9 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                            d_scale,
                                                            past_k_scale_zp,
                                                            past_v_scale_zp,
-                                                           head_sum);
+                                                           head_sum,
+                                                           paged_key,
+                                                           paged_value);
         } else {
             mha_single_token_kernel<ov::bfloat16, ov::bfloat16>(query,
                                                                 present_key,
@@ -804,10 +819,12 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                                 d_scale,
                                                                 past_k_scale_zp,
                                                                 past_v_scale_zp,
-                                                                head_sum);
+                                                                head_sum,
+                                                                paged_key,
+                                                                paged_value);
         }
     } else if (query.get_precision() == ov::element::f32) {
-        if (present_key.get_precision() == ov::element::u8) {
+        if (kv_precision == ov::element::u8) {
             mha_single_token_kernel<float, uint8_t>(query,
                                                     present_key,
                                                     present_value,
@@ -822,8 +839,10 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                     d_scale,
                                                     past_k_scale_zp,
                                                     past_v_scale_zp,
-                                                    head_sum);
-        } else if (present_key.get_precision() == ov::element::f16) {
+                                                    head_sum,
+                                                    paged_key,
+                                                    paged_value);
+        } else if (kv_precision == ov::element::f16) {
             mha_single_token_kernel<float, ov::float16>(query,
                                                         present_key,
                                                         present_value,
@@ -838,7 +857,9 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                         d_scale,
                                                         past_k_scale_zp,
                                                         past_v_scale_zp,
-                                                        head_sum);
+                                                        head_sum,
+                                                        paged_key,
+                                                        paged_value);
         } else {
             mha_single_token_kernel<float, float>(query,
                                                 present_key,
@@ -854,7 +875,9 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                 d_scale,
                                                 past_k_scale_zp,
                                                 past_v_scale_zp,
-                                                head_sum);
+                                                head_sum,
+                                                paged_key,
+                                                paged_value);
         }
     } else {
         OPENVINO_THROW("Unsupported precision: ", query.get_precision());
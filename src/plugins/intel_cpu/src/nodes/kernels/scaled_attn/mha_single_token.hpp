@@ -9,6 +9,7 @@
 #include <vector>
 #include <openvino/core/type/element_type.hpp>
 #include "utils/plain_tensor.hpp"
+#include "kv_cache_block_pool.h"
 
 namespace ov {
 namespace Extensions {
@@ -29,7 +30,9 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                       float d_scale,
                       const ov::intel_cpu::PlainTensor& past_k_scale_zp,
                       const ov::intel_cpu::PlainTensor& past_v_scale_zp,
-                      ov::intel_cpu::PlainTensor& head_sum);
+                      ov::intel_cpu::PlainTensor& head_sum,
+                      const ov::intel_cpu::PagedKVCacheView& paged_key,
+                      const ov::intel_cpu::PagedKVCacheView& paged_value);
 
 }  // namespace XARCH
 }  // namespace Cpu
@@ -0,0 +1,154 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_sum.hpp"
+#include "utils/general_utils.h"
+
+using namespace dnnl::impl::cpu;
+
+#define GET_OFF(field) offsetof(EmbeddingBagSumCallArgs, field)
+
+namespace ov {
+namespace intel_cpu {
+namespace kernel {
+
+template <x64::cpu_isa_t isa>
+void EmbeddingBagSum<isa>::generate() {
+    const auto& src_prc = m_jcp.src_prc;
+    const size_t tail = m_jcp.emb_depth % vector_step;
+
+    load_vector_emitter.reset(new jit_load_emitter(this, isa, src_prc, ov::element::f32, vector_step));
+    store_vector_emitter.reset(new jit_store_emitter(this, isa, ov::element::f32, ov::element::f32, vector_step));
+    if (tail != 0) {
+        load_tail_emitter.reset(new jit_load_emitter(this, isa, src_prc, ov::element::f32, tail));
+        store_tail_emitter.reset(new jit_store_emitter(this, isa, ov::element::f32, ov::element::f32, tail));
+    }
+
+    this->preamble();
+
+    mov(reg_table, ptr[reg_params + GET_OFF(table)]);
+    mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+    mov(reg_indices_num, ptr[reg_params + GET_OFF(indices_num)]);
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    if (m_jcp.with_weights)
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+    if (m_jcp.with_scales)
+        mov(reg_scales, ptr[reg_params + GET_OFF(scales)]);
+    if (m_jcp.with_zero_points)
+        mov(reg_zero_points, ptr[reg_params + GET_OFF(zero_points)]);
+
+    // reg_params is free now as abi parse finished
+    pool_gpr_idxs = {static_cast<size_t>(reg_aux.getIdx()), static_cast<size_t>(reg_params.getIdx())};
+    pool_vec_idxs = {unroll + 3, unroll + 4};
+
+    const size_t block = vector_step * unroll;
+    const size_t full_blocks = m_jcp.emb_depth / block;
+    if (full_blocks > 0) {
+        Xbyak::Label l_block;
+        mov(reg_blocks, full_blocks);
+        L(l_block);
+        {
+            bag_block(block);
+            // the next block of all the rows
+            add(reg_table, block * src_prc.size());
+            add(reg_dst, block * sizeof(float));
+            dec(reg_blocks);
+            jnz(l_block, T_NEAR);
+        }
+    }
+    if (m_jcp.emb_depth % block != 0) {
+        bag_block(m_jcp.emb_depth % block);
+    }
+
+    this->postamble();
+
+    load_vector_emitter->emit_data();
+    store_vector_emitter->emit_data();
+    if (tail != 0) {
+        load_tail_emitter->emit_data();
+        store_tail_emitter->emit_data();
+    }
+}
+
+template <x64::cpu_isa_t isa>
+void EmbeddingBagSum<isa>::bag_block(size_t elements) {
+    const auto src_size = m_jcp.src_prc.size();
+    const auto row_stride = static_cast<int>(m_jcp.emb_depth * src_size);
+    const size_t vectors = div_up(elements, vector_step);
+
+    Xbyak::Label l_indices;
+    Xbyak::Label l_store;
+
+    for (size_t v = 0; v < vectors; v++) {
+        uni_vpxor(Vmm(v), Vmm(v), Vmm(v));
+    }
+    // empty bag is filled with zeros
+    xor_(reg_i, reg_i);
+    cmp(reg_indices_num, 0);
+    je(l_store, T_NEAR);
+
+    L(l_indices);
+    {
+        movsxd(reg_idx, dword[reg_indices + reg_i * sizeof(int)]);
+        imul(reg_row, reg_idx, row_stride);
+        add(reg_row, reg_table);
+
+        // the block of the next row to be gathered
+        Xbyak::Label l_prefetched;
+        lea(reg_next_row, ptr[reg_i + 1]);
+        cmp(reg_next_row, reg_indices_num);
+        jge(l_prefetched, T_NEAR);
+        movsxd(reg_next_row, dword[reg_indices + reg_next_row * sizeof(int)]);
+        imul(reg_next_row, reg_next_row, row_stride);
+        add(reg_next_row, reg_table);
+        for (size_t offset = 0; offset < elements * src_size; offset += cache_line_size) {
+            prefetcht0(ptr[reg_next_row + offset]);
+        }
+        L(l_prefetched);
+
+        if (m_jcp.with_scales) {
+            uni_vbroadcastss(vmm_weight, ptr[reg_scales + reg_idx * sizeof(float)]);
+            if (m_jcp.with_weights) {
+                uni_vbroadcastss(vmm_src, ptr[reg_weights + reg_i * sizeof(float)]);
+                uni_vmulps(vmm_weight, vmm_weight, vmm_src);
+            }
+            if (m_jcp.with_zero_points)
+                uni_vbroadcastss(vmm_zero_point, ptr[reg_zero_points + reg_idx * sizeof(float)]);
+        } else if (m_jcp.with_weights) {
+            uni_vbroadcastss(vmm_weight, ptr[reg_weights + reg_i * sizeof(float)]);
+        }
+
+        for (size_t v = 0; v < vectors; v++) {
+            const auto& load_emitter = (v + 1) * vector_step <= elements ? load_vector_emitter : load_tail_emitter;
+            load_emitter->emit_code({static_cast<size_t>(reg_row.getIdx()), v * vector_step * src_size},
+                                    {static_cast<size_t>(vmm_src.getIdx())}, {}, pool_gpr_idxs);
+            if (m_jcp.with_zero_points)
+                uni_vsubps(vmm_src, vmm_src, vmm_zero_point);
+            if (m_jcp.with_scales || m_jcp.with_weights)
+                uni_vfmadd231ps(Vmm(v), vmm_src, vmm_weight);
+            else
+                uni_vaddps(Vmm(v), Vmm(v), vmm_src);
+        }
+
+        inc(reg_i);
+        cmp(reg_i, reg_indices_num);
+        jl(l_indices, T_NEAR);
+    }
+
+    L(l_store);
+    for (size_t v = 0; v < vectors; v++) {
+        const auto& store_emitter = (v + 1) * vector_step <= elements ? store_vector_emitter : store_tail_emitter;
+        store_emitter->emit_code({static_cast<size_t>(Vmm(v).getIdx())},
+                                 {static_cast<size_t>(reg_dst.getIdx()), v * vector_step * sizeof(float)},
+                                 pool_vec_idxs, pool_gpr_idxs);
+    }
+}
+
+template class EmbeddingBagSum<x64::avx512_core>;
+template class EmbeddingBagSum<x64::avx2>;
+template class EmbeddingBagSum<x64::sse41>;
+
+}   // namespace kernel
+}   // namespace intel_cpu
+}   // namespace ov
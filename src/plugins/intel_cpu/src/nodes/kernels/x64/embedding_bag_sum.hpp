@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "jit_kernel_base.hpp"
+
+#if defined(OPENVINO_ARCH_X86_64)
+#include "emitters/plugin/x64/jit_load_store_emitters.hpp"
+#endif // OPENVINO_ARCH_X86_64
+
+namespace ov {
+namespace intel_cpu {
+namespace kernel {
+
+#if defined(OPENVINO_ARCH_X86_64)
+
+struct EmbeddingBagSumCompileParams {
+    element::Type src_prc = element::f32;
+    size_t emb_depth = 0lu;
+    bool with_weights = false;
+    // the table is compressed row-wise: (table[idx] - zero_points[idx]) * scales[idx]
+    bool with_scales = false;
+    bool with_zero_points = false;
+};
+
+struct EmbeddingBagSumCallArgs {
+    const void* table;
+    const int* indices;
+    size_t indices_num = 0lu;
+    const float* weights;
+    const float* scales;
+    const float* zero_points;
+    float* dst;
+};
+
+/**
+ * @brief Sums the rows of the embedding table gathered by the indices of one bag into the f32 output row.
+ * The row is processed by blocks, the accumulators of a block are kept in the registers while the rows are
+ * gathered, and the block of the next row is prefetched since the gathered rows can't be predicted by the hardware.
+ */
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+class EmbeddingBagSum : public JitKernel<EmbeddingBagSumCompileParams, EmbeddingBagSumCallArgs> {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(EmbeddingBagSum)
+
+    explicit EmbeddingBagSum(const EmbeddingBagSumCompileParams& jcp) : JitKernel(jit_name(), jcp, isa) {}
+
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::avx512_core, Xbyak::Zmm,
+                                                         isa == dnnl::impl::cpu::x64::avx2,        Xbyak::Ymm,
+                                                                                                   Xbyak::Xmm>::type;
+    const size_t vector_step = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen / sizeof(float);
+    // number of the accumulators of a block
+    static constexpr size_t unroll = 8lu;
+    static constexpr size_t cache_line_size = 64lu;
+
+    Xbyak::Reg64 reg_table = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_indices_num = r10;
+    Xbyak::Reg64 reg_weights = r11;
+    Xbyak::Reg64 reg_scales = r12;
+    Xbyak::Reg64 reg_zero_points = r13;
+    Xbyak::Reg64 reg_dst = r14;
+    Xbyak::Reg64 reg_row = r15;
+    Xbyak::Reg64 reg_idx = rax;
+    Xbyak::Reg64 reg_i = rbx;
+    Xbyak::Reg64 reg_next_row = rdx;
+    Xbyak::Reg64 reg_blocks = rsi;
+    Xbyak::Reg64 reg_aux = rbp;
+
+    const Xbyak::Reg64 reg_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    // Vmm(0) ... Vmm(unroll - 1) are the accumulators
+    Vmm vmm_src = Vmm(unroll);
+    Vmm vmm_weight = Vmm(unroll + 1);
+    Vmm vmm_zero_point = Vmm(unroll + 2);
+
+    std::unique_ptr<jit_load_emitter> load_vector_emitter = nullptr;
+    std::unique_ptr<jit_load_emitter> load_tail_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_vector_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_tail_emitter = nullptr;
+
+    std::vector<size_t> pool_gpr_idxs;
+    std::vector<size_t> pool_vec_idxs;
+
+    void bag_block(size_t elements);
+};
+
+#endif // OPENVINO_ARCH_X86_64
+
+}   // namespace kernel
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,160 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gemv_decompression.hpp"
+
+using namespace dnnl::impl::cpu;
+
+#define GET_OFF(field) offsetof(GemvDecompressionCallArgs, field)
+
+namespace ov {
+namespace intel_cpu {
+namespace kernel {
+
+template <x64::cpu_isa_t isa>
+void GemvDecompression<isa>::generate() {
+    const bool is_4bit = m_jcp.wei_prc != element::u8;
+    // K elements processed by one step
+    const size_t step_k = is_4bit ? 2lu : 1lu;
+    const size_t steps = m_jcp.group_size / step_k;
+    const size_t unroll = steps % 4 == 0 ? 4lu : steps % 2 == 0 ? 2lu : 1lu;
+
+    this->preamble();
+
+    mov(reg_group, ptr[reg_params + GET_OFF(weights)]);
+    mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    mov(reg_groups, ptr[reg_params + GET_OFF(groups)]);
+    if (m_jcp.with_zero_points)
+        mov(reg_src_sums, ptr[reg_params + GET_OFF(src_sums)]);
+
+    if (is_4bit) {
+        mov(reg_aux.cvt32(), 0xF);
+        vmovd(Xbyak::Xmm(vmm_mask.getIdx()), reg_aux.cvt32());
+        vpbroadcastd(vmm_mask, Xbyak::Xmm(vmm_mask.getIdx()));
+    }
+    if (m_jcp.wei_prc == element::nf4) {
+        mov(reg_aux, ptr[reg_params + GET_OFF(lut)]);
+        uni_vmovups(vmm_lut_lo, ptr[reg_aux]);
+        if (isa != x64::avx512_core)
+            uni_vmovups(vmm_lut_hi, ptr[reg_aux + tile_size * sizeof(float)]);
+    }
+
+    for (size_t row = 0; row < m_jcp.rows; row++) {
+        uni_vpxor(acc(row), acc(row), acc(row));
+    }
+
+    Xbyak::Label l_group;
+    L(l_group);
+    {
+        for (size_t row = 0; row < m_jcp.rows; row++) {
+            uni_vpxor(group_acc(row), group_acc(row), group_acc(row));
+        }
+        lea(reg_weights, ptr[reg_group + params_bytes(m_jcp)]);
+
+        Xbyak::Label l_k;
+        mov(reg_k, steps / unroll);
+        L(l_k);
+        {
+            // the tiles are streamed linearly, the prefetch keeps the next cache lines ahead of the loads
+            prefetcht0(ptr[reg_weights + prefetch_distance]);
+            for (size_t i = 0; i < unroll; i++) {
+                k_step(i);
+            }
+            add(reg_weights, unroll * tile_size);
+            add(reg_src, unroll * step_k * sizeof(float));
+            dec(reg_k);
+            jnz(l_k, T_NEAR);
+        }
+
+        group_end();
+
+        // the next group follows the weights of the current one
+        mov(reg_group, reg_weights);
+        if (m_jcp.with_zero_points)
+            add(reg_src_sums, sizeof(float));
+        dec(reg_groups);
+        jnz(l_group, T_NEAR);
+    }
+
+    for (size_t row = 0; row < m_jcp.rows; row++) {
+        uni_vmovups(ptr[reg_dst + row * m_jcp.dst_stride * sizeof(float)], acc(row));
+    }
+
+    this->postamble();
+}
+
+template <x64::cpu_isa_t isa>
+void GemvDecompression<isa>::k_step(size_t offset) {
+    const auto wei_offset = offset * tile_size;
+    auto src_addr = [&](size_t row, size_t k) {
+        return ptr[reg_src + (row * m_jcp.src_stride + k) * sizeof(float)];
+    };
+
+    vpmovzxbd(vmm_wei, ptr[reg_weights + wei_offset]);
+    if (m_jcp.wei_prc == element::u8) {
+        uni_vcvtdq2ps(vmm_wei, vmm_wei);
+        for (size_t row = 0; row < m_jcp.rows; row++) {
+            uni_vbroadcastss(vmm_src, src_addr(row, offset));
+            uni_vfmadd231ps(group_acc(row), vmm_wei, vmm_src);
+        }
+        return;
+    }
+
+    // the low nibbles keep the even K element, the high nibbles keep the odd one
+    vpsrld(vmm_wei_hi, vmm_wei, 4);
+    if (isa == x64::avx512_core)
+        vpandd(vmm_wei, vmm_wei, vmm_mask);
+    else
+        vpand(vmm_wei, vmm_wei, vmm_mask);
+    if (m_jcp.wei_prc == element::nf4) {
+        dequantize_nf4(vmm_wei);
+        dequantize_nf4(vmm_wei_hi);
+    } else {
+        uni_vcvtdq2ps(vmm_wei, vmm_wei);
+        uni_vcvtdq2ps(vmm_wei_hi, vmm_wei_hi);
+    }
+    for (size_t row = 0; row < m_jcp.rows; row++) {
+        uni_vbroadcastss(vmm_src, src_addr(row, 2 * offset));
+        uni_vfmadd231ps(group_acc(row), vmm_wei, vmm_src);
+        uni_vbroadcastss(vmm_src, src_addr(row, 2 * offset + 1));
+        uni_vfmadd231ps(group_acc(row), vmm_wei_hi, vmm_src);
+    }
+}
+
+template <x64::cpu_isa_t isa>
+void GemvDecompression<isa>::dequantize_nf4(const Vmm& vmm) {
+    if (isa == x64::avx512_core) {
+        // all the 16 values fit the register
+        vpermps(vmm, vmm, vmm_lut_lo);
+        return;
+    }
+    // the third bit of the code selects the half of the table
+    vpslld(vmm_select, vmm, 28);
+    vpermps(vmm_aux, vmm, vmm_lut_lo);
+    vpermps(vmm, vmm, vmm_lut_hi);
+    vblendvps(vmm, vmm_aux, vmm, vmm_select);
+}
+
+template <x64::cpu_isa_t isa>
+void GemvDecompression<isa>::group_end() {
+    if (m_jcp.with_zero_points) {
+        uni_vmovups(vmm_aux, ptr[reg_group + tile_size * sizeof(float)]);
+        for (size_t row = 0; row < m_jcp.rows; row++) {
+            uni_vbroadcastss(vmm_src, ptr[reg_src_sums + row * m_jcp.src_sums_stride * sizeof(float)]);
+            uni_vfnmadd231ps(group_acc(row), vmm_aux, vmm_src);
+        }
+    }
+    uni_vmovups(vmm_aux, ptr[reg_group]);
+    for (size_t row = 0; row < m_jcp.rows; row++) {
+        uni_vfmadd231ps(acc(row), group_acc(row), vmm_aux);
+    }
+}
+
+template class GemvDecompression<x64::avx512_core>;
+template class GemvDecompression<x64::avx2>;
+
+}   // namespace kernel
+}   // namespace intel_cpu
+}   // namespace ov
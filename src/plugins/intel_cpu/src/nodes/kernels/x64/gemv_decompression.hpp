@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "jit_kernel_base.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace kernel {
+
+#if defined(OPENVINO_ARCH_X86_64)
+
+struct GemvDecompressionCompileParams {
+    // u8, u4 or nf4 (i4 weights are packed as u4 with the zero points shifted by 8)
+    element::Type wei_prc = element::u8;
+    // K elements sharing the scale and the zero point, even for the 4-bit weights
+    size_t group_size = 0lu;
+    // number of the src rows multiplied by one call
+    size_t rows = 1lu;
+    // src row stride in elements
+    size_t src_stride = 0lu;
+    // src group sums row stride in elements
+    size_t src_sums_stride = 0lu;
+    // dst row stride in elements
+    size_t dst_stride = 0lu;
+    bool with_zero_points = false;
+};
+
+struct GemvDecompressionCallArgs {
+    // the packed tile of the weights at the first group to be processed
+    const uint8_t* weights;
+    // the first src row at the first K element of the first group
+    const float* src;
+    // the sums of the src elements of the groups, only with the zero points
+    const float* src_sums;
+    // the first dst row at the first output channel of the tile
+    float* dst;
+    // the values of the nf4 codes
+    const float* lut;
+    size_t groups = 0lu;
+};
+
+/**
+ * @brief Multiplies a few src rows by the tile of the compressed weights of vector length output channels.
+ * The tile is streamed from the memory once for all the rows. Every group of the tile starts with the f32 scales and
+ * zero points of its output channels followed by the weights of its K elements: one byte per output channel for u8,
+ * and one byte per output channel for every pair of K elements (low nibble first) for the 4-bit weights.
+ * The weights are unpacked in the registers, the zero points are applied once per group using the src group sums:
+ * dst = sum_g scale_g * (sum_k w_k * src_k - zp_g * sum_k src_k)
+ */
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+class GemvDecompression : public JitKernel<GemvDecompressionCompileParams, GemvDecompressionCallArgs> {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(GemvDecompression)
+
+    explicit GemvDecompression(const GemvDecompressionCompileParams& jcp) : JitKernel(jit_name(), jcp, isa) {}
+
+    void generate() override;
+
+    // output channels of the tile
+    static constexpr size_t tile_size = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen / sizeof(float);
+    // a row needs two accumulators, the rest of the registers are used for the weights unpacking
+    static constexpr size_t max_rows = isa == dnnl::impl::cpu::x64::avx512_core ? 8lu : 4lu;
+
+    // the scales and the zero points of the group
+    static size_t params_bytes(const GemvDecompressionCompileParams& jcp) {
+        return (jcp.with_zero_points ? 2 : 1) * tile_size * sizeof(float);
+    }
+
+    static size_t weights_bytes(const GemvDecompressionCompileParams& jcp) {
+        return (jcp.wei_prc == element::u8 ? jcp.group_size : jcp.group_size / 2) * tile_size;
+    }
+
+    static size_t group_bytes(const GemvDecompressionCompileParams& jcp) {
+        return params_bytes(jcp) + weights_bytes(jcp);
+    }
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx512_core, Xbyak::Zmm,
+                                                                                                 Xbyak::Ymm>::type;
+    static constexpr size_t prefetch_distance = 1024lu;
+
+    Xbyak::Reg64 reg_weights = r8;
+    Xbyak::Reg64 reg_group = r9;
+    Xbyak::Reg64 reg_src = r10;
+    Xbyak::Reg64 reg_src_sums = r11;
+    Xbyak::Reg64 reg_dst = r12;
+    Xbyak::Reg64 reg_groups = r13;
+    Xbyak::Reg64 reg_k = r14;
+    Xbyak::Reg64 reg_aux = r15;
+
+    const Xbyak::Reg64 reg_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    // Vmm(0) ... Vmm(rows - 1) accumulate the rows, Vmm(max_rows) ... Vmm(max_rows + rows - 1) accumulate the group
+    Vmm vmm_wei = Vmm(2 * max_rows);
+    Vmm vmm_wei_hi = Vmm(2 * max_rows + 1);
+    Vmm vmm_src = Vmm(2 * max_rows + 2);
+    Vmm vmm_aux = Vmm(2 * max_rows + 3);
+    Vmm vmm_mask = Vmm(2 * max_rows + 4);
+    Vmm vmm_select = Vmm(2 * max_rows + 5);
+    Vmm vmm_lut_lo = Vmm(2 * max_rows + 6);
+    Vmm vmm_lut_hi = Vmm(2 * max_rows + 7);
+
+    Vmm acc(size_t row) const {
+        return Vmm(row);
+    }
+    Vmm group_acc(size_t row) const {
+        return Vmm(max_rows + row);
+    }
+
+    void k_step(size_t offset);
+    void dequantize_nf4(const Vmm& vmm);
+    void group_end();
+};
+
+#endif // OPENVINO_ARCH_X86_64
+
+}   // namespace kernel
+}   // namespace intel_cpu
+}   // namespace ov
@@ -21,65 +21,6 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
-namespace {
-class MemoryStub : public IMemory {
-public:
-    MemoryStub(const dnnl::engine& eng, const MemoryDescPtr& pMemDesc) : m_eng(eng), m_pMemDesc(pMemDesc) {}
-
-    bool isAllocated() const noexcept override {
-       return true;
-    }
-
-    const MemoryDesc& getDesc() const override {
-        return *m_pMemDesc;
-    }
-
-    MemoryDescPtr getDescPtr() const override {
-        return m_pMemDesc;
-    }
-
-    void* getData() const override {
-        OPENVINO_THROW("Unexpected call MemoryStub::getData()");
-    }
-
-    size_t getSize() const override {
-        return 0;
-    }
-
-    const Shape& getShape() const override {
-        return m_pMemDesc->getShape();
-    }
-
-    const VectorDims& getStaticDims() const override {
-        return m_pMemDesc->getShape().getStaticDims();
-    }
-
-    void redefineDesc(MemoryDescPtr desc) override {
-        m_pMemDesc = desc;
-    }
-
-    void load(const IMemory& src, bool ftz = true) const override {
-        OPENVINO_THROW("Unexpected call MemoryStub::load()");
-    }
-
-    MemoryMngrPtr getMemoryMngr() const override {
-        OPENVINO_THROW("Unexpected call MemoryStub::getMemoryMngr()");
-    }
-
-    dnnl::memory getPrimitive() const override {
-        OPENVINO_THROW("Unexpected call MemoryStub::getPrimitive()");
-    }
-
-    void nullify() override {
-        // nothing to do
-    }
-
-private:
-    dnnl::engine m_eng;
-    MemoryDescPtr m_pMemDesc;
-};
-} // namespace
-
 std::mutex MemoryNodeVirtualEdge::holderMutex;
 
 MemoryNode::MemoryNode(const std::shared_ptr<ov::Node>& op) {
@@ -0,0 +1,308 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "preprocess.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+namespace {
+
+using InterpolateBase = ov::op::util::InterpolateBase;
+
+// The coefficients match the ones used by ColorConvert node
+template <bool Round>
+void yuvToRgb(const uint8_t* y,
+              const uint8_t* u,
+              const uint8_t* v,
+              size_t chromaStep,
+              size_t width,
+              float* r,
+              float* g,
+              float* b) {
+    auto clip = [](float a) {
+        a = std::min(std::max(a, 0.f), 255.f);
+        // the value is non-negative, so truncation of a + 0.5 rounds half away from zero as std::round does
+        return Round ? static_cast<float>(static_cast<int32_t>(a + 0.5f)) : a;
+    };
+    for (size_t x = 0; x < width; x++) {
+        const size_t uvIdx = (x >> 1) * chromaStep;
+        const auto c = static_cast<float>(y[x]) - 16.f;
+        const auto d = static_cast<float>(u[uvIdx]) - 128.f;
+        const auto e = static_cast<float>(v[uvIdx]) - 128.f;
+        r[x] = clip(1.164f * c + 1.596f * e);
+        g[x] = clip(1.164f * c - 0.391f * d - 0.813f * e);
+        b[x] = clip(1.164f * c + 2.018f * d);
+    }
+}
+
+// Follows the reference implementation of Interpolate for half_pixel coordinate transformation mode
+float getOriginalCoordinate(float x, float scale) {
+    return scale == 1.0f ? x : (x + 0.5f) / scale - 0.5f;
+}
+
+// Follows the reference implementation of Interpolate for round_prefer_floor nearest mode
+int64_t getNearestPixel(float x) {
+    if (x == static_cast<int64_t>(x) + 0.5f)
+        return static_cast<int64_t>(std::floor(x));
+    return static_cast<int64_t>(std::round(x));
+}
+
+}   // namespace
+
+bool Preprocess::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto node = std::dynamic_pointer_cast<const PreprocessNode>(op);
+        if (!node) {
+            errorMessage = "Only PreprocessNode operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+Preprocess::Preprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr context)
+    : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW("CPU: " + errorMessage);
+    }
+
+    m_config = std::dynamic_pointer_cast<const PreprocessNode>(op)->get_config();
+    m_isYUV = m_config.is_nv12 || m_config.is_i420;
+    m_singlePlane = op->get_input_size() == 1;
+}
+
+void Preprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    const auto outPrecision = getOriginalOutputPrecisionAtPort(0) == ov::element::bf16 ? ov::element::bf16
+                                                                                       : ov::element::f32;
+    std::vector<PortConfigurator> inPortConfigs(getOriginalInputsNumber(), {LayoutType::ncsp, ov::element::u8});
+    addSupportedPrimDesc(inPortConfigs, {{LayoutType::ncsp, outPrecision}}, impl_desc_type::ref_any);
+}
+
+Preprocess::AxisTable Preprocess::makeAxisTable(size_t srcLen, size_t dstLen) const {
+    AxisTable table;
+    table.identity = srcLen == dstLen;
+    if (table.identity)
+        return table;
+
+    table.idx0.resize(dstLen);
+    table.idx1.resize(dstLen);
+    table.weight.resize(dstLen);
+    const bool nearest = m_config.resize_mode == InterpolateBase::InterpolateMode::NEAREST;
+    const float scale = static_cast<float>(dstLen) / static_cast<float>(srcLen);
+    const auto last = static_cast<int64_t>(srcLen) - 1;
+    for (size_t i = 0; i < dstLen; i++) {
+        const float coord = getOriginalCoordinate(static_cast<float>(i), scale);
+        int64_t idx0 = 0, idx1 = 0;
+        float weight = 0.f;
+        if (nearest) {
+            idx0 = idx1 = std::max<int64_t>(0, std::min(getNearestPixel(coord), last));
+        } else {
+            // the taps outside of the image are dropped and the weights are renormalized,
+            // which is the same as clamping the coordinate to the image
+            const auto base = static_cast<int64_t>(std::floor(coord));
+            if (base < 0) {
+                idx0 = idx1 = 0;
+            } else if (base >= last) {
+                idx0 = idx1 = last;
+            } else {
+                idx0 = base;
+                idx1 = base + 1;
+                weight = coord - static_cast<float>(base);
+            }
+        }
+        table.idx0[i] = static_cast<size_t>(idx0);
+        table.idx1[i] = static_cast<size_t>(idx1);
+        table.weight[i] = weight;
+    }
+    return table;
+}
+
+void Preprocess::prepareParams() {
+    const auto& srcDims = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto& dstDims = getDstMemoryAtPort(0)->getStaticDims();
+
+    m_batch = srcDims[0];
+    m_srcHeight = m_isYUV && m_singlePlane ? srcDims[1] * 2 / 3 : srcDims[1];
+    m_srcWidth = srcDims[2];
+    m_dstHeight = dstDims[m_config.output_nchw ? 2 : 1];
+    m_dstWidth = dstDims[m_config.output_nchw ? 3 : 2];
+
+    m_rows = makeAxisTable(m_srcHeight, m_dstHeight);
+    m_cols = makeAxisTable(m_srcWidth, m_dstWidth);
+
+    m_bufferSize = 3 * m_srcWidth + 2 * 3 * m_dstWidth;
+    m_buffers.resize(m_bufferSize * parallel_get_max_threads());
+}
+
+void Preprocess::convertRow(const uint8_t* const* src, size_t batch, size_t row, float* dst) const {
+    const size_t width = m_srcWidth;
+    float* planes[3] = {dst, dst + width, dst + 2 * width};
+
+    if (!m_isYUV) {
+        const uint8_t* frame = src[0] + (batch * m_srcHeight + row) * width * 3;
+        for (size_t x = 0; x < width; x++) {
+            planes[0][x] = static_cast<float>(frame[x * 3]);
+            planes[1][x] = static_cast<float>(frame[x * 3 + 1]);
+            planes[2][x] = static_cast<float>(frame[x * 3 + 2]);
+        }
+        return;
+    }
+
+    const size_t frameSize = m_srcHeight * width;
+    const uint8_t *y, *u, *v;
+    size_t chromaStep;
+    if (m_config.is_nv12) {
+        if (m_singlePlane) {
+            y = src[0] + batch * frameSize * 3 / 2;
+            u = y + frameSize;
+        } else {
+            y = src[0] + batch * frameSize;
+            u = src[1] + batch * frameSize / 2;
+        }
+        u += (row / 2) * width;
+        v = u + 1;
+        chromaStep = 2;
+    } else {
+        if (m_singlePlane) {
+            y = src[0] + batch * frameSize * 3 / 2;
+            u = y + frameSize;
+            v = u + frameSize / 4;
+        } else {
+            y = src[0] + batch * frameSize;
+            u = src[1] + batch * frameSize / 4;
+            v = src[2] + batch * frameSize / 4;
+        }
+        u += (row / 2) * (width / 2);
+        v += (row / 2) * (width / 2);
+        chromaStep = 1;
+    }
+    y += row * width;
+
+    float* r = planes[m_config.is_bgr ? 2 : 0];
+    float* g = planes[1];
+    float* b = planes[m_config.is_bgr ? 0 : 2];
+    if (m_config.round_color) {
+        yuvToRgb<true>(y, u, v, chromaStep, width, r, g, b);
+    } else {
+        yuvToRgb<false>(y, u, v, chromaStep, width, r, g, b);
+    }
+}
+
+void Preprocess::resizeRow(const float* src, float* dst) const {
+    const auto* idx0 = m_cols.idx0.data();
+    const auto* idx1 = m_cols.idx1.data();
+    const auto* weight = m_cols.weight.data();
+    for (size_t c = 0; c < 3; c++) {
+        const float* in = src + c * m_srcWidth;
+        float* out = dst + c * m_dstWidth;
+        for (size_t x = 0; x < m_dstWidth; x++) {
+            const float a = in[idx0[x]];
+            out[x] = a + weight[x] * (in[idx1[x]] - a);
+        }
+    }
+}
+
+template <typename T>
+void Preprocess::executeImpl() {
+    const uint8_t* src[3] = {};
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        src[i] = getSrcDataAtPortAs<const uint8_t>(i);
+    }
+    T* dst = getDstDataAtPortAs<T>(0);
+
+    const size_t srcWidth = m_srcWidth;
+    const size_t dstHeight = m_dstHeight;
+    const size_t dstWidth = m_dstWidth;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(m_batch * dstHeight, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        float* srcRow = m_buffers.data() + ithr * m_bufferSize;
+        float* slots[2] = {srcRow + 3 * srcWidth, srcRow + 3 * srcWidth + 3 * dstWidth};
+        // flattened (batch, source row) index of the row held by the slot
+        size_t slotRows[2] = {std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max()};
+
+        // Returns the source row converted to planar f32 and resized horizontally.
+        // The slot which holds the row with 'keep' index isn't reused.
+        auto getRow = [&](size_t batch, size_t row, size_t keep) -> const float* {
+            const size_t key = batch * m_srcHeight + row;
+            for (size_t i = 0; i < 2; i++) {
+                if (slotRows[i] == key)
+                    return slots[i];
+            }
+            const size_t i = slotRows[0] == keep ? 1 : 0;
+            if (m_cols.identity) {
+                convertRow(src, batch, row, slots[i]);
+            } else {
+                convertRow(src, batch, row, srcRow);
+                resizeRow(srcRow, slots[i]);
+            }
+            slotRows[i] = key;
+            return slots[i];
+        };
+
+        for (size_t i = start; i < end; i++) {
+            const size_t batch = i / dstHeight;
+            const size_t y = i % dstHeight;
+            size_t y0 = y, y1 = y;
+            float wy = 0.f;
+            if (!m_rows.identity) {
+                y0 = m_rows.idx0[y];
+                y1 = m_rows.idx1[y];
+                wy = m_rows.weight[y];
+            }
+            const float* row0 = getRow(batch, y0, batch * m_srcHeight + y1);
+            const float* row1 = wy != 0.f ? getRow(batch, y1, batch * m_srcHeight + y0) : row0;
+
+            for (size_t c = 0; c < 3; c++) {
+                const float* a = row0 + c * dstWidth;
+                const float* b = row1 + c * dstWidth;
+                const float scale = m_config.scale[c];
+                const float shift = m_config.shift[c];
+                if (m_config.output_nchw) {
+                    T* out = dst + ((batch * 3 + c) * dstHeight + y) * dstWidth;
+                    for (size_t x = 0; x < dstWidth; x++) {
+                        out[x] = static_cast<T>((a[x] + wy * (b[x] - a[x])) * scale + shift);
+                    }
+                } else {
+                    T* out = dst + (batch * dstHeight + y) * dstWidth * 3 + c;
+                    for (size_t x = 0; x < dstWidth; x++) {
+                        out[x * 3] = static_cast<T>((a[x] + wy * (b[x] - a[x])) * scale + shift);
+                    }
+                }
+            }
+        }
+    });
+}
+
+void Preprocess::execute(dnnl::stream strm) {
+    if (getDstMemoryAtPort(0)->getDesc().getPrecision() == ov::element::bf16) {
+        executeImpl<ov::bfloat16>();
+    } else {
+        executeImpl<float>();
+    }
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
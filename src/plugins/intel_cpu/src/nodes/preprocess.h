@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "node.h"
+#include "transformations/cpu_opset/common/op/preprocess.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+/**
+ * @brief Runs the fused image preprocessing chain (see PreprocessNode) row by row.
+ * Every thread processes a contiguous range of output rows and keeps in its own buffers the converted
+ * and horizontally resized source rows, so each source row is read and converted about once and
+ * no full size intermediate image is written.
+ */
+class Preprocess : public Node {
+public:
+    Preprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr context);
+
+    void getSupportedDescriptors() override {}
+    bool created() const override {
+        return getType() == Type::Preprocess;
+    }
+    void initSupportedPrimitiveDescriptors() override;
+    void prepareParams() override;
+    void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    // Maps the output coordinates along one spatial axis to pairs of source coordinates,
+    // the output value is src[idx0] + weight * (src[idx1] - src[idx0])
+    struct AxisTable {
+        std::vector<size_t> idx0;
+        std::vector<size_t> idx1;
+        std::vector<float> weight;
+        bool identity = true;
+    };
+
+    AxisTable makeAxisTable(size_t srcLen, size_t dstLen) const;
+    void convertRow(const uint8_t* const* src, size_t batch, size_t row, float* dst) const;
+    void resizeRow(const float* src, float* dst) const;
+    template <typename T>
+    void executeImpl();
+
+    PreprocessNode::Config m_config;
+    bool m_isYUV = false;
+    bool m_singlePlane = true;
+
+    size_t m_batch = 0;
+    size_t m_srcHeight = 0;
+    size_t m_srcWidth = 0;
+    size_t m_dstHeight = 0;
+    size_t m_dstWidth = 0;
+    AxisTable m_rows;
+    AxisTable m_cols;
+
+    // per thread: converted source row followed by two resized rows, all of them are planar [3, width]
+    std::vector<float> m_buffers;
+    size_t m_bufferSize = 0;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -19,6 +19,7 @@
 
 #include "convert.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "memory_desc/cpu_memory_desc_utils.h"
 #include "nodes/common/cpu_convert.h"
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/reorder_prim.h"
@@ -404,7 +405,43 @@ void Reorder::optimizedNspc2Ncsp() {
     });
 }
 
+bool Reorder::canReadBatchItems() const {
+    const auto& srcDesc = getParentEdgeAt(0)->getMemory().getDesc();
+    const auto& dstDesc = getChildEdgeAt(0)->getMemory().getDesc();
+    return !isOptimized && src_permutation.empty() && srcDesc.getShape().getRank() == dstDesc.getShape().getRank() &&
+           MemoryDescUtils::isDenseByBatch(srcDesc) && MemoryDescUtils::isDenseByBatch(dstDesc);
+}
+
+void Reorder::executeBatchItems(const std::vector<const void*>& items, dnnl::stream strm) {
+    auto dstMemPtr = getDstMemoryAtPort(0);
+    if (!batchItemPrim) {
+        auto itemDims = dstMemPtr->getStaticDims();
+        itemDims[0] = 1;
+        const auto srcItemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(getSrcMemoryAtPort(0)->getDesc().cloneWithNewDims(itemDims));
+        const auto dstItemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(dstMemPtr->getDesc().cloneWithNewDims(itemDims));
+
+        batchItemPrim = getReorderPrim(context->getParamsCache(), getEngine(), srcItemDesc->getDnnlDesc(), dstItemDesc->getDnnlDesc());
+        if (!batchItemPrim)
+            THROW_CPU_NODE_ERR("could not create reorder primitive for the batch items.");
+        batchItemSrc = dnnl::memory(srcItemDesc->getDnnlDesc(), getEngine(), DNNL_MEMORY_NONE);
+        batchItemDst = dnnl::memory(dstItemDesc->getDnnlDesc(), getEngine(), DNNL_MEMORY_NONE);
+    }
+
+    const auto dstItemSize = dstMemPtr->getSize() / items.size();
+    for (size_t i = 0; i < items.size(); i++) {
+        batchItemSrc.set_data_handle(const_cast<void*>(items[i]));
+        batchItemDst.set_data_handle(dstMemPtr->getDataAs<uint8_t>() + i * dstItemSize);
+        batchItemPrim.execute(strm, {{DNNL_ARG_SRC, batchItemSrc}, {DNNL_ARG_DST, batchItemDst}});
+    }
+}
+
 void Reorder::execute(dnnl::stream strm) {
+    const auto& batchItems = getSrcBatchItemsAtPort(0);
+    if (!batchItems.empty()) {
+        executeBatchItems(batchItems, strm);
+        return;
+    }
+
 #if defined(OV_CPU_ARM_ENABLE_FP16)
     if (transposeExecutor) {
         auto dstMemPtr = getDstMemoryAtPort(0);
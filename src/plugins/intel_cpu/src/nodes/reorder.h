@@ -49,6 +49,8 @@ public:
         return false;
     }
 
+    bool canReadBatchItems() const override;
+
     const MemoryDesc& getInput() { return *input; }
     const MemoryDesc& getOutput() { return *output; }
 
@@ -73,8 +75,13 @@ private:
     bool canUseNspc2Ncsp = false;
     bool canUseNcsp2Nspc = false;
 
+    dnnl::reorder::primitive batchItemPrim;
+    dnnl::memory batchItemSrc;
+    dnnl::memory batchItemDst;
+
     void optimizedNspc2Ncsp();
     void optimizedNcsp2Nspc();
+    void executeBatchItems(const std::vector<const void*>& items, dnnl::stream strm);
     void createReorderPrimitive(const dnnl::memory::desc &srcDesc, void* srcPtr, const dnnl::memory::desc &dstDesc, void* dstPtr);
 #if defined(OV_CPU_ARM_ENABLE_FP16)
     void prepareReorderAsTranspose(MemoryDescPtr parentDesc, MemoryDescPtr childDesc);
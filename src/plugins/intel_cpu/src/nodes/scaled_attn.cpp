@@ -748,12 +748,40 @@ struct MHASingleToken {
                     bool auto_causal,
                     float d_scale,
                     const PlainTensor& k_scale_zp,
-                    const PlainTensor& v_scale_zp) {
+                    const PlainTensor& v_scale_zp,
+                    const PagedKVCacheView& paged_k,
+                    const PagedKVCacheView& paged_v) {
         mha_single_token(query, present_key, present_value, alibi_mask, attention_mask, beams, output_emb,
-            m_attn_w, m_temp, has_out_transpose, auto_causal, d_scale, k_scale_zp, v_scale_zp, m_head_sum);
+            m_attn_w, m_temp, has_out_transpose, auto_causal, d_scale, k_scale_zp, v_scale_zp, m_head_sum,
+            paged_k, paged_v);
     }
 };
 
+// copy k/v [B, H, L, S] to the tokens [dst_offset, dst_offset + L) of the paged caches
+static void paged_kv_memcpy(const PlainTensor& k_input,
+                            const PlainTensor& v_input,
+                            const PagedKVCacheView& past_k_output,
+                            const PagedKVCacheView& past_v_output,
+                            size_t dst_offset) {
+    auto B = k_input.size(0);
+    auto H = k_input.size(1);
+    auto L = k_input.size(2);
+    auto S = k_input.size(3);
+    OPENVINO_ASSERT(k_input.stride(3) == 1 && v_input.stride(3) == 1);
+    parallel_for3d(B, H, L, [&](size_t b, size_t h, size_t m) {
+        cpu_convert(k_input.ptr_v(b, h, m),
+                    past_k_output.ptr_v(b, h, dst_offset + m),
+                    k_input.m_dt,
+                    past_k_output.precision,
+                    S);
+        cpu_convert(v_input.ptr_v(b, h, m),
+                    past_v_output.ptr_v(b, h, dst_offset + m),
+                    v_input.m_dt,
+                    past_v_output.precision,
+                    S);
+    });
+}
+
 template <ScaledDotProductAttention::KernelTypes KType, typename T>
 struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAttention::Executor {
     GraphContext::CPtr context;
@@ -773,7 +801,8 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
 
     void execute(dnnl::stream strm, const Config& config, const std::vector<MemoryPtr>& inputs, const MemoryPtr output,
                  const MemoryPtr presentk_input, const MemoryPtr presentv_input, const MemoryPtr beam_input,
-                 const PlainTensor& k_scale_zp, const PlainTensor& v_scale_zp) override {
+                 const PlainTensor& k_scale_zp, const PlainTensor& v_scale_zp,
+                 const PagedKVCacheView& paged_k, const PagedKVCacheView& paged_v) override {
         bool has_out_transpose = config.config.output_BLHxS;
         bool fuse_causal_attn = config.config.fuse_causal_attn;
         bool is_causal = config.config.is_causal;
@@ -790,8 +819,11 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
         q_input.reset(inputs[0]);
         k_input.reset(inputs[1]);
         v_input.reset(inputs[2]);
-        present_key.reset(presentk_input);
-        present_value.reset(presentv_input);
+        // the paged cache has no dense present_key/present_value
+        if (presentk_input) {
+            present_key.reset(presentk_input);
+            present_value.reset(presentv_input);
+        }
         if (beam_input)
             beam_table.reset(beam_input);
         PlainTensor attn_mask;
@@ -816,13 +848,15 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
             q_input = q_input.permute(permute_axes);
             k_input = k_input.permute(permute_axes);
             v_input = v_input.permute(permute_axes);
-            present_key = present_key.permute(permute_axes);
-            present_value = present_value.permute(permute_axes);
+            if (present_key) {
+                present_key = present_key.permute(permute_axes);
+                present_value = present_value.permute(permute_axes);
+            }
         }
         B = q_input.size(0);
         L1 = q_input.size(2);
         S = q_input.size(3);
-        L0 = present_key.size(2) - L1;
+        L0 = (paged_k ? paged_k.L : present_key.size(2)) - L1;
         auto Hk = k_input.size(1);
 
         if (fuse_concat) {
@@ -832,8 +866,13 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
             k_input.assert_dims({B, Hk, L0 + L1, S});
             v_input.assert_dims({B, Hk, L0 + L1, S});
         }
-        present_key.assert_dims({B, Hk, L0 + L1, S});
-        present_value.assert_dims({B, Hk, L0 + L1, S});
+        if (present_key) {
+            present_key.assert_dims({B, Hk, L0 + L1, S});
+            present_value.assert_dims({B, Hk, L0 + L1, S});
+        } else {
+            OPENVINO_ASSERT(paged_k.B == B && paged_k.H == Hk && paged_k.S == S,
+                            "Paged KV cache dims mismatch the current key");
+        }
         if (beam_table)
             beam_table.assert_dims({B, L0 + L1});
 
@@ -881,7 +920,8 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
             //  2, using float will save the repack cost which typically is required for bf16/int8 opt
             //  3, using dot product can leverage the SIMD while easily adapt to indirect kv cache
             kernel_single_token(q_input, present_key, present_value, {}, use_attn_mask ? attn_mask : PlainTensor(),
-                output_emb, beam_table, has_out_transpose, auto_causal, scale_input, k_scale_zp, v_scale_zp);
+                output_emb, beam_table, has_out_transpose, auto_causal, scale_input, k_scale_zp, v_scale_zp,
+                paged_k, paged_v);
         }
     }
 };
@@ -1013,12 +1053,18 @@ void ScaledDotProductAttention::execute(dnnl::stream strm) {
     }
 
     PlainTensor k_scale_zp, v_scale_zp;
+    PagedKVCacheView paged_k, paged_v;
     if (m_config.config.fuse_concat) {
         // initialization will be also completed in this func
         gatherConcatPastkv(inputs[1], inputs[2], getSrcMemoryAtPort(orginSDPInputNumber));
 
-        presentk_input = m_k_state->internal_state_mem();
-        presentv_input = m_v_state->internal_state_mem();
+        if (m_k_state->is_paged()) {
+            paged_k = m_k_state->paged_view();
+            paged_v = m_v_state->paged_view();
+        } else {
+            presentk_input = m_k_state->internal_state_mem();
+            presentv_input = m_v_state->internal_state_mem();
+        }
         beam_input = m_k_state->hidden_state_mem();
         k_scale_zp = m_k_state->get_scale_zp();
         v_scale_zp = m_v_state->get_scale_zp();
@@ -1026,7 +1072,8 @@ void ScaledDotProductAttention::execute(dnnl::stream strm) {
         presentk_input = inputs[1];
         presentv_input = inputs[2];
     }
-    m_executor->execute(strm, m_config, inputs, output, presentk_input, presentv_input, beam_input, k_scale_zp, v_scale_zp);
+    m_executor->execute(strm, m_config, inputs, output, presentk_input, presentv_input, beam_input, k_scale_zp, v_scale_zp,
+                        paged_k, paged_v);
 }
 
 bool ScaledDotProductAttention::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
@@ -1121,7 +1168,32 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
 
     // 2. resize pastkv
     ov::element::Type kvcache_precision = m_k_state->internal_desc()->getPrecision();
-    {
+    if (m_k_state->is_paged()) {
+        // gather the selected beams before the blocks are released
+        PlainTensor gathered_k, gathered_v;
+        if (L0 > 0) {
+            auto old_past_k = m_k_state->paged_view();
+            auto old_past_v = m_v_state->paged_view();
+            gathered_k.resize({B, H, L0, S}, kvcache_precision.size(), kvcache_precision);
+            gathered_v.resize({B, H, L0, S}, kvcache_precision.size(), kvcache_precision);
+            parallel_for3d(B, H, L0, [&](size_t b, size_t h, size_t m) {
+                auto idx = static_cast<size_t>(table[b]);
+                auto b_kv = static_cast<size_t>(old_beam_table_k.at<int32_t>({idx, m}));
+                memcpy(gathered_k.ptr_v(b, h, m), old_past_k.ptr_v(b_kv, h, m), S * kvcache_precision.size());
+                memcpy(gathered_v.ptr_v(b, h, m), old_past_v.ptr_v(b_kv, h, m), S * kvcache_precision.size());
+            });
+        }
+        m_k_state->paged_clear();
+        m_v_state->paged_clear();
+        m_k_state->paged_resize(B, H, L0 + L1, S);
+        m_v_state->paged_resize(B, H, L0 + L1, S);
+        auto past_k = m_k_state->paged_view();
+        auto past_v = m_v_state->paged_view();
+        if (L0 > 0) {
+            paged_kv_memcpy(gathered_k, gathered_v, past_k, past_v, 0);
+        }
+        paged_kv_memcpy(cur_k, cur_v, past_k, past_v, L0);
+    } else {
         auto shape = {B, H, (L0 + L1) * 2, S};
         auto mem_desc = std::make_shared<CpuBlockedMemoryDesc>(kvcache_precision,
             Shape(reverse(shape)),
@@ -1254,7 +1326,11 @@ void ScaledDotProductAttention::gatherConcatPastkv(const MemoryPtr& mem_cur_k, c
     }
 
     updateBeamTable(mem_beam_idx, L1);
-    updatePastkv(mem_cur_k, mem_cur_v);
+    if (m_k_state->is_paged()) {
+        updatePastkvPaged(mem_cur_k, mem_cur_v);
+    } else {
+        updatePastkv(mem_cur_k, mem_cur_v);
+    }
 }
 
 // Update beam table using beam_idx. For first token, beam table is like [[0, 0, 0, ...], [1, 1, 1, ...], ...],
@@ -1552,6 +1628,58 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
     }
 }
 
+// Paged version of updatePastkv: the cache grows by whole blocks and the cached tokens are never copied.
+void ScaledDotProductAttention::updatePastkvPaged(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v) {
+    std::vector<size_t> order = {0, 1, 2, 3};
+    if (!m_config.config.permute_axes.empty()) {
+        order = m_config.config.permute_axes;
+    }
+    PlainTensor cur_k, cur_v;
+    cur_k.reset(mem_cur_k);
+    cur_v.reset(mem_cur_v);
+    cur_k = cur_k.permute(order);
+    cur_v = cur_v.permute(order);
+    auto B = cur_k.size(0);
+    auto H = cur_k.size(1);
+    auto L1 = cur_k.size(2);
+    auto S = cur_k.size(3);
+
+    auto is_reset = m_k_state->is_reset_state();
+    auto inputNumber = getOriginalInputsNumber();
+    auto&& v_dims = getParentEdgeAt(inputNumber - 1)->getMemory().getStaticDims();
+    size_t L0 = v_dims.at(order[2]);
+    auto B_state = v_dims.at(order[0]);
+    OPENVINO_ASSERT(B == B_state, "pastkv batch: ", B, " is not equal to batch of state: ", B_state);
+    OPENVINO_ASSERT(B * (L0 + L1) > 0, "B or (L0+L1) is zero, B: ", B, ", L0: ", L0, ", L1: ", L1);
+
+    if (is_reset) {
+        m_k_state->paged_clear();
+        m_v_state->paged_clear();
+    }
+    m_k_state->paged_resize(B, H, L0 + L1, S);
+    m_v_state->paged_resize(B, H, L0 + L1, S);
+    // the tail block may be shared with a forked state
+    m_k_state->paged_prepare_write(L0, L0 + L1);
+    m_v_state->paged_prepare_write(L0, L0 + L1);
+    auto past_k = m_k_state->paged_view();
+    auto past_v = m_v_state->paged_view();
+
+    if (L0 > 0 && is_reset) {
+        auto k_mem = getSrcMemoryAtPort(inputNumber - 2);
+        auto v_mem = getSrcMemoryAtPort(inputNumber - 1);
+        if (!k_mem->getShape().hasZeroDims() && !v_mem->getShape().hasZeroDims()) {
+            PlainTensor init_k, init_v;
+            init_k.reset(k_mem);
+            init_v.reset(v_mem);
+            init_k = init_k.permute(order);
+            init_v = init_v.permute(order);
+            paged_kv_memcpy(init_k, init_v, past_k, past_v, 0);
+        }
+    }
+
+    paged_kv_memcpy(cur_k, cur_v, past_k, past_v, L0);
+}
+
 ov::element::Type ScaledDotProductAttention::getKVCachePrecision() {
     ov::element::Type kvcache_precision;
     auto rtPrecision = getRuntimePrecision();
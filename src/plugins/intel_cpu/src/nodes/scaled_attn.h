@@ -50,6 +50,7 @@ private:
     void gatherConcatPastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
     void updateBeamTable(const MemoryPtr& mem_beam_idx, size_t new_q_len);
     void updatePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v);
+    void updatePastkvPaged(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v);
     ov::element::Type getRuntimePrecision() const override;
     void resetBeamTablePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
 
@@ -60,7 +61,8 @@ private:
     struct Executor {
         virtual void execute(dnnl::stream strm, const Config& config, const std::vector<MemoryPtr>& inputs, const MemoryPtr output,
                              const MemoryPtr presentk_input, const MemoryPtr presentv_input, const MemoryPtr beam_input,
-                             const PlainTensor& k_scale_zp, const PlainTensor& v_scale_zp) = 0;
+                             const PlainTensor& k_scale_zp, const PlainTensor& v_scale_zp,
+                             const PagedKVCacheView& paged_k, const PagedKVCacheView& paged_v) = 0;
     };
 
     Config m_config;
@@ -60,32 +60,44 @@ struct SnippetKey {
     bool operator==(const SnippetKey& rhs) const;
 };
 
+// Shape-agnostic code depends only on the dimensions that are equal to 1
+VectorDims get_broadcasting_pattern(const VectorDims& dims) {
+    VectorDims pattern(dims.size());
+    std::transform(dims.begin(), dims.end(), pattern.begin(), [](size_t dim) { return static_cast<size_t>(dim == 1); });
+    return pattern;
+}
+
 size_t SnippetKey::hash() const {
     using namespace dnnl::impl;
     using namespace dnnl::impl::primitive_hashing;
 
+    auto get_dims = [this](const VectorDims& dims) {
+        return attrs.is_shape_agnostic ? get_broadcasting_pattern(dims) : dims;
+    };
+
     size_t seed = 0;
     for (const auto& blockedDim : attrs.inMemBlockedDims)
-        seed = get_vector_hash(seed, blockedDim);
+        seed = get_vector_hash(seed, get_dims(blockedDim));
     for (const auto& order : attrs.inMemOrders)
         seed = get_vector_hash(seed, order);
     for (const auto& prec : attrs.inMemPrecs)
         seed = hash_combine(seed, prec.hash());
 
     for (const auto& blockedDim : attrs.outMemBlockedDims)
-        seed = get_vector_hash(seed, blockedDim);
+        seed = get_vector_hash(seed, get_dims(blockedDim));
     for (const auto& order : attrs.outMemOrders)
         seed = get_vector_hash(seed, order);
     for (const auto& prec : attrs.outMemPrecs)
         seed = hash_combine(seed, prec.hash());
 
     seed = hash_combine(seed, attrs.bodyHash);
+    seed = hash_combine(seed, attrs.is_shape_agnostic);
 
     return seed;
 }
 
 bool SnippetKey::operator==(const SnippetKey& rhs) const {
-    if (attrs.bodyHash != rhs.attrs.bodyHash)
+    if (attrs.bodyHash != rhs.attrs.bodyHash || attrs.is_shape_agnostic != rhs.attrs.is_shape_agnostic)
         return false;
     if (attrs.inMemBlockedDims.size() != rhs.attrs.inMemBlockedDims.size() ||
         attrs.inMemOrders.size() != rhs.attrs.inMemOrders.size() ||
@@ -96,12 +108,15 @@ bool SnippetKey::operator==(const SnippetKey& rhs) const {
         attrs.outMemPrecs.size() != rhs.attrs.outMemPrecs.size())
         return false;
 
+    auto equal_dims = [this](const VectorDims& lhs, const VectorDims& rhs) {
+        return attrs.is_shape_agnostic ? get_broadcasting_pattern(lhs) == get_broadcasting_pattern(rhs) : lhs == rhs;
+    };
     for (size_t i = 0; i < attrs.inMemBlockedDims.size(); i++) {
-        if (!(attrs.inMemBlockedDims[i] == rhs.attrs.inMemBlockedDims[i]))
+        if (!equal_dims(attrs.inMemBlockedDims[i], rhs.attrs.inMemBlockedDims[i]))
             return false;
     }
     for (size_t i = 0; i < attrs.outMemBlockedDims.size(); i++) {
-        if (!(attrs.outMemBlockedDims[i] == rhs.attrs.outMemBlockedDims[i]))
+        if (!equal_dims(attrs.outMemBlockedDims[i], rhs.attrs.outMemBlockedDims[i]))
             return false;
     }
     for (size_t i = 0; i < attrs.inMemOrders.size(); i++) {
@@ -153,6 +168,11 @@ uint64_t Snippet::get_body_hash(const std::shared_ptr<snippets::op::Subgraph>& s
     return seed;
 }
 
+bool Snippet::isShapeAgnosticApplicable() const {
+    return is_dynamic && snippetAttrs.snippet->is_shape_agnostic_supported() &&
+           getOriginalInputsNumber() + getOriginalOutputsNumber() <= snippets::op::Subgraph::shape_agnostic_max_data_count;
+}
+
 void Snippet::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
@@ -169,8 +189,9 @@ void Snippet::initSupportedPrimitiveDescriptors() {
     }
 
     const size_t ndims = outputShapes[0].getRank();
-    // Domain sensitive operations support only Planar layout
-    const bool isOnlyPlanarApplicable = snippetAttrs.snippet->has_domain_sensitive_ops();
+    // Domain sensitive operations support only Planar layout.
+    // Shape-agnostic code is generated only for Planar layout as well, so it's enforced for the dynamic element-wise bodies
+    const bool isOnlyPlanarApplicable = snippetAttrs.snippet->has_domain_sensitive_ops() || isShapeAgnosticApplicable();
     const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1u, 2u, 3u, 4u, 5u) && dimRanksAreEqual && !isOnlyPlanarApplicable;
     // Todo: Snippets currently don't support per-channel broadcasting of Blocked descriptors because
     //  canonicalization can't distinguish between <N, C, H, W, c> and <N, C, D, H, W> cases.
@@ -317,10 +338,16 @@ void Snippet::initOptimalPrimitiveDescriptor() {
     outputNum = config.outConfs.size();
     snippetAttrs.outMemPrecs.resize(outputNum);
     snippetAttrs.outMemOrders.resize(outputNum);
+    bool has_non_planar_outputs = false;
     for (size_t i = 0; i < outputNum; i++) {
         snippetAttrs.outMemPrecs[i] = config.outConfs[i].getMemDesc()->getPrecision();
         snippetAttrs.outMemOrders[i] = config.outConfs[i].getMemDesc()->as<BlockedMemoryDesc>()->getOrder();
+        has_non_planar_outputs |= !isPlanar(snippetAttrs.outMemOrders[i]);
     }
+    // Dynamic element-wise subgraphs are compiled once per broadcasting pattern, the shapes are passed to kernel at runtime.
+    // Note: shape-agnostic kernel reserves one more GPR for the runtime args, so the number of data pointers is limited
+    snippetAttrs.is_shape_agnostic = isShapeAgnosticApplicable() && !snippetAttrs.has_non_planar_inputs && !has_non_planar_outputs;
+    snippetAttrs.snippet->set_shape_agnostic(snippetAttrs.is_shape_agnostic);
     // reserve fixed size.
     snippetAttrs.inMemBlockedDims.resize(inputNum);
     snippetAttrs.outMemBlockedDims.resize(outputNum);
@@ -402,11 +429,22 @@ void Snippet::prepareParams() {
 
     auto builder = [this](const SnippetKey& key) -> std::shared_ptr<SnippetExecutor> {
         std::shared_ptr<SnippetExecutor> executor =
-                std::make_shared<SnippetJitExecutor>(key.attrs, is_dynamic);
+                std::make_shared<SnippetJitExecutor>(key.attrs, is_dynamic, context->getSocketCache());
         return executor;
     };
 
     auto getOrCreateExecutor = [this, &key, &builder]() {
+        if (snippetAttrs.is_shape_agnostic) {
+            // The executor keeps the runtime args of the current shapes, so it's owned by the node and isn't shared via params cache.
+            // The code is still shared via socket cache and is regenerated only if the broadcasting pattern is changed
+            auto jit_executor = std::dynamic_pointer_cast<SnippetJitExecutor>(execPtr);
+            if (jit_executor && jit_executor->is_compatible(key.attrs)) {
+                jit_executor->update_runtime_args(key.attrs);
+            } else {
+                execPtr = builder(key);
+            }
+            return;
+        }
         auto cache = context->getParamsCache();
         auto result = cache->getOrCreate(key, builder);
         execPtr = result.first;
@@ -423,7 +461,7 @@ void Snippet::prepareParams() {
         getOrCreateExecutor();
     } else {
         // in case perf count is enabled, disable executor cache by default to not mix up perf counters for different subgraphs.
-        execPtr = std::make_shared<SnippetJitExecutor>(key.attrs, is_dynamic);
+        execPtr = std::make_shared<SnippetJitExecutor>(key.attrs, is_dynamic, nullptr);
     }
 #endif
 }
@@ -511,6 +549,9 @@ void Snippet::SnippetJitExecutor::update_ptrs(jit_snippets_call_args& call_args,
     for (size_t i = 0; i < outMemPtrs.size(); i++)
         call_args.dst_ptrs[i] = outMemPtrs[i]->getDataAs<uint8_t>() + start_offset_out[i];
 
+    if (runtime_config)
+        call_args.runtime_args = runtime_config->get_runtime_args().data();
+
     if (buffer_scratchpad_size > 0) {
         call_args.buffer_scratchpad_ptr =
                 reinterpret_cast<uint8_t*>(buffer_scratchpad.data()) + parallel_get_thread_num() * buffer_scratchpad_size;
@@ -579,7 +620,7 @@ void Snippet::SnippetJitExecutor::schedule_nt(const std::vector<MemoryPtr>& inMe
 Snippet::SnippetExecutor::SnippetExecutor(SnippetAttrs attrs, bool is_dynamic)
     : snippetAttrs(std::move(attrs)), is_dynamic(is_dynamic) {}
 
-Snippet::SnippetJitExecutor::SnippetJitExecutor(SnippetAttrs attrs, bool is_dynamic) :
+Snippet::SnippetJitExecutor::SnippetJitExecutor(SnippetAttrs attrs, bool is_dynamic, const SharedMultiCachePtr& socketCache) :
     SnippetExecutor(std::move(attrs), is_dynamic) {
     numInput = snippetAttrs.inMemBlockedDims.size();
     numOutput = snippetAttrs.outMemBlockedDims.size();
@@ -614,14 +655,50 @@ Snippet::SnippetJitExecutor::SnippetJitExecutor(SnippetAttrs attrs, bool is_dyna
     // generate
     jit_snippets_compile_args jcp;
     jcp.parallel_executor_ndims = tensorRank;
-    generate(&jcp);
+    if (socketCache) {
+        // the generated code is immutable, so the executors of the other streams reuse it,
+        // the buffer scratchpad stays per executor since it's indexed by the thread number within the stream
+        auto builder = [this, &jcp](const SnippetKey&) -> std::shared_ptr<snippets::Schedule> {
+            generate(&jcp);
+            return std::make_shared<snippets::Schedule>(schedule);
+        };
+        auto result = socketCache->getOrCreate(SnippetKey{snippetAttrs}, builder);
+        if (!result.first)
+            OPENVINO_THROW("Snippets: the code generation failed");
+        schedule = *result.first;
+    } else {
+        generate(&jcp);
+    }
     buffer_scratchpad_size = schedule.lowering_result.buffer_scratchpad_size;
     buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
+    if (snippetAttrs.is_shape_agnostic) {
+        OPENVINO_ASSERT(schedule.lowering_result.runtime_config, "Snippets: shape-agnostic kernel must have runtime config");
+        // the config is shared with the cached code, the runtime args are calculated in the executor copy
+        runtime_config = std::make_shared<snippets::RuntimeConfig>(*schedule.lowering_result.runtime_config);
+        update_runtime_args(snippetAttrs);
+        return;
+    }
     parallel_exec_domain = schedule.parallel_exec_domain;
     harnessWorkAmount = std::accumulate(parallel_exec_domain.begin(), parallel_exec_domain.end(), 1, std::multiplies<size_t>());
     parallel_exec_domain = getNormalizedDimsBySize(parallel_exec_domain, tensorRank);
 }
 
+bool Snippet::SnippetJitExecutor::is_compatible(const SnippetAttrs& attrs) const {
+    return SnippetKey{snippetAttrs} == SnippetKey{attrs};
+}
+
+void Snippet::SnippetJitExecutor::update_runtime_args(const SnippetAttrs& attrs) {
+    OPENVINO_ASSERT(runtime_config, "Snippets: runtime args can be updated only for shape-agnostic kernel");
+    // Note: shape-agnostic kernels support only planar layouts, so the blocked dims are the planar shapes
+    std::vector<VectorDims> io_shapes(attrs.inMemBlockedDims);
+    io_shapes.insert(io_shapes.end(), attrs.outMemBlockedDims.begin(), attrs.outMemBlockedDims.end());
+    runtime_config->update(io_shapes, tensorRank);
+
+    parallel_exec_domain = runtime_config->get_parallel_exec_domain();
+    harnessWorkAmount = std::accumulate(parallel_exec_domain.begin(), parallel_exec_domain.end(), 1, std::multiplies<size_t>());
+    parallel_exec_domain = getNormalizedDimsBySize(parallel_exec_domain, tensorRank);
+}
+
 void Snippet::SnippetJitExecutor::generate(const jit_snippets_compile_args* jcp) {
     std::vector<ov::snippets::lowered::pass::PassPipeline::PositionedPassLowered> backend_passes;
 
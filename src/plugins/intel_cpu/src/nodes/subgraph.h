@@ -52,12 +52,16 @@ public:
         std::vector<ov::element::Type> outMemPrecs;
         // todo: used flag if we need extra shape infer, can be removed after [121670]
         bool has_non_planar_inputs;
+        // the code doesn't depend on shapes, the shapes are passed to kernel at runtime
+        bool is_shape_agnostic = false;
     };
 
 private:
     typedef void (*kernel)(const void *, const void *);
 
     static uint64_t get_body_hash(const std::shared_ptr<snippets::op::Subgraph>& snippet);
+    // Returns true if the dynamic body can be compiled once per broadcasting pattern (planar layouts are also required)
+    bool isShapeAgnosticApplicable() const;
 
     size_t inputNum = 0;
     size_t outputNum = 0;
@@ -87,10 +91,19 @@ private:
 
     class SnippetJitExecutor : public SnippetExecutor {
         public:
-            SnippetJitExecutor(SnippetAttrs attrs, bool is_dynamic);
+            /**
+             * @param socketCache the cache to share the generated code with the other streams, nullptr to generate
+             * the code exclusively for this executor
+             */
+            SnippetJitExecutor(SnippetAttrs attrs, bool is_dynamic, const SharedMultiCachePtr& socketCache);
             void exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) override;
 
             bool schedule_created();
+            // Returns true if the generated code can be used for the attrs (the same code is used for shape-agnostic executors
+            // if the broadcasting pattern of shapes is the same)
+            bool is_compatible(const SnippetAttrs& attrs) const;
+            // Recalculates the runtime args of shape-agnostic kernel and the parallel execution domain for the new shapes
+            void update_runtime_args(const SnippetAttrs& attrs);
 
         private:
             static const size_t rank6D {6};
@@ -122,6 +135,9 @@ private:
             std::vector<ptrdiff_t> start_offset_in = {};
             std::vector<ptrdiff_t> start_offset_out = {};
 
+            // Runtime args of shape-agnostic kernel for the current shapes
+            std::shared_ptr<snippets::RuntimeConfig> runtime_config = nullptr;
+
             // Buffer scratchpad
             std::vector<uint8_t> buffer_scratchpad = {};
             size_t buffer_scratchpad_size = 0;
@@ -12,6 +12,7 @@
 #include "utils/general_utils.h"
 #include "utils/debug_capabilities.h"
 
+#include <array>
 #include <string>
 #include <vector>
 
@@ -75,6 +76,32 @@ static void nullifyUndefinedDims(VectorDims& dims) {
     });
 }
 
+// the same checks as for the user memory set as the input of the graph:
+// the data may be read from an external buffer only if none of the consumers works in-place
+static bool canBindInputMemory(const NodePtr& inputNode) {
+    for (auto& edge : inputNode->getChildEdgesAtPort(0)) {
+        const auto& child = edge->getChild();
+        if (child->isConstant() || child->getType() == Type::Output)
+            return false;
+        if (edge->inPlace(Edge::LOOK_DOWN) || edge->modifiedInPlace())
+            return false;
+        if (child->getType() == Type::Concatenation && child->isInPlace())
+            return false;
+        if (edge->getMemory().getDesc().getPrecision() == ov::element::string)
+            return false;
+    }
+    return true;
+}
+
+// the data may be written to an external buffer only if the producer memory isn't shared with other edges
+static bool canBindOutputMemory(const NodePtr& outputNode) {
+    const auto parentEdge = outputNode->getParentEdgeAt(0);
+    const auto& parent = parentEdge->getParent();
+    if (parent->getType() == Type::Input || parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace())
+        return false;
+    return parentEdge->getMemory().getDesc().getPrecision() != ov::element::string;
+}
+
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to, bool sliced_src,
@@ -157,6 +184,77 @@ public:
     }
 };
 
+/**
+ * Zero-copy analogue of PortIteratorHelper: instead of copying the chunk, the body memory
+ * is rebound to the chunk of the external tensor. The chunk must be a dense part of the tensor.
+ */
+class PortViewHelper : public PortMapHelper {
+public:
+    PortViewHelper(const MemoryPtr &full, const std::vector<MemoryPtr> &parts, const PortMap &slice_rule)
+                   : full_mem(full), part_mems(parts) {
+        const auto abs_stride = std::abs(slice_rule.stride);
+        const auto sign_of_stride = slice_rule.stride < 0 ? -1 : 1;
+
+        iter_count = full_mem->getStaticDims()[slice_rule.axis] / abs_stride;
+
+        // all the outer dims are 1, so the chunks follow each other
+        chunk_size_in_byte = part_mems.front()->getSize();
+        chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_size_in_byte : 0;
+        chunk_stride_in_byte = sign_of_stride * static_cast<ptrdiff_t>(chunk_size_in_byte);
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        OPENVINO_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto chunk_ptr = full_mem->getDataAs<uint8_t>() + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (auto &mem : part_mems)
+            mem->getMemoryMngr()->setExtBuff(chunk_ptr, chunk_size_in_byte);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+    size_t chunk_size_in_byte = 0lu;
+
+    MemoryPtr full_mem;
+    std::vector<MemoryPtr> part_mems;
+
+    int iter_count;
+};
+
+/**
+ * Zero-copy analogue of BackEdgePortHelper: the body output and the body input are bound
+ * to two buffers which are swapped before each iteration, so the result of the previous
+ * iteration becomes the input of the next one without copying.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const MemoryPtr &from, const std::vector<MemoryPtr> &to, const dnnl::engine& eng)
+                       : from_mem(from), to_mems(to) {
+        buffers[0] = std::make_shared<Memory>(eng, from_mem->getDescPtr());
+        buffers[1] = std::make_shared<Memory>(eng, from_mem->getDescPtr());
+        bind();
+    }
+
+    void execute(dnnl::stream strm, int iter = -1) override {
+        if (iter != 0) {
+            std::swap(buffers[0], buffers[1]);
+            bind();
+        }
+    }
+
+private:
+    void bind() {
+        for (auto &mem : to_mems)
+            mem->getMemoryMngr()->setExtBuff(buffers[0]->getData(), buffers[0]->getSize());
+        from_mem->getMemoryMngr()->setExtBuff(buffers[1]->getData(), buffers[1]->getSize());
+    }
+
+    MemoryPtr from_mem;
+    std::vector<MemoryPtr> to_mems;
+    std::array<MemoryPtr, 2> buffers;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MemoryPtr &to, const dnnl::engine& eng) {
@@ -416,6 +514,7 @@ void TensorIterator::getSupportedDescriptors() {
         auto inNode = inMap.find(param->get_friendly_name());
         if (inNode != inMap.end()) {
             input_mems.push_back(getToMemories(inNode->second.get(), 0));
+            input_mems_bindable.push_back(canBindInputMemory(inNode->second));
         }
     }
 
@@ -427,6 +526,7 @@ void TensorIterator::getSupportedDescriptors() {
         if (outNode != outMap.end()) {
             auto outMem = outNode->second->getSrcMemoryAtPort(0);
             output_mem.push_back(outMem);
+            output_mem_bindable.push_back(canBindOutputMemory(outNode->second));
         }
     }
 
@@ -648,6 +748,9 @@ void TensorIterator::prepareInputPorts() {
         if (map_rule.axis == -1)
             first_mappers.emplace(std::make_pair(map_rule.from, map_rule.to),
                                 std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+        else if (!runAsDynamic() && input_mems_bindable[map_rule.to] && canBindSliceView(from_mem, to_mem, map_rule))
+            before_mappers.emplace_back(
+                    std::make_shared<PortViewHelper>(from_mem, input_mems[map_rule.to], map_rule));
         else
             before_mappers.emplace_back(
                     std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, true, map_rule, eng));
@@ -660,8 +763,21 @@ void TensorIterator::prepareOutputPorts() {
         auto to_mem = getDstMemoryAtPort(map_rule.from);
         auto &from_mem = output_mem[map_rule.to];
 
+        // the body output can be bound to the chunk of the external tensor only if no other rule reads it
+        const auto isShared = [&](const PortMap& rule) {
+            return rule.axis != -1 && rule.to == map_rule.to;
+        };
+        const auto isBackEdge = [&](const PortMap& rule) {
+            return rule.from == map_rule.to;
+        };
+        const bool canBindOutput = output_mem_bindable[map_rule.to] &&
+                                   std::count_if(outputPortMap.begin(), outputPortMap.end(), isShared) == 1 &&
+                                   std::none_of(backEdges.begin(), backEdges.end(), isBackEdge);
+
         if (map_rule.axis == -1)
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+        else if (canBindOutput && canBindSliceView(to_mem, from_mem, map_rule))
+            before_mappers.emplace_back(std::make_shared<PortViewHelper>(to_mem, std::vector<MemoryPtr>{from_mem}, map_rule));
         else
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, false, map_rule, eng));
     }
@@ -672,7 +788,10 @@ void TensorIterator::prepareBackEdges() {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mems[map_rule.to].front();
 
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+        if (canSwapBackEdge(map_rule))
+            before_mappers.emplace_back(std::make_shared<BackEdgeSwapHelper>(from_mem, input_mems[map_rule.to], getEngine()));
+        else
+            before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
     }
 }
 
@@ -732,6 +851,33 @@ void TensorIterator::prepareTripCount() {
     lastUsedTripCount = trip_count_check->getStatus();
 }
 
+/* *==============* Zero-copy binding of body inputs and outputs *==============* */
+
+bool TensorIterator::canBindSliceView(const MemoryPtr& full_mem, const MemoryPtr& part_mem, const PortMap& map_rule) const {
+    const auto& full_dims = full_mem->getStaticDims();
+    const auto& part_dims = part_mem->getStaticDims();
+    // the chunk is a dense part of the tensor only if all the outer dims are 1
+    if (std::any_of(full_dims.begin(), full_dims.begin() + map_rule.axis, [](size_t dim) { return dim != 1; }))
+        return false;
+
+    const auto& prec = full_mem->getDesc().getPrecision();
+    return full_mem->getDesc().isCompatible(CpuBlockedMemoryDesc(prec, Shape(full_dims))) &&
+           part_mem->getDesc().isCompatible(CpuBlockedMemoryDesc(prec, Shape(part_dims)));
+}
+
+bool TensorIterator::canSwapBackEdge(const PortMap& map_rule) const {
+    const auto& from_mem = output_mem[map_rule.from];
+    const auto& to_mem = input_mems[map_rule.to].front();
+    if (!output_mem_bindable[map_rule.from] || !input_mems_bindable[map_rule.to] ||
+        from_mem->getMemoryMngr() == to_mem->getMemoryMngr() || !from_mem->getDesc().isCompatible(to_mem->getDesc()))
+        return false;
+
+    // one body output can be bound to one pair of buffers only
+    return std::count_if(backEdges.begin(), backEdges.end(), [&](const PortMap& rule) {
+        return rule.from == map_rule.from;
+    }) == 1;
+}
+
 /* *==============* *==============* *==============* *==============* *==============* */
 
 inline VectorDims sliced_input_dims(const MemoryPtr& mem, const int axis, const int stride) {
@@ -133,6 +133,10 @@ private:
     void prepareInitialCond();
     void prepareTripCount();
 
+    /* Zero-copy support */
+    bool canBindSliceView(const MemoryPtr& full_mem, const MemoryPtr& part_mem, const PortMap& map_rule) const;
+    bool canSwapBackEdge(const PortMap& map_rule) const;
+
     /* Dynamic support */
     void reshapeSubgraphInput();
     void reshapeAndFillOutput(dnnl::stream strm);
@@ -147,6 +151,10 @@ private:
     std::vector<std::vector<MemoryPtr>> input_mems;
     std::vector<MemoryPtr> output_mem;
 
+    /* Body inputs and outputs whose memory may be rebound to external buffers without copying */
+    std::vector<bool> input_mems_bindable;
+    std::vector<bool> output_mem_bindable;
+
     struct PortMapHasher {
         std::size_t operator()(const std::pair<int, int>& p) const {
             std::size_t seed = 0;
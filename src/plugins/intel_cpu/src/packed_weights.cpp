@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "packed_weights.h"
+
+#include "nodes/common/cpu_memcpy.h"
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+// "CPUPACKW" read as little endian 64-bit integer, never matches the first field of StreamSerialize::DataHeader
+constexpr uint64_t packedWeightsMagic = 0x574B434150555043;
+// the alignment of the packed weights in the stream, so the mmapped data keeps the alignment the kernels prefer
+constexpr uint64_t packedWeightsAlignment = 64;
+
+void writeValue(std::ostream& stream, uint64_t value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+uint64_t readValue(std::istream& stream) {
+    uint64_t value = 0;
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+}
+
+uint64_t paddingTo(uint64_t pos) {
+    return (packedWeightsAlignment - pos % packedWeightsAlignment) % packedWeightsAlignment;
+}
+}  // namespace
+
+void PackedWeights::write(std::ostream& stream, const Entries& entries) {
+    writeValue(stream, packedWeightsMagic);
+    writeValue(stream, entries.size());
+    const char zeros[packedWeightsAlignment] = {};
+    for (const auto& entry : entries) {
+        const auto& key = entry.first;
+        const auto& memory = entry.second;
+        writeValue(stream, key.size());
+        stream.write(key.data(), key.size());
+        writeValue(stream, memory->getSize());
+        stream.write(zeros, paddingTo(static_cast<uint64_t>(stream.tellp())));
+        stream.write(memory->getDataAs<const char>(), memory->getSize());
+    }
+}
+
+PackedWeights::Ptr PackedWeights::read(std::istream& stream, std::shared_ptr<ov::AlignedBuffer> model_buffer) {
+    const auto pos = stream.tellg();
+    if (readValue(stream) != packedWeightsMagic || !stream) {
+        stream.clear();
+        stream.seekg(pos);
+        return nullptr;
+    }
+
+    // the lengths read from the stream are checked against its size, so a corrupted section doesn't cause a huge
+    // allocation
+    const auto sectionPos = stream.tellg();
+    stream.seekg(0, std::ios::end);
+    const auto streamEnd = static_cast<uint64_t>(stream.tellg());
+    stream.seekg(sectionPos);
+    auto checkLength = [&](uint64_t length) {
+        if (!stream || length > streamEnd - static_cast<uint64_t>(stream.tellg())) {
+            OPENVINO_THROW("NetworkNotRead: The packed weights section is corrupted.");
+        }
+    };
+
+    auto packedWeights = std::make_shared<PackedWeights>();
+    const auto count = readValue(stream);
+    for (uint64_t i = 0; i < count; i++) {
+        const auto keySize = readValue(stream);
+        checkLength(keySize);
+        std::string key(keySize, '\0');
+        stream.read(&key[0], key.size());
+        const auto size = readValue(stream);
+        stream.seekg(paddingTo(static_cast<uint64_t>(stream.tellg())), std::ios::cur);
+        checkLength(size);
+        const auto offset = static_cast<uint64_t>(stream.tellg());
+        stream.seekg(size, std::ios::cur);
+        if (!stream) {
+            OPENVINO_THROW("NetworkNotRead: The packed weights section is corrupted.");
+        }
+        if (model_buffer && offset + size <= model_buffer->size()) {
+            packedWeights->m_entries[key] = {model_buffer->get_ptr<char>() + offset, size};
+        }
+    }
+
+    if (packedWeights->m_entries.empty()) {
+        return nullptr;
+    }
+    packedWeights->m_buffer = std::move(model_buffer);
+    return packedWeights;
+}
+
+MemoryPtr PackedWeights::find(const std::string& key, const dnnl::engine& engine, const MemoryDescPtr& desc) const {
+    auto itr = m_entries.find(key);
+    if (itr == m_entries.end() || itr->second.second != desc->getCurrentMemSize()) {
+        return nullptr;
+    }
+    // the packed weights are copied out of the blob, since the weights cache may share them
+    // with other compiled models which outlive the mmapped blob of this one
+    auto memory = std::make_shared<Memory>(engine, desc);
+    cpu_parallel_memcpy(memory->getData(), itr->second.first, itr->second.second);
+    return memory;
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+#include "openvino/runtime/aligned_buffer.hpp"
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Weights already reordered into the layouts the kernels of a compiled graph have selected.
+ * The section is written in front of the serialized model when the compiled model is exported, so the import from
+ * the model cache reuses the packed weights instead of repeating the weights reorders of every node.
+ * The packed data is located in the memory mapped cache blob and copied out of it only for the weights a node asks
+ * for, the section is skipped when the blob is read from a plain stream, since keeping a copy of all the packed
+ * weights would double the memory footprint.
+ */
+class PackedWeights {
+public:
+    using Ptr = std::shared_ptr<PackedWeights>;
+    using CPtr = std::shared_ptr<const PackedWeights>;
+    using Entries = std::vector<std::pair<std::string, MemoryCPtr>>;
+
+    static std::string key(const std::string& nodeName,
+                           const std::string& format,
+                           const ov::element::Type& precision) {
+        return nodeName + "_" + format + "_" + precision.get_type_name();
+    }
+
+    /**
+     * @brief Writes the section with the given packed weights, the data of each entry is aligned within the stream
+     */
+    static void write(std::ostream& stream, const Entries& entries);
+
+    /**
+     * @brief Reads the section at the current stream position
+     * @param model_buffer The memory mapped blob the stream reads, may be nullptr
+     * @return nullptr if there is no section (blob of the older version) or if the packed weights are not usable
+     */
+    static Ptr read(std::istream& stream, std::shared_ptr<ov::AlignedBuffer> model_buffer);
+
+    /**
+     * @brief Creates the memory with a copy of the packed weights of the given key
+     * The data is copied rather than referred in place, since the weights cache may share the memory with other
+     * compiled models which outlive the memory mapped blob
+     * @return nullptr if there are no weights with the key or their size doesn't match the descriptor
+     */
+    MemoryPtr find(const std::string& key, const dnnl::engine& engine, const MemoryDescPtr& desc) const;
+
+private:
+    std::shared_ptr<ov::AlignedBuffer> m_buffer;
+    std::unordered_map<std::string, std::pair<const char*, size_t>> m_entries;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
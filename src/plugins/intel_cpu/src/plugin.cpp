@@ -11,6 +11,7 @@
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
+#include "packed_weights.h"
 #include "serialize.h"
 #include "transformations/transformation_pipeline.h"
 #include "transformations/utils/utils.hpp"
@@ -368,7 +369,24 @@ Engine::compile_model(const std::shared_ptr<const ov::Model>& model, const ov::A
             denormals_as_zero(false);
         }
     }
-    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false, get_shared_weights(conf));
+}
+
+std::shared_ptr<SocketsWeights> Engine::get_shared_weights(const Config& conf) const {
+    if (conf.weightsSharingId.empty())
+        return nullptr;
+    std::lock_guard<std::mutex> lock(m_shared_weights_mutex);
+    auto& weights = m_shared_weights[conf.weightsSharingId];
+    auto shared_weights = weights.lock();
+    if (!shared_weights) {
+        shared_weights = std::make_shared<SocketsWeights>();
+        weights = shared_weights;
+    }
+    // drop the entries of the released models
+    for (auto it = m_shared_weights.begin(); it != m_shared_weights.end();) {
+        it = it->second.expired() ? m_shared_weights.erase(it) : std::next(it);
+    }
+    return shared_weights;
 }
 
 void Engine::set_property(const ov::AnyMap &config) {
@@ -455,6 +473,8 @@ ov::Any Engine::get_property(const std::string& name, const ov::AnyMap& options)
         return res;
     } else if (name == ov::internal::exclusive_async_requests.name()) {
         return engConfig.exclusiveAsyncRequests;
+    } else if (name == ov::internal::weights_sharing_id.name()) {
+        return engConfig.weightsSharingId;
     }
     return get_ro_property(name, options);
 }
@@ -506,6 +526,8 @@ ov::Any Engine::get_ro_property(const std::string& name, const ov::AnyMap& optio
         return decltype(ov::internal::supported_properties)::value_type{
             ov::PropertyName{ov::internal::caching_properties.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::internal::weights_sharing_id.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::internal::cached_model_buffer.name(), ov::PropertyMutability::RW},
             ov::PropertyName{ov::internal::compiled_model_runtime_properties.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::internal::compiled_model_runtime_properties_supported.name(), ov::PropertyMutability::RO}};
     } else if (name == ov::device::full_name) {
@@ -617,7 +639,19 @@ std::shared_ptr<ov::ICompiledModel> Engine::import_model(std::istream& networkMo
                                             const ov::AnyMap& config) const{
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "import_model");
 
+    std::shared_ptr<ov::AlignedBuffer> model_buffer;
+    auto _config = config;
+    const auto& buffer_it = _config.find(ov::internal::cached_model_buffer.name());
+    if (buffer_it != _config.end()) {
+        model_buffer = buffer_it->second.as<std::shared_ptr<ov::AlignedBuffer>>();
+        _config.erase(buffer_it);
+    }
+
+    // the weights packed by the exported graph precede the model
+    auto packedWeights = PackedWeights::read(networkModel, model_buffer);
+
     ModelDeserializer deserializer(networkModel,
+        model_buffer,
         [this](const std::string& model, const ov::Tensor& weights) {
             return get_core()->read_model(model, weights, true);
         });
@@ -629,7 +663,6 @@ std::shared_ptr<ov::ICompiledModel> Engine::import_model(std::istream& networkMo
     Config::ModelType modelType = getModelType(model);
 
     // check ov::loaded_from_cache property and erase it to avoid exception in readProperties.
-    auto _config = config;
     const auto& it = _config.find(ov::loaded_from_cache.name());
     bool loaded_from_cache = false;
     if (it != _config.end()) {
@@ -640,7 +673,12 @@ std::shared_ptr<ov::ICompiledModel> Engine::import_model(std::istream& networkMo
 
     // import config props from caching model
     calculate_streams(conf, model, true);
-    auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    auto compiled_model = std::make_shared<CompiledModel>(model,
+                                                          shared_from_this(),
+                                                          conf,
+                                                          loaded_from_cache,
+                                                          get_shared_weights(conf),
+                                                          packedWeights);
     return compiled_model;
 }
 }   // namespace intel_cpu
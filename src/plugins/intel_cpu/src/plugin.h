@@ -50,6 +50,7 @@ private:
 
     void get_performance_streams(Config& config, const std::shared_ptr<ov::Model>& model) const;
     void calculate_streams(Config& conf, const std::shared_ptr<ov::Model>& model, bool imported = false) const;
+    std::shared_ptr<SocketsWeights> get_shared_weights(const Config& conf) const;
 
     Config engConfig;
     /* Explicily configured streams have higher priority than performance hints.
@@ -57,6 +58,9 @@ private:
     bool streamsExplicitlySetForEngine = false;
     const std::string deviceFullName;
     ov::AnyMap m_compiled_model_runtime_properties;
+    // weights caches of the models compiled with ov::internal::weights_sharing_id
+    mutable std::mutex m_shared_weights_mutex;
+    mutable std::unordered_map<std::string, std::weak_ptr<SocketsWeights>> m_shared_weights;
 
     std::shared_ptr<void> specialSetup;
 
@@ -0,0 +1,155 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "request_scheduler.h"
+
+#include <algorithm>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+RequestScheduler& RequestScheduler::instance() {
+    static RequestScheduler scheduler;
+    return scheduler;
+}
+
+int& RequestScheduler::current_priority() {
+    // -1 - the thread doesn't run a scheduled task
+    static thread_local int priority = -1;
+    return priority;
+}
+
+void RequestScheduler::run(const std::shared_ptr<ov::threading::ITaskExecutor>& executor,
+                           ov::hint::Priority priority,
+                           Clock::time_point deadline,
+                           ov::threading::Task task) {
+    auto key = executor.get();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& pending = m_pending[key];
+        pending.push_back({static_cast<int>(priority), deadline, m_seq++, std::move(task)});
+        std::push_heap(pending.begin(), pending.end(), LessUrgent{});
+    }
+    // the trampoline doesn't have to execute the task it is run for, any pending task of the executor will do
+    executor->run([this, key] {
+        run_next(key);
+    });
+}
+
+void RequestScheduler::run_next(ov::threading::ITaskExecutor* executor) {
+    Entry entry;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_pending.find(executor);
+        if (it == m_pending.end())
+            return;
+        auto& pending = it->second;
+        std::pop_heap(pending.begin(), pending.end(), LessUrgent{});
+        entry = std::move(pending.back());
+        pending.pop_back();
+        if (pending.empty())
+            m_pending.erase(it);
+        m_running[entry.priority]++;
+    }
+
+    run_counted(entry.priority, entry.task);
+}
+
+void RequestScheduler::execute(ov::hint::Priority priority, const ov::threading::Task& task) {
+    const int level = static_cast<int>(priority);
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // a task executed from a running task, e.g. from a callback, goes on without waiting for the tasks
+        // of the higher priority, since the outer task is counted as running already
+        if (current_priority() < 0) {
+            m_cond.wait(lock, [&] {
+                return !has_higher_running(level);
+            });
+        }
+        m_running[level]++;
+    }
+
+    run_counted(level, task);
+}
+
+void RequestScheduler::run_counted(int priority, const ov::threading::Task& task) {
+    auto& current = current_priority();
+    const auto previous = current;
+    auto finish = [&] {
+        current = previous;
+        if (--m_running[priority] == 0) {
+            // the mutex guarantees the paused thread has either checked the counters or is waiting already
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+            }
+            m_cond.notify_all();
+        }
+    };
+    current = priority;
+    try {
+        task();
+    } catch (...) {
+        finish();
+        throw;
+    }
+    finish();
+}
+
+bool RequestScheduler::has_higher_running(int priority) const {
+    for (int level = priority + 1; level < levels; level++) {
+        if (m_running[level] > 0)
+            return true;
+    }
+    return false;
+}
+
+void RequestScheduler::preemption_point() {
+    const int priority = current_priority();
+    if (priority < 0)
+        return;
+    auto& scheduler = instance();
+    if (!scheduler.has_higher_running(priority))
+        return;
+    std::unique_lock<std::mutex> lock(scheduler.m_mutex);
+    scheduler.m_cond.wait(lock, [&] {
+        return !scheduler.has_higher_running(priority);
+    });
+}
+
+void SchedulingExecutor::run(ov::threading::Task task) {
+    const auto deadline = m_deadline.count() > 0 ? RequestScheduler::Clock::now() + m_deadline
+                                                 : RequestScheduler::Clock::time_point::max();
+    RequestScheduler::instance().run(m_executor, m_priority, deadline, std::move(task));
+}
+
+void SchedulingExecutor::execute(ov::threading::Task task) {
+    auto scheduled = [this, &task] {
+        RequestScheduler::instance().execute(m_priority, task);
+    };
+    if (m_streams_executor) {
+        m_streams_executor->execute(std::move(scheduled));
+    } else {
+        scheduled();
+    }
+}
+
+int SchedulingExecutor::get_stream_id() {
+    OPENVINO_ASSERT(m_streams_executor, "The scheduled executor is not a streams executor");
+    return m_streams_executor->get_stream_id();
+}
+
+int SchedulingExecutor::get_numa_node_id() {
+    OPENVINO_ASSERT(m_streams_executor, "The scheduled executor is not a streams executor");
+    return m_streams_executor->get_numa_node_id();
+}
+
+int SchedulingExecutor::get_socket_id() {
+    OPENVINO_ASSERT(m_streams_executor, "The scheduled executor is not a streams executor");
+    return m_streams_executor->get_socket_id();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,130 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/threading/istreams_executor.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Orders the inference tasks of the compiled models of the process by the priority and the deadline.
+ * The streams executors stay FIFO: for every task a trampoline is run on the executor, and the trampoline executes
+ * the most urgent pending task of that executor (higher priority first, then earliest deadline first), so a free
+ * stream never waits while there is a pending task.
+ * The compiled models with the different executors don't share the streams, so a running task pauses the lower
+ * priority inferences at the preemption points between the graph nodes until the higher priority tasks complete.
+ */
+class RequestScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static RequestScheduler& instance();
+
+    /**
+     * @brief Adds the task to the pending tasks of the executor and runs a trampoline on the executor
+     * @param deadline the task with the earlier deadline goes first among the tasks of the same priority
+     */
+    void run(const std::shared_ptr<ov::threading::ITaskExecutor>& executor,
+             ov::hint::Priority priority,
+             Clock::time_point deadline,
+             ov::threading::Task task);
+
+    /**
+     * @brief Executes the task in the current thread, e.g. a synchronous inference, which isn't queued:
+     * the task starts when no task of a higher priority is running and is paused at the preemption points
+     * like the scheduled tasks.
+     */
+    void execute(ov::hint::Priority priority, const ov::threading::Task& task);
+
+    /**
+     * @brief Waits while the tasks of a higher priority than the task running in the current thread are running.
+     * Does nothing if the current thread doesn't run a scheduled task.
+     */
+    static void preemption_point();
+
+private:
+    struct Entry {
+        int priority;
+        Clock::time_point deadline;
+        uint64_t seq;
+        ov::threading::Task task;
+    };
+
+    struct LessUrgent {
+        bool operator()(const Entry& lhs, const Entry& rhs) const {
+            if (lhs.priority != rhs.priority)
+                return lhs.priority < rhs.priority;
+            if (lhs.deadline != rhs.deadline)
+                return lhs.deadline > rhs.deadline;
+            return lhs.seq > rhs.seq;
+        }
+    };
+
+    static constexpr int levels = static_cast<int>(ov::hint::Priority::HIGH) + 1;
+
+    void run_next(ov::threading::ITaskExecutor* executor);
+    // runs the task counted as running with the priority
+    void run_counted(int priority, const ov::threading::Task& task);
+    bool has_higher_running(int priority) const;
+    static int& current_priority();
+
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    // pending tasks of every executor kept as a heap, the most urgent task is on the top
+    std::unordered_map<ov::threading::ITaskExecutor*, std::vector<Entry>> m_pending;
+    uint64_t m_seq = 0;
+    std::array<std::atomic<int>, levels> m_running{};
+};
+
+/**
+ * @brief Task executor of the infer requests of a compiled model with the request priority or deadline,
+ * see ov::intel_cpu::request_priority and ov::intel_cpu::request_deadline.
+ * The deadline of a request is set when the request is started.
+ * It is a streams executor, so the synchronous inference is executed in the caller thread with the configuration of
+ * the wrapped streams executor, as it is done without the scheduling.
+ */
+class SchedulingExecutor : public ov::threading::IStreamsExecutor {
+public:
+    SchedulingExecutor(std::shared_ptr<ov::threading::ITaskExecutor> executor,
+                       ov::hint::Priority priority,
+                       std::chrono::milliseconds deadline)
+        : m_executor(std::move(executor)),
+          m_streams_executor(std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(m_executor)),
+          m_priority(priority),
+          m_deadline(deadline) {}
+
+    void run(ov::threading::Task task) override;
+
+    void execute(ov::threading::Task task) override;
+
+    int get_stream_id() override;
+
+    int get_numa_node_id() override;
+
+    int get_socket_id() override;
+
+private:
+    std::shared_ptr<ov::threading::ITaskExecutor> m_executor;
+    // nullptr if the wrapped executor isn't a streams executor
+    std::shared_ptr<ov::threading::IStreamsExecutor> m_streams_executor;
+    ov::hint::Priority m_priority;
+    // 0 - no deadline
+    std::chrono::milliseconds m_deadline;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -6,6 +6,7 @@
 #include <pugixml.hpp>
 
 #include "openvino/pass/serialize.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "transformations/utils/utils.hpp"
 
 namespace ov {
@@ -44,8 +45,11 @@ void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
     serializer.run_on_model(std::const_pointer_cast<ov::Model>(model->clone()));
 }
 
-ModelDeserializer::ModelDeserializer(std::istream & istream, model_builder fn)
+ModelDeserializer::ModelDeserializer(std::istream & istream,
+                                     std::shared_ptr<ov::AlignedBuffer> model_buffer,
+                                     model_builder fn)
     : _istream(istream)
+    , _model_buffer(std::move(model_buffer))
     , _model_builder(fn) {
 }
 
@@ -88,8 +92,17 @@ void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
     }
 
     // read blob content
-    _istream.seekg(hdr.consts_offset);
-    if (hdr.consts_size) {
+    if (hdr.consts_size && _model_buffer) {
+        // the weights are used in place, the tensor keeps the buffer alive while the constants refer to it
+        if (hdr.consts_offset + hdr.consts_size > _model_buffer->size()) {
+            OPENVINO_THROW("NetworkNotRead: The weights are out of the cached model buffer.");
+        }
+        auto weights = ov::make_tensor(ov::element::u8,
+                                       ov::Shape({hdr.consts_size}),
+                                       _model_buffer->get_ptr<char>() + hdr.consts_offset);
+        dataBlob = ov::make_tensor(ov::SoPtr<ov::ITensor>{weights, _model_buffer});
+    } else if (hdr.consts_size) {
+        _istream.seekg(hdr.consts_offset);
         dataBlob = ov::Tensor(ov::element::u8, ov::Shape({hdr.consts_size}));
         _istream.read(static_cast<char *>(dataBlob.data(ov::element::u8)), hdr.consts_size);
     }
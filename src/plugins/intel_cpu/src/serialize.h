@@ -6,6 +6,7 @@
 #include <iostream>
 
 #include "openvino/core/model.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -22,11 +23,13 @@ private:
 class ModelDeserializer {
 public:
     typedef std::function<std::shared_ptr<ov::Model>(const std::string&, const ov::Tensor&)> model_builder;
-    ModelDeserializer(std::istream& istream, model_builder fn);
+    // model_buffer (optional) holds the whole stream content, the weights are referenced in it without copying
+    ModelDeserializer(std::istream& istream, std::shared_ptr<ov::AlignedBuffer> model_buffer, model_builder fn);
     void operator>>(std::shared_ptr<ov::Model>& model);
 
 private:
     std::istream& _istream;
+    std::shared_ptr<ov::AlignedBuffer> _model_buffer;
     model_builder _model_builder;
 };
 
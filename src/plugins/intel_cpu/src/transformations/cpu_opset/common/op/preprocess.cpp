@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "preprocess.hpp"
+
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::PreprocessNode::PreprocessNode(const OutputVector& args, const Config& cfg) : Op(args), m_config(cfg) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::PreprocessNode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(PreprocessNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::PreprocessNode>(new_args, m_config);
+}
+
+void ov::intel_cpu::PreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(PreprocessNode_validate_and_infer_types);
+    const bool is_yuv = m_config.is_nv12 || m_config.is_i420;
+    const size_t max_inputs = m_config.is_nv12 ? 2 : m_config.is_i420 ? 3 : 1;
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() == 1 || get_input_size() == max_inputs,
+                          "Unexpected number of inputs: ",
+                          get_input_size());
+    NODE_VALIDATION_CHECK(this, m_config.scale.size() == 3 && m_config.shift.size() == 3,
+                          "Scale and shift must be defined for 3 channels");
+    for (size_t i = 0; i < get_input_size(); i++) {
+        NODE_VALIDATION_CHECK(this, get_input_element_type(i) == ov::element::u8, "Only u8 frames are supported");
+    }
+
+    const auto& src_shape = get_input_partial_shape(0);
+    if (src_shape.rank().is_dynamic()) {
+        set_output_type(0, ov::element::f32, ov::PartialShape::dynamic(4));
+        return;
+    }
+    NODE_VALIDATION_CHECK(this, src_shape.size() == 4, "Frame must have 4 dimensions (N, H, W, C)");
+
+    ov::Dimension height = src_shape[1];
+    ov::Dimension width = src_shape[2];
+    if (is_yuv && get_input_size() == 1) {
+        height *= 2;
+        height /= 3;
+    }
+    if (m_config.resize) {
+        height = m_config.resize_height;
+        width = m_config.resize_width;
+    }
+
+    const ov::Dimension channels(3);
+    const auto output_shape = m_config.output_nchw ? ov::PartialShape{src_shape[0], channels, height, width}
+                                                   : ov::PartialShape{src_shape[0], height, width, channels};
+    set_output_type(0, ov::element::f32, output_shape);
+}
+
+bool ov::intel_cpu::PreprocessNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(PreprocessNode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("is_nv12", m_config.is_nv12);
+    visitor.on_attribute("is_i420", m_config.is_i420);
+    visitor.on_attribute("is_bgr", m_config.is_bgr);
+    visitor.on_attribute("round_color", m_config.round_color);
+    visitor.on_attribute("resize", m_config.resize);
+    visitor.on_attribute("resize_mode", m_config.resize_mode);
+    visitor.on_attribute("resize_height", m_config.resize_height);
+    visitor.on_attribute("resize_width", m_config.resize_width);
+    visitor.on_attribute("scale", m_config.scale);
+    visitor.on_attribute("shift", m_config.shift);
+    visitor.on_attribute("output_nchw", m_config.output_nchw);
+    visitor.finish_structure();
+    return true;
+}
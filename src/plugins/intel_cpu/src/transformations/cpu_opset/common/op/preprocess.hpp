@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+#include "openvino/op/util/interpolate_base.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * The operation performs the image preprocessing chain produced by ov::preprocess::PrePostProcessor
+ * in one pass over the source frame:
+ *
+ *   u8 frame -> [color conversion] -> f32 -> [resize] -> [transpose] -> x * scale[c] + shift[c]
+ *
+ *  where each step is optional:
+ *      - color conversion: NV12 or I420 frame is converted to RGB or BGR, the result is rounded
+ *          when the conversion is done on u8 data (round_color == true)
+ *      - resize: linear (without antialiasing) or nearest interpolation over H and W
+ *      - transpose: NHWC frame is transposed to NCHW layout (output_nchw == true)
+ *      - per-channel scale and shift: the folded sequence of mean/scale steps
+ *
+ *  Resize and transpose are linear and commute with the per-channel affine transformation,
+ *  so the original order of these steps in the graph doesn't matter.
+ *
+ * Inputs:
+ *     1. u8 interleaved frame [N, H, W, 3] OR
+ *        u8 single plane NV12/I420 frame [N, H * 3 / 2, W, 1] OR
+ *        u8 Y plane [N, H, W, 1] of two plane NV12 or three plane I420 frame
+ *     2. u8 UV plane [N, H / 2, W / 2, 2] of two plane NV12 frame OR
+ *        u8 U plane [N, H / 2, W / 2, 1] of three plane I420 frame, optional
+ *     3. u8 V plane [N, H / 2, W / 2, 1] of three plane I420 frame, optional
+ * Outputs:
+ *     1. f32 tensor of shape [N, H', W', 3] or [N, 3, H', W'] when output_nchw is true
+ */
+class PreprocessNode : public ov::op::Op {
+public:
+    OPENVINO_OP("Preprocess", "cpu_plugin_opset");
+
+    PreprocessNode() = default;
+
+    using InterpolateBase = ov::op::util::InterpolateBase;
+
+    struct Config {
+        bool is_nv12 = false;      // the source is NV12 frame
+        bool is_i420 = false;      // the source is I420 frame
+        bool is_bgr = false;       // NV12/I420 frame is converted to BGR instead of RGB
+        bool round_color = false;  // color conversion result is rounded to integer values
+        bool resize = false;
+        // LINEAR or NEAREST resize with half_pixel coordinates and round_prefer_floor rounding,
+        // which are the attributes of PrePostProcessor resize
+        InterpolateBase::InterpolateMode resize_mode = InterpolateBase::InterpolateMode::LINEAR;
+        int64_t resize_height = 0;
+        int64_t resize_width = 0;
+        std::vector<float> scale = {1.f, 1.f, 1.f};  // per-channel scale, applied before shift
+        std::vector<float> shift = {0.f, 0.f, 0.f};  // per-channel shift
+        bool output_nchw = false;
+    };
+
+    PreprocessNode(const OutputVector& args, const Config& cfg);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    Config m_config;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,297 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "preprocess_fusion.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/i420_to_bgr.hpp"
+#include "openvino/op/i420_to_rgb.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/cpu_opset/common/op/preprocess.hpp"
+#include "transformations/rt_info/dequantization_node.hpp"
+
+#include "itt.hpp"
+
+namespace {
+
+using InterpolateBase = ov::op::util::InterpolateBase;
+
+// channels axis of NHWC source frame
+constexpr int64_t channel_axis = 3;
+
+// State of the chain being fused. The layout of the current tensor is tracked
+// as the order of the source frame (NHWC) dimensions.
+struct ChainState {
+    ov::intel_cpu::PreprocessNode::Config config;
+    std::vector<int64_t> order = {0, 1, 2, 3};
+    bool is_float = false;
+
+    bool is_complete() const {
+        static const std::vector<int64_t> nhwc = {0, 1, 2, 3};
+        static const std::vector<int64_t> nchw = {0, 3, 1, 2};
+        return is_float && (order == nhwc || order == nchw);
+    }
+};
+
+bool is_u8_to_f32_convert(const std::shared_ptr<ov::Node>& node) {
+    return ov::is_type<ov::op::v0::Convert>(node) &&
+           node->get_input_element_type(0) == ov::element::u8 &&
+           node->get_output_element_type(0) == ov::element::f32 &&
+           !ov::is_dequantization_node(node);
+}
+
+// PrePostProcessor steps are applied to the model inputs, the same chains on the constants (e.g. u8 weights
+// converted and scaled) are not frames
+bool is_parameter(const ov::Output<ov::Node>& output) {
+    return ov::is_type<ov::op::v0::Parameter>(output.get_node_shared_ptr());
+}
+
+bool fuse_transpose(const std::shared_ptr<ov::op::v1::Transpose>& transpose, ChainState& state) {
+    const auto order_const = ov::as_type_ptr<ov::op::v0::Constant>(transpose->get_input_node_shared_ptr(1));
+    if (!order_const)
+        return false;
+    const auto perm = order_const->cast_vector<int64_t>();
+    if (perm.size() != state.order.size())
+        return false;
+
+    std::vector<int64_t> order(perm.size());
+    for (size_t i = 0; i < perm.size(); i++) {
+        if (perm[i] < 0 || perm[i] >= static_cast<int64_t>(perm.size()))
+            return false;
+        order[i] = state.order[perm[i]];
+    }
+    state.order = std::move(order);
+    return true;
+}
+
+bool fuse_interpolate(const std::shared_ptr<ov::op::v11::Interpolate>& interpolate, ChainState& state) {
+    if (!state.is_float || state.config.resize)
+        return false;
+
+    // Only the resize emitted by PrePostProcessor is fused: linear without antialiasing or nearest,
+    // with the default coordinate transformation and nearest modes
+    const auto& attrs = interpolate->get_attrs();
+    if ((attrs.mode != InterpolateBase::InterpolateMode::LINEAR &&
+         attrs.mode != InterpolateBase::InterpolateMode::NEAREST) ||
+        attrs.antialias || attrs.coordinate_transformation_mode != InterpolateBase::CoordinateTransformMode::HALF_PIXEL ||
+        attrs.nearest_mode != InterpolateBase::NearestMode::ROUND_PREFER_FLOOR)
+        return false;
+    auto is_zero = [](size_t pad) {
+        return pad == 0;
+    };
+    if (attrs.shape_calculation_mode != InterpolateBase::ShapeCalcMode::SIZES ||
+        !std::all_of(attrs.pads_begin.begin(), attrs.pads_begin.end(), is_zero) ||
+        !std::all_of(attrs.pads_end.begin(), attrs.pads_end.end(), is_zero))
+        return false;
+
+    const auto sizes_const = ov::as_type_ptr<ov::op::v0::Constant>(interpolate->get_input_node_shared_ptr(1));
+    if (!sizes_const)
+        return false;
+    const auto sizes = sizes_const->cast_vector<int64_t>();
+
+    const auto rank = static_cast<int64_t>(state.order.size());
+    std::vector<int64_t> axes(rank);
+    std::iota(axes.begin(), axes.end(), 0);
+    if (interpolate->get_input_size() > 2) {
+        const auto axes_const = ov::as_type_ptr<ov::op::v0::Constant>(interpolate->get_input_node_shared_ptr(2));
+        if (!axes_const)
+            return false;
+        axes = axes_const->cast_vector<int64_t>();
+    }
+    if (axes.size() != sizes.size())
+        return false;
+
+    const auto& input_shape = interpolate->get_input_partial_shape(0);
+    int64_t height = 0, width = 0;
+    for (size_t i = 0; i < axes.size(); i++) {
+        const auto axis = axes[i] < 0 ? axes[i] + rank : axes[i];
+        if (axis < 0 || axis >= rank)
+            return false;
+        switch (state.order[axis]) {
+        case 1:
+            height = sizes[i];
+            break;
+        case 2:
+            width = sizes[i];
+            break;
+        default:
+            // batch and channels can only be listed with their own size
+            if (input_shape[axis].is_dynamic() || input_shape[axis].get_length() != sizes[i])
+                return false;
+        }
+    }
+    if (height <= 0 || width <= 0)
+        return false;
+
+    state.config.resize = true;
+    state.config.resize_mode = attrs.mode;
+    state.config.resize_height = height;
+    state.config.resize_width = width;
+    return true;
+}
+
+// Folds per-channel mean and scale into the affine transformation of the chain
+bool fuse_eltwise(const std::shared_ptr<ov::Node>& eltwise, size_t data_port, ChainState& state) {
+    const bool is_subtract = ov::is_type<ov::op::v1::Subtract>(eltwise);
+    const bool is_divide = ov::is_type<ov::op::v1::Divide>(eltwise);
+    if (!state.is_float || eltwise->get_output_element_type(0) != ov::element::f32 ||
+        (data_port != 0 && (is_subtract || is_divide)))
+        return false;
+
+    const auto autob = eltwise->get_autob().m_type;
+    if (autob != ov::op::AutoBroadcastType::NUMPY && autob != ov::op::AutoBroadcastType::NONE)
+        return false;
+
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(eltwise->get_input_node_shared_ptr(1 - data_port));
+    if (!constant)
+        return false;
+    // only scalar and per-channel values are supported
+    const auto& const_shape = constant->get_shape();
+    if (const_shape.size() > state.order.size())
+        return false;
+    const size_t offset = state.order.size() - const_shape.size();
+    for (size_t i = 0; i < const_shape.size(); i++) {
+        if (const_shape[i] != 1 && (state.order[i + offset] != channel_axis || const_shape[i] != 3))
+            return false;
+    }
+
+    const auto values = constant->cast_vector<float>();
+    auto& scale = state.config.scale;
+    auto& shift = state.config.shift;
+    for (size_t c = 0; c < 3; c++) {
+        const float value = values.size() == 1 ? values[0] : values[c];
+        if (is_subtract) {
+            shift[c] -= value;
+        } else if (is_divide) {
+            scale[c] /= value;
+            shift[c] /= value;
+        } else if (ov::is_type<ov::op::v1::Multiply>(eltwise)) {
+            scale[c] *= value;
+            shift[c] *= value;
+        } else {
+            shift[c] += value;
+        }
+    }
+    return true;
+}
+
+}   // namespace
+
+ov::intel_cpu::PreprocessFusion::PreprocessFusion() {
+    MATCHER_SCOPE(PreprocessFusion);
+    auto head_m = ov::pass::pattern::wrap_type<ov::op::v8::NV12toRGB,
+                                               ov::op::v8::NV12toBGR,
+                                               ov::op::v8::I420toRGB,
+                                               ov::op::v8::I420toBGR,
+                                               ov::op::v0::Convert>();
+
+    ov::matcher_pass_callback callback = [](ov::pass::pattern::Matcher& m) {
+        const auto head = m.get_match_root();
+        ChainState state;
+        ov::OutputVector inputs;
+        ov::NodeVector fused_nodes;
+
+        if (ov::is_type<ov::op::v0::Convert>(head)) {
+            // Interleaved frame. Converts of NV12/I420 planes are fused together with the color conversion.
+            const auto frame = head->input_value(0);
+            const auto& frame_shape = frame.get_partial_shape();
+            if (!is_u8_to_f32_convert(head) || !is_parameter(frame) || frame_shape.rank().is_dynamic() ||
+                frame_shape.size() != 4 || frame_shape[channel_axis].is_dynamic() ||
+                frame_shape[channel_axis].get_length() != 3)
+                return false;
+            inputs.push_back(frame);
+            state.is_float = true;
+        } else {
+            state.config.is_nv12 = ov::is_type<ov::op::v8::NV12toRGB>(head) || ov::is_type<ov::op::v8::NV12toBGR>(head);
+            state.config.is_i420 = !state.config.is_nv12;
+            state.config.is_bgr = ov::is_type<ov::op::v8::NV12toBGR>(head) || ov::is_type<ov::op::v8::I420toBGR>(head);
+            for (const auto& plane : head->input_values()) {
+                const auto plane_node = plane.get_node_shared_ptr();
+                if (plane.get_element_type() == ov::element::u8) {
+                    inputs.push_back(plane);
+                } else if (is_u8_to_f32_convert(plane_node) && plane.get_target_inputs().size() == 1) {
+                    inputs.push_back(plane_node->input_value(0));
+                    fused_nodes.push_back(plane_node);
+                    state.is_float = true;
+                } else {
+                    return false;
+                }
+                if (!is_parameter(inputs.back()))
+                    return false;
+            }
+            // either all planes are converted to f32 before the color conversion or none of them
+            if (state.is_float && fused_nodes.size() != inputs.size())
+                return false;
+            state.config.round_color = !state.is_float;
+        }
+        fused_nodes.push_back(head);
+
+        // Extend the chain while its steps can be fused, the longest complete prefix is replaced
+        ChainState tail_state = state;
+        size_t tail_size = state.is_complete() ? fused_nodes.size() : 0;
+        auto last = head;
+        while (last->get_output_size() == 1) {
+            const auto consumers = last->get_output_target_inputs(0);
+            if (consumers.size() != 1)
+                break;
+            const auto& consumer = *consumers.begin();
+            const auto next = consumer.get_node()->shared_from_this();
+            const auto port = consumer.get_index();
+
+            bool fused = false;
+            if (ov::is_type<ov::op::v0::Convert>(next)) {
+                fused = !state.is_float && is_u8_to_f32_convert(next);
+                state.is_float = state.is_float || fused;
+            } else if (const auto transpose = ov::as_type_ptr<ov::op::v1::Transpose>(next)) {
+                fused = port == 0 && fuse_transpose(transpose, state);
+            } else if (const auto interpolate = ov::as_type_ptr<ov::op::v11::Interpolate>(next)) {
+                fused = port == 0 && fuse_interpolate(interpolate, state);
+            } else if (ov::is_type<ov::op::v1::Subtract>(next) || ov::is_type<ov::op::v1::Divide>(next) ||
+                       ov::is_type<ov::op::v1::Multiply>(next) || ov::is_type<ov::op::v1::Add>(next)) {
+                fused = fuse_eltwise(next, port, state);
+            }
+            if (!fused)
+                break;
+
+            fused_nodes.push_back(next);
+            last = next;
+            if (state.is_complete()) {
+                tail_state = state;
+                tail_size = fused_nodes.size();
+            }
+        }
+        // a single Convert of interleaved frame doesn't need fusing
+        if (tail_size == 0 || (tail_size == 1 && ov::is_type<ov::op::v0::Convert>(head)))
+            return false;
+        fused_nodes.resize(tail_size);
+
+        const auto tail = fused_nodes.back();
+        tail_state.config.output_nchw = tail_state.order[1] == channel_axis;
+        const auto preprocess = std::make_shared<ov::intel_cpu::PreprocessNode>(inputs, tail_state.config);
+        if (!preprocess->get_output_partial_shape(0).compatible(tail->get_output_partial_shape(0)))
+            return false;
+
+        preprocess->set_friendly_name(tail->get_friendly_name());
+        ov::copy_runtime_info(fused_nodes, preprocess);
+        ov::replace_node(tail, preprocess);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(head_m, matcher_name);
+    this->register_matcher(m, callback);
+}
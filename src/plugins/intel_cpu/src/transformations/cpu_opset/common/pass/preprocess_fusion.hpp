@@ -0,0 +1,25 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Fuses the chain of image preprocessing operations inserted by ov::preprocess::PrePostProcessor
+ * (NV12/I420 color conversion, Convert to f32, Interpolate, Transpose, mean and scale) into PreprocessNode.
+ * The chain starts from u8 NV12/I420 frame or u8 NHWC frame with 3 channels and is fused only if its result
+ * is f32 tensor in NHWC or NCHW layout.
+ */
+class PreprocessFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("PreprocessFusion", "0");
+    PreprocessFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
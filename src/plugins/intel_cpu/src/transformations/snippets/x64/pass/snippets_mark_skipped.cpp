@@ -4,6 +4,7 @@
 #include "snippets_mark_skipped.hpp"
 
 #include "snippets/pass/tokenization.hpp"
+#include "snippets/pass/collapse_subgraph.hpp"
 #include "snippets/op/subgraph.hpp"
 #include "snippets/utils.hpp"
 
@@ -159,7 +160,22 @@ int getChannelAxis(const ov::AxisSet &axes, bool keep_dims) {
     }
     return channelAxis;
 }
+// Reductions and MVN by the innermost dimension (RMSNorm, LayerNorm) are tokenized by Snippets together with their
+// element-wise consumers, so they must not start the plugin fusing chains. Dynamic ones and the ones without such
+// consumers are left to the plugin nodes.
+bool isTokenizedNormalization(const std::shared_ptr<const Node> &node) {
+    if (!(ov::is_type<ov::op::util::ArithmeticReductionKeepDims>(node) || ov::is_type<ov::op::v6::MVN>(node)) ||
+        node->get_input_partial_shape(0).is_dynamic() || node->get_output_size() != 1 ||
+        !snippets::pass::TokenizeSnippets::AppropriateForSubgraph(node))
+        return false;
+    const auto consumers = node->get_output_target_inputs(0);
+    return std::any_of(consumers.begin(), consumers.end(), [](const ov::Input<Node>& consumer) {
+        return snippets::pass::TokenizeSnippets::AppropriateForSubgraph(consumer.get_node()->shared_from_this());
+    });
+}
 bool isSuitableMiscParent(const std::shared_ptr<const Node> &node) {
+    if (isTokenizedNormalization(node))
+        return false;
     const bool is_suitable_node = ov::is_type<ov::op::v0::MVN>(node) ||
                                   ov::is_type<ov::op::v6::MVN>(node) ||
                                   ov::is_type<ov::op::v0::NormalizeL2>(node) ||
@@ -403,7 +419,7 @@ bool isSuitableMatMulWithConstantPath(const std::shared_ptr<Node>& node) {
            ov::op::util::is_on_constant_path(node->input_value(1));
 }
 bool isSuitableGatherWithConstantPath(const std::shared_ptr<Node>& node) {
-    return is_gather_with_compressed_weights(node);
+    return is_gather_with_compressed_weights(node) || is_embedding_bag_with_compressed_weights(node);
 }
 // Continue fusing chain of the passed type if the node has one child
 // Otherwise mark node as FusedTerminator (Fused, but fusing chain is interrupted)
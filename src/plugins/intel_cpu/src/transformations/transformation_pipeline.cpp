@@ -114,10 +114,12 @@
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
 #include "transformations/cpu_opset/common/pass/move_eltwise_up_data_movement.hpp"
 #include "transformations/cpu_opset/common/pass/swap_convert_transpose.hpp"
+#include "transformations/cpu_opset/common/pass/preprocess_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/rope_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/stateful_sdpa_fusion.hpp"
 
 // Snippets
+#include "snippets/op/subgraph.hpp"
 #include "snippets/pass/tokenization.hpp"
 #include "snippets/pass/mha_tokenization.hpp"
 #include "snippets/pass/collapse_subgraph.hpp"
@@ -152,7 +154,7 @@ bool Transformations::is_decompression_multiply(const_node_ptr& node) const {
     if (!consumer)
         return false;
 
-    if (ov::is_type<ov::opset1::MatMul>(consumer)) {
+    if (ov::is_type<ov::opset1::MatMul>(consumer) || is_embedding_bag_with_compressed_weights(consumer)) {
         return true;
     } else if (ov::is_type<ov::opset1::Reshape>(consumer)) {
         consumer = get_single_consumer(consumer);
@@ -169,6 +171,9 @@ bool Transformations::is_decompression_multiply(const_node_ptr& node) const {
             if (is_gather_with_compressed_weights(consumer)) {
                 return true;
             }
+            if (is_embedding_bag_with_compressed_weights(consumer)) {
+                return true;
+            }
         }
     }
     return false;
@@ -352,6 +357,8 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
         },
         ov::pass::KeepConstAndDecompression);
 
+    // Must be run before CommonOptimizations, which decompose and reorder the preprocessing steps
+    CPU_REGISTER_PASS_COMMON(manager, PreprocessFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::AUGRUCellFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::CommonOptimizations);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::RPE_Fusion);
@@ -809,7 +816,10 @@ void Transformations::MainSnippets(void) {
         }, snippets::pass::ExtractReshapesFromMHA);
         CPU_SET_CALLBACK_X64(snippetsManager,
             [](const std::shared_ptr<const ov::Node>& n) -> bool {
-                if (n->is_dynamic())
+                // Dynamic Subgraphs are tokenized only if they are compiled once per broadcasting pattern (shape-agnostic kernels),
+                // otherwise they would be recompiled for every new shape. The tokenizer limits the number of data pointers of
+                // dynamic Subgraphs and the Subgraph node enforces planar layouts for them, so only the ops are checked here
+                if (n->is_dynamic() && !snippets::op::Subgraph::is_shape_agnostic_supported_op(n))
                     return true;
                 // CPU Plugin support Swish in Subgraph via conversion to SwichCPU which assumes second input to be constant
                 const bool is_unsupported_swish =
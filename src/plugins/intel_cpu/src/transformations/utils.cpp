@@ -4,9 +4,13 @@
 
 #include "utils.hpp"
 #include "openvino/opsets/opset1.hpp"
+#include "openvino/opsets/opset3.hpp"
 #include "cpu_opset/common/op/fully_connected.hpp"
 #include "transformations/rt_info/dequantization_node.hpp"
 #include "transformations/utils/utils.hpp"
+#include "utils/general_utils.h"
+
+#include <algorithm>
 
 namespace ov {
 namespace intel_cpu {
@@ -124,5 +128,68 @@ bool is_gather_with_compressed_weights(const std::shared_ptr<const ov::Node>& no
     return true;
 }
 
+// Check specific pattern:
+// Constant(u8/i8)
+//     |
+// Convert  Constant
+//     \    /
+//   Subtract (optional)   Constant
+//       \                /
+//             Multiply
+//                |
+//          Convert (optional)
+//                |
+//    EmbeddingBagOffsetsSum / EmbeddingBagPackedSum / EmbeddingSegmentsSum
+bool is_embedding_bag_with_compressed_weights(const std::shared_ptr<const ov::Node>& node) {
+    if (!ov::is_type<ov::opset3::EmbeddingBagOffsetsSum>(node) && !ov::is_type<ov::opset3::EmbeddingBagPackedSum>(node) &&
+        !ov::is_type<ov::opset3::EmbeddingSegmentsSum>(node)) {
+        return false;
+    }
+
+    // one decompression value per row of the table
+    auto is_row_wise_constant = [](const ov::Node* node, size_t rank) {
+        const ov::Node* const_node = ov::is_type<ov::opset1::Convert>(node) ? node->get_input_node_ptr(0) : node;
+
+        if (ov::is_type<ov::op::v0::Constant>(const_node) && const_node->get_input_size() == 0) {
+            auto cur_shape = const_node->get_output_shape(0);
+            return cur_shape.size() == rank && std::all_of(cur_shape.begin() + 1, cur_shape.end(), [](size_t dim) {
+                       return dim == 1u;
+                   });
+        }
+        return false;
+    };
+
+    auto multiply = node->get_input_node_ptr(0);
+    if (ov::is_type<ov::op::v0::Convert>(multiply)) {
+        multiply = multiply->get_input_node_ptr(0);
+    }
+    if (!ov::is_type<ov::op::v1::Multiply>(multiply)) {
+        return false;
+    }
+
+    ov::Node* subtract = nullptr;
+    auto weights_convert = multiply->get_input_node_ptr(0);
+    if (ov::is_type<ov::op::v1::Subtract>(weights_convert)) {
+        subtract = weights_convert;
+        weights_convert = subtract->get_input_node_ptr(0);
+    }
+    if (!ov::is_type<ov::op::v0::Convert>(weights_convert)) {
+        return false;
+    }
+
+    auto weights_ptr = ov::as_type<ov::op::v0::Constant>(weights_convert->get_input_node_ptr(0));
+    if (!weights_ptr || !one_of(weights_ptr->get_element_type(), ov::element::u8, ov::element::i8)) {
+        return false;
+    }
+    const auto weights_rank = weights_ptr->get_output_shape(0).size();
+    if (weights_rank < 2u) {
+        return false;
+    }
+    if (subtract && !is_row_wise_constant(subtract->get_input_node_ptr(1), weights_rank)) {
+        return false;
+    }
+    return is_row_wise_constant(multiply->get_input_node_ptr(1), weights_rank);
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
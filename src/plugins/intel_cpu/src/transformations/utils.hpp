@@ -13,5 +13,7 @@ bool has_matmul_with_compressed_weights(const std::shared_ptr<const ov::Model>&
 
 bool is_gather_with_compressed_weights(const std::shared_ptr<const ov::Node>& node);
 
+bool is_embedding_bag_with_compressed_weights(const std::shared_ptr<const ov::Node>& node);
+
 }   // namespace intel_cpu
 }   // namespace ov
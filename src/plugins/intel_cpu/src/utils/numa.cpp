@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "openvino/runtime/system_conf.hpp"
+
+#if defined(__linux__)
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_move_pages)
+namespace {
+// linux/mempolicy.h, not every toolchain ships the libnuma headers
+constexpr int mpolPreferred = 1;
+constexpr unsigned mpolMfMove = 1u << 1;
+// the pages queried at once and per buffer by countNumaResidentBytes
+constexpr size_t maxSampledPages = 4096;
+
+size_t pageSize() {
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+}  // namespace
+#endif
+
+int getOrgNumaNodeId(int numaNodeId) {
+    if (get_num_numa_nodes() < 2) {
+        return -1;
+    }
+    return get_org_numa_id(numaNodeId);
+}
+
+bool placeOnNumaNode(void* ptr, size_t size, int orgNumaNodeId) {
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_move_pages)
+    if (!ptr || orgNumaNodeId < 0) {
+        return false;
+    }
+    const auto page = pageSize();
+    const auto begin = (reinterpret_cast<uintptr_t>(ptr) + page - 1) / page * page;
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + size) / page * page;
+    if (end <= begin) {
+        return false;
+    }
+
+    constexpr size_t bits = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> nodeMask(orgNumaNodeId / bits + 1, 0);
+    nodeMask[orgNumaNodeId / bits] = 1ul << (orgNumaNodeId % bits);
+    // the preferred policy falls back to the other nodes instead of failing the allocation when the node is full
+    return syscall(SYS_mbind,
+                   reinterpret_cast<void*>(begin),
+                   end - begin,
+                   mpolPreferred,
+                   nodeMask.data(),
+                   nodeMask.size() * bits + 1,
+                   mpolMfMove) == 0;
+#else
+    return false;
+#endif
+}
+
+void countNumaResidentBytes(const void* ptr, size_t size, std::map<int, size_t>& bytesPerNode) {
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_move_pages)
+    if (!ptr || !size) {
+        return;
+    }
+    const auto page = pageSize();
+    const auto begin = reinterpret_cast<uintptr_t>(ptr) / page * page;
+    const auto pages = (reinterpret_cast<uintptr_t>(ptr) + size - begin + page - 1) / page;
+    const auto samples = std::min(pages, maxSampledPages);
+
+    std::vector<void*> sampledPages(samples);
+    for (size_t i = 0; i < samples; i++) {
+        sampledPages[i] = reinterpret_cast<void*>(begin + i * pages / samples * page);
+    }
+    std::vector<int> status(samples, -1);
+    // the null nodes only query the nodes the pages reside on
+    if (syscall(SYS_move_pages, 0, samples, sampledPages.data(), nullptr, status.data(), 0) != 0) {
+        return;
+    }
+    const auto bytesPerSample = size / samples;
+    for (const auto node : status) {
+        if (node >= 0) {
+            bytesPerNode[node] += bytesPerSample;
+        }
+    }
+#endif
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
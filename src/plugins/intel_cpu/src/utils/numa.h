@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Returns the original (OS) id of the numa node of a logical numa node used by the streams executor,
+ * -1 if there is only one numa node and there is nothing to place.
+ */
+int getOrgNumaNodeId(int numaNodeId);
+
+/**
+ * @brief Places the memory pages of the buffer on the numa node: the pages which are already touched are moved,
+ * and the ones touched later are allocated on the node while it has the free memory.
+ * Only the pages entirely within the buffer are placed, so the small buffers are left to the first touch policy.
+ * @param orgNumaNodeId the original (OS) numa node id, -1 does nothing
+ * @return true if the pages are placed
+ */
+bool placeOnNumaNode(void* ptr, size_t size, int orgNumaNodeId);
+
+/**
+ * @brief Adds the bytes of the buffer resident on every numa node (the original ids) to bytesPerNode.
+ * The pages are sampled for the big buffers, the pages which are not touched yet are not counted.
+ */
+void countNumaResidentBytes(const void* ptr, size_t size, std::map<int, size_t>& bytesPerNode);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -4,6 +4,7 @@
 
 #include "weights_cache.hpp"
 #include "openvino/runtime/system_conf.hpp"
+#include "utils/numa.h"
 
 #include <memory>
 
@@ -39,6 +40,7 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
                             bool valid) {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
+    bool created = false;
     {
         std::unique_lock<std::mutex> lock(guard);
         auto found = sharedWeights.find(key);
@@ -48,8 +50,15 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
             newPtr = create();
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
+            created = true;
+        } else {
+            hitsNumber++;
         }
     }
+    // The created memory is usually filled already (e.g. by the reorder of the weights), so its pages are moved
+    // to the node. The migration keeps the content, so it's done out of the lock not to block the other lookups.
+    if (created && newPtr && newPtr->isAllocated() && newPtr->getPrecision() != element::string)
+        placeOnNumaNode(newPtr->getData(), newPtr->getSize(), orgNumaNodeId);
     return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
                                                 ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
@@ -71,10 +80,26 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+void WeightsSharing::countNumaResidentBytes(std::map<int, size_t>& bytesPerNode) const {
+    std::unique_lock<std::mutex> lock(guard);
+    for (const auto& item : sharedWeights) {
+        auto memory = item.second ? item.second->sharedMemory.lock() : nullptr;
+        if (memory && memory->isAllocated() && memory->getPrecision() != element::string)
+            ov::intel_cpu::countNumaResidentBytes(memory->getData(), memory->getSize(), bytesPerNode);
+    }
+}
+
 SocketsWeights::SocketsWeights() {
+    std::map<int, int> socket_numa_nodes;
+    for (int numa_node_id = get_num_numa_nodes() - 1; numa_node_id >= 0; numa_node_id--)
+        socket_numa_nodes[get_socket_by_numa_node(numa_node_id)] = getOrgNumaNodeId(numa_node_id);
+
     int num_sockets = get_num_sockets();
-    for (int socket_id = 0; socket_id < num_sockets; socket_id++)
-         _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+    for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
+        auto numa_node = socket_numa_nodes.find(socket_id);
+        int org_numa_node_id = numa_node != socket_numa_nodes.end() ? numa_node->second : -1;
+        _cache_map[socket_id] = std::make_shared<WeightsSharing>(org_numa_node_id);
+    }
 }
 
 WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) {
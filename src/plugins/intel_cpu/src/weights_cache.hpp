@@ -70,6 +70,11 @@ class WeightsSharing {
 public:
     typedef std::shared_ptr<WeightsSharing> Ptr;
 
+    /**
+     * @param orgNumaNodeId the original (OS) id of the numa node the created memory is placed on, -1 - no placement
+     */
+    explicit WeightsSharing(int orgNumaNodeId = -1) : orgNumaNodeId(orgNumaNodeId) {}
+
     class SharedMemory {
     public:
         typedef std::shared_ptr<SharedMemory> Ptr;
@@ -94,16 +99,31 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    int getNumaNodeId() const { return orgNumaNodeId; }
+
+    /**
+     * Number of the findOrCreate calls which found the memory created earlier
+     */
+    size_t getHitsNumber() const { return hitsNumber; }
+
+    /**
+     * Adds the bytes of the cached memory objects resident on every numa node to bytesPerNode
+     */
+    void countNumaResidentBytes(std::map<int, size_t>& bytesPerNode) const;
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    const int orgNumaNodeId;
+    std::atomic_size_t hitsNumber{0};
     static const SimpleDataHash simpleCRC;
 };
 
 /**
  * Collection of memory caching store per socket
+ * The weights of a socket are placed on its first numa node
  *
  * Is a thread safe
  */
@@ -114,6 +134,8 @@ public:
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
 
+    const std::map<int, WeightsSharing::Ptr>& caches() const { return _cache_map; }
+
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
@@ -9,6 +9,7 @@
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "utils/cpu_test_utils.hpp"
 #include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
 
 using namespace CPUTestUtils;
 
@@ -218,6 +219,58 @@ TEST_P(ConcatSDPTest, CompareWithRefs) {
     }
 }
 
+class ConcatSDPPagedKVCacheTest : public ConcatSDPTest {
+protected:
+    void SetUp() override {
+        ConcatSDPTest::SetUp();
+        // small blocks to make the cache span several blocks
+        configuration.insert(ov::intel_cpu::kv_cache_block_size(4));
+    }
+};
+
+TEST_P(ConcatSDPPagedKVCacheTest, CompareWithRefs) {
+    auto actualOutputs = run_test(function);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Concatenation", 0);
+    auto expectedOutputs = run_test(functionRefs);
+    for (size_t i = 0; i < actualOutputs.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], abs_threshold, rel_threshold);
+    }
+}
+
+TEST_P(ConcatSDPPagedKVCacheTest, ForkState) {
+    compile_model();
+    auto source = compiledModel.create_infer_request();
+    auto forked = compiledModel.create_infer_request();
+    auto infer = [&](ov::InferRequest& request, size_t idx) {
+        generate(static_cast<int>(idx), targetStaticShapes[idx]);
+        for (const auto& input : inputs) {
+            request.set_tensor(input.first, input.second);
+        }
+        request.infer();
+        auto outputTensor = request.get_output_tensor(0);
+        ov::Tensor copy{outputTensor.get_element_type(), outputTensor.get_shape()};
+        outputTensor.copy_to(copy);
+        return copy;
+    };
+    // the common prefix is computed by the source request only
+    infer(source, 0);
+    auto source_states = source.query_state();
+    for (auto&& forked_state : forked.query_state()) {
+        for (auto&& source_state : source_states) {
+            if (source_state.get_name() == forked_state.get_name()) {
+                forked_state.set_state(source_state.get_state());
+            }
+        }
+    }
+    // both requests append the same tokens to the shared prefix, the shared blocks are copied on write
+    for (size_t idx = 1; idx < targetStaticShapes.size(); idx++) {
+        auto expected = infer(source, idx);
+        auto actual = infer(forked, idx);
+        ov::test::utils::compare(expected, actual, abs_threshold, rel_threshold);
+    }
+}
+
 namespace {
 const std::vector<std::vector<InputShape>> inputShapes = {
     // greedy search
@@ -243,6 +296,13 @@ INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTest,
                                             ::testing::Values(true, false)),
                          ConcatSDPTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPPagedKVCacheTest,
+                         ConcatSDPPagedKVCacheTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(false)),
+                         ConcatSDPTest::getTestCaseName);
+
 }  // namespace
 }  // namespace test
 }  // namespace ov
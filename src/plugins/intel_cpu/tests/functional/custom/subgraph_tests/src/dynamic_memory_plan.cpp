@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph with dynamic shapes:
+
+                 param
+                 /   |
+           Softmax   |
+                 \   |
+                  Add
+                   |
+                Reshape (in-place)
+                   |
+                 Result
+
+The Softmax output is an intermediate tensor, whose memory is planned by the dynamic memory planner, while the Add
+output is shared in-place with the Result. The input shapes grow and shrink, so the memory plan is updated after
+some of the inferences, which must not affect the outputs read after the inference. The inference is repeated on
+the same request.
+*/
+
+namespace ov {
+namespace test {
+
+class DynamicMemoryPlanCPUTest : virtual public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        const auto precision = ov::element::f32;
+        InputShape input_shape{{-1, -1, 16},
+                               {{1, 2, 16}, {4, 8, 16}, {2, 3, 16}, {8, 16, 16}, {1, 1, 16}, {16, 32, 16}, {4, 8, 16}}};
+        init_input_shapes({input_shape});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        auto softmax = std::make_shared<ov::op::v8::Softmax>(param, -1);
+        auto add = std::make_shared<ov::op::v1::Add>(softmax, param);
+        auto target_shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {0, -1});
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(add, target_shape, true);
+        auto result = std::make_shared<ov::op::v0::Result>(reshape);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result},
+                                               ov::ParameterVector{param},
+                                               "DynamicMemoryPlan");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        // new values on every inference
+        seed++;
+        for (size_t i = 0; i < funcInputs.size(); i++) {
+            ov::test::utils::InputGenerateData inGenData(-5, 10, 32, seed);
+            auto tensor = ov::test::utils::create_and_fill_tensor(funcInputs[i].get_element_type(),
+                                                                   targetInputStaticShapes[i],
+                                                                   inGenData);
+            inputs.insert({funcInputs[i].get_node_shared_ptr(), tensor});
+        }
+    }
+
+    // the same request is reused, so the outputs of each inference are read after the plan update of the previous one
+    void infer() override {
+        if (!inferRequest)
+            inferRequest = compiledModel.create_infer_request();
+        for (const auto& input : inputs) {
+            inferRequest.set_tensor(input.first, input.second);
+        }
+        inferRequest.infer();
+    }
+
+    int32_t seed = 0;
+};
+
+TEST_F(DynamicMemoryPlanCPUTest, smoke_InPlaceOutput) {
+    run();
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,207 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+/*
+ *    Weights(u8)     Subtract_const(u8)
+ *       |               /
+ *    Convert(f16)  Convert(f16)
+ *            \        /
+ *            Subtract(f16) (optional)
+ *                  \      Multiply_const(f16)
+ *                   \       /
+ *                    Multiply
+ *                      /
+ *    Indices(i64)  Convert(f32)
+ *         |        /
+ *    Convert(i32) /
+ *            \   /
+ *     EmbeddingBagPackedSum(f32)
+ */
+
+struct EmbeddingBagDecompressionShapeParams {
+    EmbeddingBagDecompressionShapeParams() = default;
+    EmbeddingBagDecompressionShapeParams(InputShape _indices_shape, ov::Shape _weights_shape)
+        : indices_shape(std::move(_indices_shape)),
+          weights_shape(std::move(_weights_shape)) {}
+
+    InputShape indices_shape;
+    ov::Shape weights_shape;
+};
+
+using EmbeddingBagWeightsDecompressParams = std::tuple<EmbeddingBagDecompressionShapeParams,
+                                                       bool,                // decompression subtract
+                                                       bool,                // per sample weights
+                                                       ov::element::Type>;  // inference precision
+
+class EmbeddingBagWeightsDecompression : public testing::WithParamInterface<EmbeddingBagWeightsDecompressParams>,
+                                         virtual public SubgraphBaseTest,
+                                         public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<EmbeddingBagWeightsDecompressParams> obj) {
+        EmbeddingBagDecompressionShapeParams shape_params;
+        bool decompression_sub;
+        bool with_per_sample_weights;
+        ov::element::Type inference_precision;
+
+        std::tie(shape_params, decompression_sub, with_per_sample_weights, inference_precision) = obj.param;
+
+        std::ostringstream result;
+        result << "indices_shape=" << shape_params.indices_shape << "_";
+        result << "weights_shape=" << shape_params.weights_shape << "_";
+        result << "decompression_subtract=" << decompression_sub << "_";
+        result << "per_sample_weights=" << with_per_sample_weights << "_";
+        result << "inference_precision=" << inference_precision;
+
+        return result.str();
+    }
+
+protected:
+    std::shared_ptr<ov::Node> initDecompressionWeights(const ov::Shape& weights_shape,
+                                                       const ov::element::Type weights_precision,
+                                                       const bool add_subtract) {
+        auto weights = ov::test::utils::make_constant(weights_precision,
+                                                      weights_shape,
+                                                      ov::test::utils::InputGenerateData{0, 255});
+        weights->set_friendly_name("Compressed_weights");
+        std::shared_ptr<ov::Node> weights_convert = std::make_shared<ov::op::v0::Convert>(weights, ov::element::f16);
+
+        if (add_subtract) {
+            std::shared_ptr<ov::Node> zp_const = ov::test::utils::make_constant(ov::element::u8,
+                                                                                ov::Shape{weights_shape[0], 1},
+                                                                                ov::test::utils::InputGenerateData{});
+            auto zp_convert = std::make_shared<ov::op::v0::Convert>(zp_const, ov::element::f16);
+            weights_convert = std::make_shared<ov::op::v1::Subtract>(weights_convert, zp_convert);
+        }
+
+        std::shared_ptr<ov::Node> scale_const =
+            ov::test::utils::make_constant(ov::element::f16,
+                                           ov::Shape{weights_shape[0], 1},
+                                           ov::test::utils::InputGenerateData{});
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(weights_convert, scale_const);
+        auto last_node = std::make_shared<ov::op::v0::Convert>(multiply, ov::element::f32);
+        return last_node;
+    }
+
+    std::shared_ptr<ov::Model> initSubgraph(const ov::PartialShape& indices_shape,
+                                            const ov::Shape& weights_shape,
+                                            const bool add_subtract,
+                                            const bool with_per_sample_weights) {
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::i64, indices_shape)};
+        auto indices_convert = std::make_shared<ov::op::v0::Convert>(params[0], ov::element::i32);
+
+        const auto weights_subgraph = initDecompressionWeights(weights_shape, ov::element::u8, add_subtract);
+
+        std::shared_ptr<ov::Node> embedding_bag;
+        if (with_per_sample_weights) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, indices_shape));
+            embedding_bag = std::make_shared<ov::op::v3::EmbeddingBagPackedSum>(weights_subgraph, indices_convert, params[1]);
+        } else {
+            embedding_bag = std::make_shared<ov::op::v3::EmbeddingBagPackedSum>(weights_subgraph, indices_convert);
+        }
+        embedding_bag->set_friendly_name("EmbeddingBagCompression");
+
+        return std::make_shared<ov::Model>(embedding_bag->outputs(), params, "EmbeddingBagWeightsDecompression");
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        EmbeddingBagDecompressionShapeParams shape_params;
+        bool decompression_sub;
+        bool with_per_sample_weights;
+
+        std::tie(shape_params, decompression_sub, with_per_sample_weights, inference_precision) = GetParam();
+
+        configuration.insert({ov::hint::inference_precision(inference_precision)});
+        std::vector<InputShape> input_shapes{shape_params.indices_shape};
+        if (with_per_sample_weights)
+            input_shapes.push_back(shape_params.indices_shape);
+        init_input_shapes(input_shapes);
+
+        inType = outType = ov::element::f32;
+        // the table is decompressed to f32 by the node itself, the low precision affects the rest of the graph only
+        if (inference_precision != ov::element::f32) {
+            abs_threshold = 1e-2f;
+            rel_threshold = 1e-2f;
+        }
+
+        function = initSubgraph(inputDynamicShapes[0],
+                                shape_params.weights_shape,
+                                decompression_sub,
+                                with_per_sample_weights);
+    }
+
+    void check_results() {
+        bool weights_found = false;
+        bool embedding_bag_found = false;
+        for (const auto& n : compiledModel.get_runtime_model()->get_ordered_ops()) {
+            if (n->get_friendly_name() == "Compressed_weights") {
+                ASSERT_EQ(n->get_output_element_type(0), ov::element::u8);
+                weights_found = true;
+            }
+            if (n->get_friendly_name() == "EmbeddingBagCompression") {
+                ASSERT_EQ(n->get_input_element_type(0), ov::element::u8);
+                ASSERT_EQ(n->get_output_element_type(0), ov::element::f32);
+                embedding_bag_found = true;
+            }
+        }
+        ASSERT_TRUE(weights_found);
+        ASSERT_TRUE(embedding_bag_found);
+
+        // the low inference precision may insert the conversions of the per sample weights
+        if (inference_precision == ov::element::f32)
+            CheckNumberOfNodesWithType(compiledModel, "Convert", 1);
+        CheckNumberOfNodesWithType(compiledModel, "Subtract", 0);
+        CheckNumberOfNodesWithType(compiledModel, "Multiply", 0);
+        CheckNumberOfNodesWithType(compiledModel, "Subgraph", 0);
+    }
+
+    ov::element::Type inference_precision = ov::element::f32;
+};
+
+TEST_P(EmbeddingBagWeightsDecompression, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (inference_precision == ov::element::bf16 && !ov::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+    if (inference_precision == ov::element::f16 && !ov::with_cpu_x86_avx512_core_fp16())
+        GTEST_SKIP();
+    run();
+    check_results();
+}
+
+namespace {
+
+const std::vector<EmbeddingBagDecompressionShapeParams> input_weights_shapes = {
+    {{{-1, -1}, {{1, 1}, {3, 4}}}, {16, 32}},
+    {{{-1, -1}, {{2, 8}}}, {16, 67}},
+    {{{}, {{4, 3}}}, {24, 256}}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagCompressedWeights_basic,
+                         EmbeddingBagWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(input_weights_shapes),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(ov::element::f32)),
+                         EmbeddingBagWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagCompressedWeights_lowPrecision,
+                         EmbeddingBagWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(input_weights_shapes),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(ov::element::bf16, ov::element::f16)),
+                         EmbeddingBagWeightsDecompression::getTestCaseName);
+}  // namespace
+}  // namespace test
+}  // namespace ov
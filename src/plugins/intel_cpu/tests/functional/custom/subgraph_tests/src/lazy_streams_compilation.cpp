@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                          param
+                            |
+                           Conv
+                            |
+                           Relu
+                            |
+                          Result
+
+The model is compiled for several streams in the lazy streams compilation mode, so the inference starts when only
+the graph of the first stream is created. The test checks that the concurrent requests executed while the graphs
+of the other streams are being created give the same results as the reference, and that the compiled model can be
+released before all the graphs are created.
+*/
+
+namespace ov {
+namespace test {
+
+class LazyStreamsCompilationCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::lazy_streams_compilation(true));
+        configuration.insert(ov::num_streams(4));
+
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{}, {{1, 8, 16, 16}}};
+        init_input_shapes({input_shape});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        auto conv = utils::make_convolution(param, precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                            ov::op::PadType::EXPLICIT, 8);
+        auto relu = std::make_shared<ov::op::v0::Relu>(conv);
+        auto result = std::make_shared<ov::op::v0::Result>(relu);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "LazyStreams");
+    }
+};
+
+TEST_F(LazyStreamsCompilationCPUTest, smoke_CompareWithRefs) {
+    run();
+}
+
+TEST_F(LazyStreamsCompilationCPUTest, smoke_ConcurrentRequests) {
+    compile_model();
+    generate_inputs(targetStaticShapes.front());
+    const auto& input = inputs.begin()->second;
+
+    inferRequest = compiledModel.create_infer_request();
+    inferRequest.set_tensor(compiledModel.input(), input);
+    inferRequest.infer();
+    const auto expected = inferRequest.get_tensor(compiledModel.output());
+
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < 8; i++) {
+        requests.push_back(compiledModel.create_infer_request());
+        requests.back().set_tensor(compiledModel.input(), input);
+    }
+    for (size_t iteration = 0; iteration < 4; iteration++) {
+        for (auto& request : requests) {
+            request.start_async();
+        }
+        for (auto& request : requests) {
+            request.wait();
+            ov::test::utils::compare(expected, request.get_tensor(compiledModel.output()));
+        }
+    }
+}
+
+TEST_F(LazyStreamsCompilationCPUTest, smoke_ReleaseWhileCompiling) {
+    for (size_t i = 0; i < 8; i++) {
+        // the graphs of the other streams are still being created
+        compile_model();
+        compiledModel = {};
+    }
+    // the released models don't block the streams of the next one
+    run();
+}
+
+}  // namespace test
+}  // namespace ov
@@ -318,6 +318,33 @@ TEST_P(MatmulWeightsDecompression, CompareWithRefs) {
     check_results();
 }
 
+// a few src rows: the FullyConnected must be executed by the GEMV executor for the compressed weights
+class MatmulWeightsDecompressionDecode : public MatmulWeightsDecompression {
+public:
+    void check_gemv_executor() {
+        if (!ov::with_cpu_x86_avx2())
+            return;
+        // the src of the test models is f32
+        const std::string expected_type = ov::with_cpu_x86_avx512_core() ? "jit_avx512_f32" : "jit_avx2_f32";
+        bool fc_found = false;
+        for (const auto& n : compiledModel.get_runtime_model()->get_ordered_ops()) {
+            const auto& rt_info = n->get_rt_info();
+            if (rt_info.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() != "FullyConnected")
+                continue;
+            ASSERT_EQ(rt_info.at(ov::exec_model_info::IMPL_TYPE).as<std::string>(), expected_type);
+            fc_found = true;
+        }
+        ASSERT_TRUE(fc_found);
+    }
+};
+
+TEST_P(MatmulWeightsDecompressionDecode, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    check_results();
+    check_gemv_executor();
+}
+
 namespace {
 
 std::vector<ov::AnyMap> filter_additional_config_basic() {
@@ -425,6 +452,27 @@ INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_corner_cases_amx,
                                             ::testing::Values(emptyFusingSpec),
                                             ::testing::Values(true)),
                          MatmulWeightsDecompression::getTestCaseName);
+
+// a few src rows (LLM decoding): the rows tail, the channels tail and K split by the groups over the threads,
+// the last shape of each case is executed by the GEMV executor (17 rows fall back to oneDNN)
+const std::vector<ShapeParams> input_shapes_decode = {
+    {{{-1, -1, -1}, {{1, 1, 512}, {1, 7, 512}, {2, 8, 512}}}, {512, 100}, 64ul},
+    {{{-1, -1, -1}, {{1, 1, 2048}, {1, 3, 2048}}}, {2048, 40}, 32ul},
+    {{{-1, -1, -1}, {{1, 17, 256}, {1, 16, 256}}}, {256, 64}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_decode,
+                         MatmulWeightsDecompressionDecode,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes_decode),
+                                            ::testing::ValuesIn(weights_precisions),
+                                            ::testing::ValuesIn(decompression_precisions),
+                                            ::testing::ValuesIn(transpose_weights),
+                                            ::testing::ValuesIn(decompression_subtract_type),
+                                            ::testing::Values(true),
+                                            ::testing::ValuesIn(filter_additional_config_basic()),
+                                            ::testing::ValuesIn(fusing_params),
+                                            ::testing::Values(true)),
+                         MatmulWeightsDecompression::getTestCaseName);
 }  // namespace
 }  // namespace test
 }  // namespace ov
@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+/*
+ * The normalizations by the innermost dimension are tokenized by Snippets together with their element-wise
+ * producers and consumers into a single Subgraph instead of being executed by the MVN or Reduce nodes.
+ *
+ *  RMSNorm:   x * gamma / sqrt(ReduceMean(x^2) + eps)
+ *  LayerNorm: MVN(x) * gamma + beta
+ *  ReduceMax: exp(x - ReduceMax(x))
+ */
+enum class NormalizationType { RMSNorm, LayerNorm, ReduceMax };
+
+inline std::ostream& operator<<(std::ostream& os, NormalizationType type) {
+    switch (type) {
+    case NormalizationType::RMSNorm:
+        return os << "RMSNorm";
+    case NormalizationType::LayerNorm:
+        return os << "LayerNorm";
+    case NormalizationType::ReduceMax:
+        return os << "ReduceMax";
+    default:
+        OPENVINO_THROW("Unknown NormalizationType");
+    }
+}
+
+using NormalizationTokenizationParams = std::tuple<ov::Shape, NormalizationType>;
+
+class NormalizationTokenizationTest : public testing::WithParamInterface<NormalizationTokenizationParams>,
+                                      virtual public SubgraphBaseStaticTest,
+                                      public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<NormalizationTokenizationParams>& obj) {
+        ov::Shape shape;
+        NormalizationType type;
+        std::tie(shape, type) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::vec2str(shape) << "_Type=" << type;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ov::Shape shape;
+        NormalizationType type;
+        std::tie(shape, type) = GetParam();
+
+        const auto prc = ov::element::f32;
+        const ov::Shape channels_shape{shape.back()};
+        auto param = std::make_shared<ov::op::v0::Parameter>(prc, shape);
+        auto axis = ov::op::v0::Constant::create(ov::element::i64, {1}, {-1});
+        std::shared_ptr<ov::Node> result;
+        switch (type) {
+        case NormalizationType::RMSNorm: {
+            auto power = std::make_shared<ov::op::v1::Power>(param, ov::op::v0::Constant::create(prc, {}, {2.f}));
+            auto mean = std::make_shared<ov::op::v1::ReduceMean>(power, axis, true);
+            auto add = std::make_shared<ov::op::v1::Add>(mean, ov::op::v0::Constant::create(prc, {}, {1e-5f}));
+            auto sqrt = std::make_shared<ov::op::v0::Sqrt>(add);
+            auto div = std::make_shared<ov::op::v1::Divide>(param, sqrt);
+            auto gamma = ov::test::utils::deprecated::make_constant(prc, channels_shape, std::vector<float>{}, true);
+            result = std::make_shared<ov::op::v1::Multiply>(div, gamma);
+            break;
+        }
+        case NormalizationType::LayerNorm: {
+            auto mvn = std::make_shared<ov::op::v6::MVN>(param, axis, true, 1e-5f, ov::op::MVNEpsMode::INSIDE_SQRT);
+            auto gamma = ov::test::utils::deprecated::make_constant(prc, channels_shape, std::vector<float>{}, true);
+            auto beta = ov::test::utils::deprecated::make_constant(prc, channels_shape, std::vector<float>{}, true);
+            auto mul = std::make_shared<ov::op::v1::Multiply>(mvn, gamma);
+            result = std::make_shared<ov::op::v1::Add>(mul, beta);
+            break;
+        }
+        case NormalizationType::ReduceMax: {
+            auto max = std::make_shared<ov::op::v1::ReduceMax>(param, axis, true);
+            auto sub = std::make_shared<ov::op::v1::Subtract>(param, max);
+            result = std::make_shared<ov::op::v0::Exp>(sub);
+            break;
+        }
+        default:
+            OPENVINO_THROW("Unknown NormalizationType");
+        }
+        function = std::make_shared<ov::Model>(ov::NodeVector{result}, ov::ParameterVector{param}, "Normalization");
+        abs_threshold = 1e-4;
+    }
+};
+
+TEST_P(NormalizationTokenizationTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    // Snippets are supported on x64 with AVX2 and newer
+    if (!ov::with_cpu_x86_avx2())
+        GTEST_SKIP();
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+    CheckNumberOfNodesWithTypes(compiledModel, {"MVN", "Reduce", "Eltwise"}, 0);
+}
+
+namespace {
+
+const std::vector<ov::Shape> shapes = {
+    {1, 16, 64},
+    // the tails of the vector Loops
+    {2, 7, 37},
+    {4, 2, 5, 4096},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_NormalizationTokenization,
+                         NormalizationTokenizationTest,
+                         ::testing::Combine(::testing::ValuesIn(shapes),
+                                            ::testing::Values(NormalizationType::RMSNorm,
+                                                              NormalizationType::LayerNorm,
+                                                              NormalizationType::ReduceMax)),
+                         NormalizationTokenizationTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
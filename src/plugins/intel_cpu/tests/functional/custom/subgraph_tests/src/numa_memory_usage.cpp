@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "internal_properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                          param
+                            |
+                           Conv
+                            |
+                           Relu
+                            |
+                          Result
+
+The model is compiled for several streams, so the weights are kept in the weights caches of the sockets.
+The test checks the CPU_NUMA_MEMORY_USAGE property of the compiled model: its keys, the consistency of the local
+and remote bytes with the bytes per numa node, and that the bytes per numa node are bounded by the model memory.
+*/
+
+namespace ov {
+namespace test {
+
+class NumaMemoryUsageCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::num_streams(2));
+
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{}, {{1, channels, 16, 16}}};
+        init_input_shapes({input_shape});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        auto conv = utils::make_convolution(param, precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                            ov::op::PadType::EXPLICIT, channels);
+        auto relu = std::make_shared<ov::op::v0::Relu>(conv);
+        auto result = std::make_shared<ov::op::v0::Result>(relu);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "NumaMemoryUsage");
+    }
+
+    static constexpr size_t channels = 256;
+};
+
+TEST_F(NumaMemoryUsageCPUTest, smoke_NumaMemoryUsage) {
+    run();
+
+    const auto usage = compiledModel.get_property(ov::intel_cpu::numa_memory_usage);
+    ASSERT_EQ(usage.count("local"), 1);
+    ASSERT_EQ(usage.count("remote"), 1);
+
+    uint64_t weights = 0;
+    uint64_t activations = 0;
+    for (const auto& item : usage) {
+        if (item.first == "local" || item.first == "remote")
+            continue;
+        const auto dot = item.first.find('.');
+        ASSERT_NE(dot, std::string::npos) << item.first;
+        const auto kind = item.first.substr(0, dot);
+        ASSERT_GE(std::stoi(item.first.substr(dot + 1)), 0) << item.first;
+        if (kind == "weights") {
+            weights += item.second;
+        } else {
+            ASSERT_EQ(kind, "activations");
+            activations += item.second;
+        }
+    }
+
+    if (ov::get_num_numa_nodes() > 1) {
+        ASSERT_EQ(usage.at("local") + usage.at("remote"), weights + activations);
+    } else {
+        // there is no remote memory on a single numa node
+        ASSERT_EQ(usage.at("local"), 0);
+        ASSERT_EQ(usage.at("remote"), 0);
+    }
+
+    // the weights are kept in the cache twice at most: the original constant and the reordered one;
+    // the graph of a stream keeps a few 256 KB tensors of 256x16x16 shape at most
+    const uint64_t weights_size = channels * channels * 3 * 3 * sizeof(float);
+    const uint64_t page_size = 64 * 1024;
+    ASSERT_LE(weights, 2 * weights_size + page_size);
+    ASSERT_LE(activations, 2 * (2 << 20));
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "common_test_utils/node_builders/constant.hpp"
+#include "internal_properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                          param
+                       /    |    \
+                      /     |     \
+                   Conv    Conv   Multiply
+                    |       |     /  |
+                   Relu    Add --    |
+                    \       |       /
+                     \      |      /
+                           Concat
+                             |
+                           Result
+
+The Inception-like branches are executed concurrently in the parallel branches mode.
+The Multiply output is consumed by two nodes of different waves, so the test also checks that the memory
+reuse plan and the in-place modification of the shared tensors stay correct under the concurrent execution.
+*/
+
+namespace ov {
+namespace test {
+
+class ParallelBranchesCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::enable_parallel_branches(true));
+
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{}, {{1, 8, 16, 16}}};
+        init_input_shapes({input_shape});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+
+        auto conv_1 = utils::make_convolution(param, precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              ov::op::PadType::EXPLICIT, 8);
+        auto relu = std::make_shared<ov::op::v0::Relu>(conv_1);
+
+        auto conv_2 = utils::make_convolution(param, precision, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                              ov::op::PadType::EXPLICIT, 8);
+
+        auto mul_const = ov::test::utils::deprecated::make_constant(precision, {1}, std::vector<float>({2.0f}));
+        auto mul = utils::make_eltwise(param, mul_const, utils::EltwiseTypes::MULTIPLY);
+        auto add = utils::make_eltwise(conv_2, mul, utils::EltwiseTypes::ADD);
+
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::NodeVector{relu, add, mul}, 1);
+        auto result = std::make_shared<ov::op::v0::Result>(concat);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "ParallelBranches");
+    }
+};
+
+TEST_F(ParallelBranchesCPUTest, smoke_CompareWithRefs) {
+    run();
+}
+
+/*This test runs the following subgraph:
+
+                          param
+                         /     \
+              FullyConnected  FullyConnected
+                         \     /
+                          Concat
+                            |
+                          Result
+
+The FullyConnected nodes are in the same wave, so their executors run concurrently and must use the scratch pads
+of different lanes. The dynamic shapes make the executors update their scratch pad memory during the inference.
+*/
+
+class ParallelFullyConnectedCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::enable_parallel_branches(true));
+
+        const auto precision = ov::element::f32;
+        const size_t ic = 512, oc = 256;
+        ov::test::InputShape input_shape{{-1, ic}, {{1, ic}, {17, ic}, {64, ic}, {3, ic}}};
+        init_input_shapes({input_shape});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        ov::OutputVector branches;
+        for (size_t i = 0; i < 2; i++) {
+            auto weights = ov::test::utils::deprecated::make_constant(precision, {oc, ic}, std::vector<float>{}, true);
+            branches.push_back(std::make_shared<ov::op::v0::MatMul>(param, weights, false, true));
+        }
+        auto concat = std::make_shared<ov::op::v0::Concat>(branches, 1);
+        auto result = std::make_shared<ov::op::v0::Result>(concat);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result},
+                                               ov::ParameterVector{param},
+                                               "ParallelFullyConnected");
+    }
+};
+
+TEST_F(ParallelFullyConnectedCPUTest, smoke_CompareWithRefs) {
+    run();
+}
+
+}  // namespace test
+}  // namespace ov
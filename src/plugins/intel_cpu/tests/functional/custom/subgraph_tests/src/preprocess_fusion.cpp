@@ -0,0 +1,222 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/core/preprocess/pre_post_process.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+/*
+ * The PrePostProcessor steps of an u8 frame are fused into a single Preprocess node:
+ *
+ *   frame (NV12/I420 planes or interleaved) -> Convert(f32) -> [ColorConvert] -> Interpolate -> mean/scale -> [Transpose]
+ *
+ * or, with the u8 color conversion, the color is converted before the Convert and rounded to u8:
+ *
+ *   frame (NV12/I420 planes) -> ColorConvert -> Convert(f32) -> Interpolate -> mean/scale -> [Transpose]
+ *
+ * The result is compared with the reference execution of the original (unfused) PrePostProcessor steps.
+ * The model body is a 1x1 Convolution for NCHW layout and a MatMul by channels for NHWC layout.
+ */
+using PreprocessFusionParams = std::tuple<ov::preprocess::ColorFormat,      // source frame format
+                                          ov::preprocess::ResizeAlgorithm,  // resize algorithm
+                                          ov::Shape,                        // resized spatial shape
+                                          std::string,                      // model layout
+                                          ov::element::Type,                // inference precision
+                                          bool>;                            // u8 color conversion
+
+class PreprocessFusionCPUTest : public testing::WithParamInterface<PreprocessFusionParams>,
+                                virtual public SubgraphBaseStaticTest,
+                                public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<PreprocessFusionParams>& obj) {
+        ov::preprocess::ColorFormat format;
+        ov::preprocess::ResizeAlgorithm resize;
+        ov::Shape spatialShape;
+        std::string layout;
+        ov::element::Type prc;
+        bool u8ColorConversion;
+        std::tie(format, resize, spatialShape, layout, prc, u8ColorConversion) = obj.param;
+
+        std::ostringstream result;
+        result << "Format=" << formatToString(format) << "_";
+        result << "Resize=" << (resize == ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR ? "LINEAR" : "NEAREST") << "_";
+        result << "Spatial=" << ov::test::utils::vec2str(spatialShape) << "_";
+        result << "Layout=" << layout << "_";
+        result << "Prc=" << prc << "_";
+        result << "U8ColorConversion=" << u8ColorConversion;
+        return result.str();
+    }
+
+protected:
+    static std::string formatToString(ov::preprocess::ColorFormat format) {
+        switch (format) {
+        case ov::preprocess::ColorFormat::NV12_SINGLE_PLANE:
+            return "NV12_SINGLE_PLANE";
+        case ov::preprocess::ColorFormat::NV12_TWO_PLANES:
+            return "NV12_TWO_PLANES";
+        case ov::preprocess::ColorFormat::I420_SINGLE_PLANE:
+            return "I420_SINGLE_PLANE";
+        case ov::preprocess::ColorFormat::I420_THREE_PLANES:
+            return "I420_THREE_PLANES";
+        case ov::preprocess::ColorFormat::RGB:
+            return "RGB";
+        default:
+            OPENVINO_THROW("Unexpected color format");
+        }
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ov::preprocess::ColorFormat format;
+        ov::preprocess::ResizeAlgorithm resize;
+        ov::Shape spatialShape;
+        std::string layout;
+        ov::element::Type prc;
+        bool u8ColorConversion;
+        std::tie(format, resize, spatialShape, layout, prc, u8ColorConversion) = GetParam();
+
+        const size_t channels = 3, outChannels = 8;
+        const bool nchw = layout == "NCHW";
+        const ov::Shape shape = nchw ? ov::Shape{1, channels, spatialShape[0], spatialShape[1]}
+                                     : ov::Shape{1, spatialShape[0], spatialShape[1], channels};
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        std::shared_ptr<ov::Node> body;
+        if (nchw) {
+            auto weights = ov::test::utils::deprecated::make_constant(ov::element::f32,
+                                                                      {outChannels, channels, 1, 1},
+                                                                      std::vector<float>{},
+                                                                      true);
+            body = std::make_shared<ov::op::v1::Convolution>(param,
+                                                             weights,
+                                                             ov::Strides{1, 1},
+                                                             ov::CoordinateDiff{0, 0},
+                                                             ov::CoordinateDiff{0, 0},
+                                                             ov::Strides{1, 1});
+        } else {
+            auto weights = ov::test::utils::deprecated::make_constant(ov::element::f32,
+                                                                      {channels, outChannels},
+                                                                      std::vector<float>{},
+                                                                      true);
+            body = std::make_shared<ov::op::v0::MatMul>(param, weights);
+        }
+        function = std::make_shared<ov::Model>(ov::NodeVector{body}, ov::ParameterVector{param}, "PreprocessFusion");
+
+        ov::preprocess::PrePostProcessor ppp(function);
+        auto& tensor = ppp.input().tensor();
+        tensor.set_element_type(ov::element::u8).set_spatial_static_shape(sourceHeight, sourceWidth);
+        if (format == ov::preprocess::ColorFormat::RGB) {
+            tensor.set_layout("NHWC");
+        } else {
+            tensor.set_color_format(format);
+        }
+        auto& preprocess = ppp.input().preprocess();
+        const auto colorFormat = nchw ? ov::preprocess::ColorFormat::BGR : ov::preprocess::ColorFormat::RGB;
+        if (u8ColorConversion) {
+            preprocess.convert_color(colorFormat).convert_element_type(ov::element::f32);
+        } else {
+            preprocess.convert_element_type(ov::element::f32);
+            if (format != ov::preprocess::ColorFormat::RGB) {
+                preprocess.convert_color(colorFormat);
+            }
+        }
+        preprocess.resize(resize).mean({123.675f, 116.28f, 103.53f}).scale({58.395f, 57.12f, 57.375f});
+        ppp.input().model().set_layout(ov::Layout(layout));
+        function = ppp.build();
+
+        configuration.insert(ov::hint::inference_precision(prc));
+        if (prc == ov::element::bf16) {
+            rel_threshold = 2e-2f;
+            abs_threshold = 5e-2f;
+        } else if (u8ColorConversion) {
+            // the color rounded to the other u8 value in the ties, it is the step of the u8 color divided by scale
+            abs_threshold = 2e-2f;
+        } else {
+            abs_threshold = 1e-3f;
+        }
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); i++) {
+            ov::test::utils::InputGenerateData inGenData(0, 255);
+            auto tensor = ov::test::utils::create_and_fill_tensor(funcInputs[i].get_element_type(),
+                                                                   targetInputStaticShapes[i],
+                                                                   inGenData);
+            inputs.insert({funcInputs[i].get_node_shared_ptr(), tensor});
+        }
+    }
+
+    static constexpr size_t sourceHeight = 60;
+    static constexpr size_t sourceWidth = 80;
+};
+
+TEST_P(PreprocessFusionCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (std::get<4>(GetParam()) == ov::element::bf16 && !ov::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Preprocess", 1);
+    CheckNumberOfNodesWithTypes(compiledModel, {"ColorConvert", "Interpolate"}, 0);
+}
+
+namespace {
+
+const std::vector<ov::preprocess::ColorFormat> formats = {
+    ov::preprocess::ColorFormat::NV12_SINGLE_PLANE,
+    ov::preprocess::ColorFormat::NV12_TWO_PLANES,
+    ov::preprocess::ColorFormat::I420_SINGLE_PLANE,
+    ov::preprocess::ColorFormat::I420_THREE_PLANES,
+    // interleaved frame
+    ov::preprocess::ColorFormat::RGB,
+};
+
+const std::vector<ov::preprocess::ColorFormat> planarFormats = {
+    ov::preprocess::ColorFormat::NV12_SINGLE_PLANE,
+    ov::preprocess::ColorFormat::NV12_TWO_PLANES,
+    ov::preprocess::ColorFormat::I420_SINGLE_PLANE,
+    ov::preprocess::ColorFormat::I420_THREE_PLANES,
+};
+
+const std::vector<ov::preprocess::ResizeAlgorithm> resizeAlgorithms = {
+    ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR,
+    ov::preprocess::ResizeAlgorithm::RESIZE_NEAREST,
+};
+
+// downscale and upscale of the 60x80 frame
+const std::vector<ov::Shape> spatialShapes = {
+    {32, 48},
+    {90, 100},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_PreprocessFusion,
+                         PreprocessFusionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(formats),
+                                            ::testing::ValuesIn(resizeAlgorithms),
+                                            ::testing::ValuesIn(spatialShapes),
+                                            ::testing::Values("NCHW", "NHWC"),
+                                            ::testing::Values(ov::element::f32, ov::element::bf16),
+                                            ::testing::Values(false)),
+                         PreprocessFusionCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_PreprocessFusion_U8ColorConversion,
+                         PreprocessFusionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(planarFormats),
+                                            ::testing::ValuesIn(resizeAlgorithms),
+                                            ::testing::ValuesIn(spatialShapes),
+                                            ::testing::Values("NCHW", "NHWC"),
+                                            ::testing::Values(ov::element::f32),
+                                            ::testing::Values(true)),
+                         PreprocessFusionCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                          param
+                            |
+                           Conv
+                            |
+                           Relu
+                            |
+                          Result
+
+The model is compiled with the request priority and deadline, so its requests are executed by the scheduling
+executor. The test runs both the synchronous and the asynchronous inference and compares them with the reference.
+*/
+
+namespace ov {
+namespace test {
+
+class RequestPriorityCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::request_priority(ov::hint::Priority::HIGH));
+        configuration.insert(ov::intel_cpu::request_deadline(100));
+
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{}, {{1, 16, 16, 16}}};
+        init_input_shapes({input_shape});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        auto conv = utils::make_convolution(param, precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                            ov::op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<ov::op::v0::Relu>(conv);
+        auto result = std::make_shared<ov::op::v0::Result>(relu);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "RequestPriority");
+    }
+};
+
+TEST_F(RequestPriorityCPUTest, smoke_SyncInfer) {
+    // SubgraphBaseTest runs the synchronous inference
+    run();
+}
+
+TEST_F(RequestPriorityCPUTest, smoke_AsyncInfer) {
+    run();
+
+    auto request = compiledModel.create_infer_request();
+    for (const auto& input : inputs) {
+        request.set_tensor(input.first, input.second);
+    }
+    request.start_async();
+    request.wait();
+    ov::test::utils::compare(inferRequest.get_tensor(compiledModel.output()),
+                             request.get_tensor(compiledModel.output()));
+}
+
+}  // namespace test
+}  // namespace ov
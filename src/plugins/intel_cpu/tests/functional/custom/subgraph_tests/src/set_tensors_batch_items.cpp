@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov {
+namespace test {
+
+/*
+ * The model input is set by ov::InferRequest::set_tensors, one tensor per batch item. If all the consumers of the
+ * input can read the items from their own buffers (Reorder and Convert), the items are not gathered into one batched
+ * tensor, otherwise (e.g. Convolution or Result) they are gathered as before.
+ *
+ *   Convert:   param(u8) -> Convert(f32) -> Convolution -> Result
+ *   Reorder:   param(f32, 16 channels) -> [Reorder to NHWC or blocked] -> Convolution -> Result
+ *   Fallback:  param(f32, 3 channels) -> Convolution -> Result
+ *                                     \-> Result
+ *
+ * The results are compared with the ones of the batched tensor gathered by the test and set by set_tensor. The test
+ * also switches the input from set_tensors to set_tensor and back on the same request.
+ */
+enum class BatchItemsConsumer { Convert, Reorder, Fallback };
+
+inline std::ostream& operator<<(std::ostream& os, BatchItemsConsumer consumer) {
+    switch (consumer) {
+    case BatchItemsConsumer::Convert:
+        return os << "Convert";
+    case BatchItemsConsumer::Reorder:
+        return os << "Reorder";
+    case BatchItemsConsumer::Fallback:
+        return os << "Fallback";
+    default:
+        OPENVINO_THROW("Unknown BatchItemsConsumer");
+    }
+}
+
+class SetTensorsBatchItemsCPUTest : public testing::WithParamInterface<BatchItemsConsumer>,
+                                    virtual public SubgraphBaseStaticTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<BatchItemsConsumer>& obj) {
+        std::ostringstream result;
+        result << "Consumer=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto consumer = GetParam();
+
+        const size_t channels = consumer == BatchItemsConsumer::Reorder ? 16 : 3;
+        const auto input_precision = consumer == BatchItemsConsumer::Convert ? ov::element::u8 : ov::element::f32;
+        auto param = std::make_shared<ov::op::v0::Parameter>(input_precision, ov::Shape{batch, channels, 8, 8});
+
+        std::shared_ptr<ov::Node> conv_input = param;
+        if (consumer == BatchItemsConsumer::Convert)
+            conv_input = std::make_shared<ov::op::v0::Convert>(param, ov::element::f32);
+        auto conv = utils::make_convolution(conv_input, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                            ov::op::PadType::EXPLICIT, 16);
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(conv)};
+        if (consumer == BatchItemsConsumer::Fallback)
+            results.push_back(std::make_shared<ov::op::v0::Result>(param));
+        function = std::make_shared<ov::Model>(results, ov::ParameterVector{param}, "SetTensorsBatchItems");
+    }
+
+    std::vector<ov::Tensor> makeItems(int32_t seed) const {
+        const auto& input = function->input();
+        auto item_shape = input.get_shape();
+        item_shape[0] = 1;
+        std::vector<ov::Tensor> items;
+        for (size_t i = 0; i < batch; i++) {
+            ov::test::utils::InputGenerateData in_data(0, 255, 1, seed + static_cast<int32_t>(i));
+            items.push_back(ov::test::utils::create_and_fill_tensor(input.get_element_type(), item_shape, in_data));
+        }
+        return items;
+    }
+
+    static ov::Tensor gather(const std::vector<ov::Tensor>& items) {
+        auto shape = items.front().get_shape();
+        shape[0] = items.size();
+        ov::Tensor batched(items.front().get_element_type(), shape);
+        auto dst = static_cast<uint8_t*>(batched.data());
+        for (const auto& item : items) {
+            std::memcpy(dst, item.data(), item.get_byte_size());
+            dst += item.get_byte_size();
+        }
+        return batched;
+    }
+
+    // the items are read by the consumers if all of them are Reorder or Convert nodes
+    bool consumersReadBatchItems() const {
+        for (const auto& param : compiledModel.get_runtime_model()->get_parameters()) {
+            for (const auto& target : param->output(0).get_target_inputs()) {
+                const auto& rt_info = target.get_node()->get_rt_info();
+                const auto layer_type = rt_info.at(ov::exec_model_info::LAYER_TYPE).as<std::string>();
+                if (layer_type != "Reorder" && layer_type != "Convert")
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    // both requests run the same graph, so the results are equal up to the order of the accumulation
+    void compareOutputs(ov::InferRequest& request, ov::InferRequest& reference) {
+        for (const auto& output : compiledModel.outputs()) {
+            ov::test::utils::compare(reference.get_tensor(output),
+                                     request.get_tensor(output),
+                                     1e-5,
+                                     1e-5);
+        }
+    }
+
+    void inferWithItems(ov::InferRequest& request, ov::InferRequest& reference, const std::vector<ov::Tensor>& items) {
+        const auto& input = compiledModel.input();
+        // the tensor set before, it is replaced by the gathered one if the items are gathered
+        ov::Tensor previous(input.get_element_type(), input.get_shape());
+        request.set_tensor(input, previous);
+        request.set_tensors(input, items);
+        request.infer();
+
+        reference.set_tensor(input, gather(items));
+        reference.infer();
+        compareOutputs(request, reference);
+
+        if (consumersReadBatchItems()) {
+            ASSERT_EQ(request.get_tensor(input).data(), previous.data()) << "The batch items are gathered";
+        } else {
+            ASSERT_NE(request.get_tensor(input).data(), previous.data()) << "The batch items are not gathered";
+        }
+    }
+
+    void inferWithTensor(ov::InferRequest& request, ov::InferRequest& reference, const ov::Tensor& tensor) {
+        const auto& input = compiledModel.input();
+        request.set_tensor(input, tensor);
+        request.infer();
+        reference.set_tensor(input, tensor);
+        reference.infer();
+        compareOutputs(request, reference);
+    }
+
+    static constexpr size_t batch = 4;
+};
+
+TEST_P(SetTensorsBatchItemsCPUTest, CompareWithGathered) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    compile_model();
+    if (GetParam() == BatchItemsConsumer::Fallback)
+        ASSERT_FALSE(consumersReadBatchItems());
+
+    auto request = compiledModel.create_infer_request();
+    auto reference = compiledModel.create_infer_request();
+
+    inferWithItems(request, reference, makeItems(1));
+    // other items
+    inferWithItems(request, reference, makeItems(10));
+    // set_tensor after set_tensors, the input memory must be read again instead of the items
+    inferWithTensor(request, reference, gather(makeItems(20)));
+    // and back
+    inferWithItems(request, reference, makeItems(30));
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_SetTensorsBatchItems,
+                         SetTensorsBatchItemsCPUTest,
+                         ::testing::Values(BatchItemsConsumer::Convert,
+                                           BatchItemsConsumer::Reorder,
+                                           BatchItemsConsumer::Fallback),
+                         SetTensorsBatchItemsCPUTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
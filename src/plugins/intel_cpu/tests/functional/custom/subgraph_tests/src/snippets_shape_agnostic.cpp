@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "internal_properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+/*This test runs the following subgraph:
+
+                 param0      param1
+                    |  \       |
+                    |   \      |
+                    |     Add
+                    |      |
+                    |     Relu
+                    |      |
+                    \  Multiply
+                          |
+                        Result
+
+The eltwise chain is tokenized to the dynamic Subgraph. Its code depends only on the broadcasting pattern of the shapes
+(which dimensions are equal to 1), so the test checks that the kernel is generated once per pattern, not per shape.
+*/
+
+namespace ov {
+namespace test {
+
+using SnippetsShapeAgnosticParams = std::tuple<std::vector<InputShape>,  // input shapes
+                                               uint64_t>;                // expected number of the generated kernels
+
+class SnippetsShapeAgnosticCPUTest : public testing::WithParamInterface<SnippetsShapeAgnosticParams>,
+                                     virtual public SubgraphBaseTest,
+                                     public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsShapeAgnosticParams>& obj) {
+        std::vector<InputShape> inputShapes;
+        uint64_t kernelsNumber;
+        std::tie(inputShapes, kernelsNumber) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=";
+        for (const auto& shape : inputShapes) {
+            result << ov::test::utils::partialShape2str({shape.first}) << "_";
+        }
+        result << "TS=";
+        for (const auto& shape : inputShapes) {
+            result << "(";
+            for (const auto& item : shape.second) {
+                result << ov::test::utils::vec2str(item) << "_";
+            }
+            result << ")_";
+        }
+        result << "KernelsNumber=" << kernelsNumber;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        std::vector<InputShape> inputShapes;
+        std::tie(inputShapes, expectedKernelsNumber) = GetParam();
+        init_input_shapes(inputShapes);
+
+        const auto precision = ov::element::f32;
+        auto param0 = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes[0]);
+        auto param1 = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes[1]);
+        auto add = std::make_shared<ov::op::v1::Add>(param0, param1);
+        auto relu = std::make_shared<ov::op::v0::Relu>(add);
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(param0, relu);
+        auto result = std::make_shared<ov::op::v0::Result>(multiply);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result},
+                                               ov::ParameterVector{param0, param1},
+                                               "SnippetsShapeAgnostic");
+    }
+
+    uint64_t expectedKernelsNumber = 0;
+};
+
+TEST_P(SnippetsShapeAgnosticCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    // Snippets are supported on x64 with AVX2 and newer
+    if (!ov::with_cpu_x86_avx2())
+        GTEST_SKIP();
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::shared_kernels_number), expectedKernelsNumber);
+}
+
+namespace {
+
+const std::vector<std::vector<InputShape>> inputShapesOnePattern = {
+    {
+        {{-1, -1, -1}, {{2, 3, 17}, {4, 5, 64}, {3, 7, 33}, {2, 3, 17}, {8, 2, 1025}}},
+        {{-1, -1, 1}, {{2, 3, 1}, {4, 5, 1}, {3, 7, 1}, {2, 3, 1}, {8, 2, 1}}},
+    },
+    {
+        {{-1, -1, -1, -1}, {{2, 3, 4, 17}, {2, 3, 4, 8}, {5, 2, 3, 7}, {2, 3, 4, 17}}},
+        {{-1, -1, -1, -1}, {{2, 3, 4, 17}, {2, 3, 4, 8}, {5, 2, 3, 7}, {2, 3, 4, 17}}},
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsShapeAgnostic_OnePattern,
+                         SnippetsShapeAgnosticCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapesOnePattern),
+                                            ::testing::Values(1)),
+                         SnippetsShapeAgnosticCPUTest::getTestCaseName);
+
+// the second input is broadcasted by the last dimension only for the 2nd and the 4th shapes
+const std::vector<std::vector<InputShape>> inputShapesTwoPatterns = {
+    {
+        {{-1, -1, -1}, {{2, 3, 17}, {4, 5, 64}, {3, 7, 33}, {2, 3, 16}}},
+        {{-1, -1, -1}, {{2, 3, 17}, {4, 5, 1}, {3, 7, 33}, {2, 3, 1}}},
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsShapeAgnostic_TwoPatterns,
+                         SnippetsShapeAgnosticCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapesTwoPatterns),
+                                            ::testing::Values(2)),
+                         SnippetsShapeAgnosticCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
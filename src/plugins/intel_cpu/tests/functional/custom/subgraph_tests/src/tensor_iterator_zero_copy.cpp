@@ -0,0 +1,170 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following body of TensorIterator or Loop with static shapes:
+
+        X[:, i]        H (back edge, initial value H0)
+           |  \      /
+           |    Add
+         Relu    |
+           |    Tanh
+           |     |  \
+           Y   H_new  (back edge to H)
+
+  - H_new feeds the back edge and is also the concatenated output, so the output is copied from the swapped buffer;
+  - H_new is also the last iteration output;
+  - Y is the concatenated output, which is bound to the chunk of the external tensor if all the outer dims are 1;
+  - X is sliced with stride 1 or -1.
+Odd and even trip counts check that the result is taken from the right one of the swapped back edge buffers.
+The inference is repeated several times on the same request with different inputs.
+*/
+
+namespace ov {
+namespace test {
+
+enum class SubgraphOpType { TensorIterator, Loop };
+
+inline std::ostream& operator<<(std::ostream& os, SubgraphOpType type) {
+    switch (type) {
+    case SubgraphOpType::TensorIterator:
+        return os << "TensorIterator";
+    case SubgraphOpType::Loop:
+        return os << "Loop";
+    default:
+        OPENVINO_THROW("Unknown SubgraphOpType");
+    }
+}
+
+using TensorIteratorZeroCopyParams = std::tuple<SubgraphOpType,
+                                                ov::Shape,  // [batch, sequence length, channels]
+                                                int64_t>;   // slicing stride: 1 or -1
+
+class TensorIteratorZeroCopyCPUTest : public testing::WithParamInterface<TensorIteratorZeroCopyParams>,
+                                      virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TensorIteratorZeroCopyParams>& obj) {
+        SubgraphOpType type;
+        ov::Shape shape;
+        int64_t stride;
+        std::tie(type, shape, stride) = obj.param;
+
+        std::ostringstream result;
+        result << "Type=" << type << "_";
+        result << "IS=" << ov::test::utils::vec2str(shape) << "_";
+        result << "Stride=" << stride;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        SubgraphOpType type;
+        ov::Shape shape;
+        int64_t stride;
+        std::tie(type, shape, stride) = GetParam();
+
+        const size_t sequence_axis = 1;
+        const auto trip_count = static_cast<int64_t>(shape[sequence_axis]);
+        ov::Shape state_shape = shape;
+        state_shape[sequence_axis] = 1;
+        // the same static shapes are inferred several times
+        init_input_shapes({{shape, std::vector<ov::Shape>(inferCount, shape)},
+                           {state_shape, std::vector<ov::Shape>(inferCount, state_shape)}});
+
+        const auto prc = ov::element::f32;
+        auto x = std::make_shared<ov::op::v0::Parameter>(prc, shape);
+        auto h0 = std::make_shared<ov::op::v0::Parameter>(prc, state_shape);
+
+        auto x_i = std::make_shared<ov::op::v0::Parameter>(prc, state_shape);
+        auto h = std::make_shared<ov::op::v0::Parameter>(prc, state_shape);
+        auto add = std::make_shared<ov::op::v1::Add>(x_i, h);
+        auto h_new = std::make_shared<ov::op::v0::Tanh>(add);
+        auto y = std::make_shared<ov::op::v0::Relu>(x_i);
+        ov::OutputVector body_outputs{h_new, y};
+
+        std::shared_ptr<ov::op::util::SubGraphOp> subgraph_op;
+        if (type == SubgraphOpType::Loop) {
+            auto trip_count_const = ov::op::v0::Constant::create(ov::element::i64, {}, {trip_count});
+            auto exec_cond = ov::op::v0::Constant::create(ov::element::boolean, {}, {true});
+            auto loop = std::make_shared<ov::op::v5::Loop>(trip_count_const, exec_cond);
+            body_outputs.push_back(ov::op::v0::Constant::create(ov::element::boolean, {}, {true}));
+            loop->set_function(std::make_shared<ov::Model>(body_outputs, ov::ParameterVector{x_i, h}, "body"));
+            loop->set_special_body_ports({-1, 2});
+            subgraph_op = loop;
+        } else {
+            auto tensor_iterator = std::make_shared<ov::op::v0::TensorIterator>();
+            tensor_iterator->set_function(std::make_shared<ov::Model>(body_outputs, ov::ParameterVector{x_i, h}, "body"));
+            subgraph_op = tensor_iterator;
+        }
+
+        const int64_t start = stride > 0 ? 0 : -1;
+        const int64_t end = stride > 0 ? -1 : 0;
+        subgraph_op->set_sliced_input(x_i, x, start, stride, 1, end, sequence_axis);
+        subgraph_op->set_merged_input(h, h0, h_new);
+        auto h_last = subgraph_op->get_iter_value(h_new, -1);
+        auto h_all = subgraph_op->get_concatenated_slices(h_new, start, stride, 1, end, sequence_axis);
+        auto y_all = subgraph_op->get_concatenated_slices(y, start, stride, 1, end, sequence_axis);
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{h_last, h_all, y_all},
+                                               ov::ParameterVector{x, h0},
+                                               "TensorIteratorZeroCopy");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        // new values on every inference
+        seed++;
+        for (size_t i = 0; i < funcInputs.size(); i++) {
+            ov::test::utils::InputGenerateData inGenData(-2, 4, 128, seed);
+            auto tensor = ov::test::utils::create_and_fill_tensor(funcInputs[i].get_element_type(),
+                                                                   targetInputStaticShapes[i],
+                                                                   inGenData);
+            inputs.insert({funcInputs[i].get_node_shared_ptr(), tensor});
+        }
+    }
+
+    // the same request is reused, so the state left by the previous inference must not affect the next one
+    void infer() override {
+        if (!inferRequest)
+            inferRequest = compiledModel.create_infer_request();
+        for (const auto& input : inputs) {
+            inferRequest.set_tensor(input.first, input.second);
+        }
+        inferRequest.infer();
+    }
+
+    const size_t inferCount = 3;
+    int32_t seed = 0;
+};
+
+TEST_P(TensorIteratorZeroCopyCPUTest, CompareWithRefs) {
+    run();
+}
+
+namespace {
+
+const std::vector<ov::Shape> shapes = {
+    // odd and even trip counts
+    {1, 5, 16},
+    {1, 6, 16},
+    {1, 1, 8},
+    // the outer dims aren't 1, so the chunks are copied
+    {2, 5, 16},
+    {3, 4, 8},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorZeroCopy,
+                         TensorIteratorZeroCopyCPUTest,
+                         ::testing::Combine(::testing::Values(SubgraphOpType::TensorIterator, SubgraphOpType::Loop),
+                                            ::testing::ValuesIn(shapes),
+                                            ::testing::Values(1, -1)),
+                         TensorIteratorZeroCopyCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
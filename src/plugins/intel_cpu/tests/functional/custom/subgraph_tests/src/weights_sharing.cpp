@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/runtime/internal_properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                          param
+                            |
+                           Conv
+                            |
+                           Relu
+                            |
+                          Result
+
+The model is compiled twice. The compiled models with the same weights sharing id share one weights cache: the
+weights created by the first model are found by the second one, and both models give the same results as the
+reference. The compiled models with different ids don't share the weights.
+*/
+
+namespace ov {
+namespace test {
+
+class WeightsSharingCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{}, {{1, 32, 16, 16}}};
+        init_input_shapes({input_shape});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        auto conv = utils::make_convolution(param, precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                            ov::op::PadType::EXPLICIT, 32);
+        auto relu = std::make_shared<ov::op::v0::Relu>(conv);
+        auto result = std::make_shared<ov::op::v0::Result>(relu);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "WeightsSharing");
+    }
+
+    // compiles the model with the weights sharing id and checks its results against the ones of compiledModel
+    ov::CompiledModel compileAndCompare(const std::string& weightsSharingId) {
+        auto config = configuration;
+        config[ov::internal::weights_sharing_id.name()] = weightsSharingId;
+        auto model = core->compile_model(function, targetDevice, config);
+
+        auto request = model.create_infer_request();
+        for (const auto& input : inputs) {
+            request.set_tensor(input.first, input.second);
+        }
+        request.infer();
+        ov::test::utils::compare(inferRequest.get_tensor(compiledModel.output()), request.get_tensor(model.output()));
+        return model;
+    }
+};
+
+TEST_F(WeightsSharingCPUTest, smoke_SameIdSharesWeights) {
+    configuration.insert(ov::internal::weights_sharing_id("WeightsSharingCPUTest_Same"));
+    // compiles the first model and checks its results against the reference
+    run();
+    const auto hits = compiledModel.get_property(ov::intel_cpu::weights_cache_hits);
+
+    auto second = compileAndCompare("WeightsSharingCPUTest_Same");
+    // the second model found the weights created by the first one in the shared cache
+    ASSERT_GT(compiledModel.get_property(ov::intel_cpu::weights_cache_hits), hits);
+    ASSERT_EQ(second.get_property(ov::intel_cpu::weights_cache_hits),
+              compiledModel.get_property(ov::intel_cpu::weights_cache_hits));
+}
+
+TEST_F(WeightsSharingCPUTest, smoke_DifferentIdsDontShareWeights) {
+    configuration.insert(ov::internal::weights_sharing_id("WeightsSharingCPUTest_First"));
+    run();
+    const auto hits = compiledModel.get_property(ov::intel_cpu::weights_cache_hits);
+
+    compileAndCompare("WeightsSharingCPUTest_Second");
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::weights_cache_hits), hits);
+}
+
+}  // namespace test
+}  // namespace ov
@@ -444,3 +444,20 @@ TEST(makeDummyDesc, LowerBoundMoreThanDummyValue) {
     ASSERT_TRUE(definedDesc->isDefined());
     ASSERT_EQ((VectorDims{1, 3, 85, 144}), definedDesc->getShape().getStaticDims());
 }
+
+TEST(isDenseByBatch, CheckLayouts) {
+    auto isDenseByBatch = [] (dnnl::memory::format_tag fmt, dnnl::memory::dims dims) {
+        dnnl::memory::desc oneDnnDesc {dims, dnnl::memory::data_type::u8, fmt};
+        return MemoryDescUtils::isDenseByBatch(*DnnlExtensionUtils::makeDescriptor(oneDnnDesc));
+    };
+
+    ASSERT_TRUE(isDenseByBatch(dnnl::memory::format_tag::nchw, {4, 3, 10, 10}));
+    ASSERT_TRUE(isDenseByBatch(dnnl::memory::format_tag::nhwc, {4, 3, 10, 10}));
+    ASSERT_TRUE(isDenseByBatch(dnnl::memory::format_tag::nChw8c, {4, 3, 10, 10}));
+    ASSERT_FALSE(isDenseByBatch(dnnl::memory::format_tag::chwn, {4, 3, 10, 10}));
+    ASSERT_FALSE(isDenseByBatch(dnnl::memory::format_tag::NChw16n16c, {32, 16, 10, 10}));
+
+    // the batch items don't follow each other
+    CpuBlockedMemoryDesc stridedDesc(ov::element::u8, Shape(VectorDims{4, 3, 10}), {4, 3, 10}, {0, 1, 2}, 0, {0, 0, 0}, {64, 10, 1});
+    ASSERT_FALSE(MemoryDescUtils::isDenseByBatch(stridedDesc));
+}
@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "dynamic_mem_planner.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+bool overlap(const MemoryMngrPtr& mngr1, size_t size1, const MemoryMngrPtr& mngr2, size_t size2) {
+    auto ptr1 = static_cast<uint8_t*>(mngr1->getRawPtr());
+    auto ptr2 = static_cast<uint8_t*>(mngr2->getRawPtr());
+    return ptr1 < ptr2 + size2 && ptr2 < ptr1 + size1;
+}
+}  // namespace
+
+TEST(DynamicMemoryPlannerTest, PlanIsReusedWhenShapesShrink) {
+    DynamicMemoryPlanner planner;
+    auto mngr1 = planner.addBox(0, 1);
+    auto mngr2 = planner.addBox(1, 2);
+    auto mngr3 = planner.addBox(2, 3);
+
+    // the first inference, there is no plan yet
+    ASSERT_TRUE(mngr1->resize(1000));
+    ASSERT_TRUE(mngr2->resize(1000));
+    ASSERT_TRUE(mngr3->resize(1000));
+    planner.update();
+    ASSERT_GT(planner.arenaSize(), 0u);
+    // the boxes with overlapping lifetimes don't share the memory
+    ASSERT_FALSE(overlap(mngr1, 1000, mngr2, 1000));
+    ASSERT_FALSE(overlap(mngr2, 1000, mngr3, 1000));
+
+    auto ptr1 = mngr1->getRawPtr();
+    auto ptr2 = mngr2->getRawPtr();
+    auto ptr3 = mngr3->getRawPtr();
+    const auto arenaSize = planner.arenaSize();
+
+    // smaller shapes fit into the plan
+    ASSERT_FALSE(mngr1->resize(500));
+    ASSERT_FALSE(mngr2->resize(1000));
+    ASSERT_FALSE(mngr3->resize(10));
+    planner.update();
+    ASSERT_EQ(ptr1, mngr1->getRawPtr());
+    ASSERT_EQ(ptr2, mngr2->getRawPtr());
+    ASSERT_EQ(ptr3, mngr3->getRawPtr());
+    ASSERT_EQ(arenaSize, planner.arenaSize());
+}
+
+TEST(DynamicMemoryPlannerTest, PlanGrowsGeometrically) {
+    DynamicMemoryPlanner planner;
+    auto mngr1 = planner.addBox(0, 1);
+    auto mngr2 = planner.addBox(1, 2);
+
+    ASSERT_TRUE(mngr1->resize(1000));
+    ASSERT_TRUE(mngr2->resize(1000));
+    planner.update();
+    const auto arenaSize = planner.arenaSize();
+
+    // the box outgrew its partition, it gets a private buffer till the end of the inference
+    ASSERT_TRUE(mngr2->resize(1500));
+    ASSERT_NE(nullptr, mngr2->getRawPtr());
+    planner.update();
+    ASSERT_GE(planner.arenaSize(), 2 * arenaSize);
+    ASSERT_FALSE(overlap(mngr1, 1000, mngr2, 1500));
+
+    // the partition has grown geometrically, so the next growth doesn't need a new plan
+    ASSERT_FALSE(mngr2->resize(2000));
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "graph.h"
+#include "nodes/input.h"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// pass-through shape inference which counts its calls
+class CountingShapeInfer : public ShapeInferEmptyPads {
+public:
+    explicit CountingShapeInfer(std::shared_ptr<size_t> counter) : m_counter(std::move(counter)) {}
+    Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                 const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        (*m_counter)++;
+        return {{input_shapes.front().get()}, ShapeInferStatus::success};
+    }
+    port_mask_t get_port_mask() const override {
+        return EMPTY_PORT_MASK;
+    }
+
+private:
+    std::shared_ptr<size_t> m_counter;
+};
+
+// dynamic node which copies its input to the output
+class CopyNode : public Node {
+public:
+    CopyNode(const ov::PartialShape& shape, const GraphContext::CPtr context, std::shared_ptr<size_t> counter)
+        : Node("DummyNode",
+               {Shape(shape)},
+               {Shape(shape)},
+               {ov::element::f32},
+               {ov::element::f32},
+               "copy",
+               context) {
+        isDynamic = true;
+        shapeInference = std::make_shared<CountingShapeInfer>(std::move(counter));
+    }
+
+    void getSupportedDescriptors() override {}
+    void initSupportedPrimitiveDescriptors() override {
+        if (!supportedPrimitiveDescriptors.empty())
+            return;
+        addSupportedPrimDesc({{LayoutType::ncsp, ov::element::f32}},
+                             {{LayoutType::ncsp, ov::element::f32}},
+                             impl_desc_type::ref_any);
+    }
+    bool created() const override {
+        return true;
+    }
+    bool needPrepareParams() const override {
+        return false;
+    }
+    void execute(dnnl::stream strm) override {
+        const auto& src = getSrcMemoryAtPort(0);
+        std::memcpy(getDstDataAtPort(0), src->getData(), src->getSize());
+    }
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
+};
+
+}  // namespace
+
+TEST(OutputDimsCacheCPUTest, smoke_Reuse_Output_Dims_For_Repeated_Input_Shapes) {
+    const ov::PartialShape shape{-1, -1};
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto result = std::make_shared<ov::op::v0::Result>(param);
+
+    Config conf;
+    conf.rtCacheCapacity = 100;
+    auto context = std::make_shared<GraphContext>(conf, nullptr, false);
+
+    auto counter = std::make_shared<size_t>(0);
+    auto inputNode = std::make_shared<node::Input>(param, context);
+    auto copyNode = std::make_shared<CopyNode>(shape, context, counter);
+    auto outputNode = std::make_shared<node::Input>(result, context);
+
+    std::vector<EdgePtr> graphEdges;
+    auto addEdge = [&](const NodePtr& parent, const NodePtr& child) {
+        auto edge = std::make_shared<Edge>(parent, child, 0, 0);
+        Node::addEdge(edge);
+        graphEdges.push_back(edge);
+    };
+    addEdge(inputNode, copyNode);
+    addEdge(copyNode, outputNode);
+
+    Graph graph;
+    graph.CreateGraph({inputNode, copyNode, outputNode}, graphEdges, context, "output_dims_cache");
+    ASSERT_EQ(graph.getStatus(), Graph::Status::ReadyDynamic);
+
+    // the shapes alternate, so the input shapes of the node are modified on every inference
+    const std::vector<VectorDims> inputDims{{2, 3}, {4, 5}, {1, 7}, {2, 3}, {4, 5}, {1, 7}, {4, 5}, {2, 3}};
+    for (size_t i = 0; i < inputDims.size(); i++) {
+        const auto& dims = inputDims[i];
+        inputNode->redefineOutputMemory({dims});
+        auto input = inputNode->getChildEdgeAt(0)->getMemoryPtr()->getDataAs<float>();
+        const size_t size = dims[0] * dims[1];
+        for (size_t j = 0; j < size; j++) {
+            input[j] = static_cast<float>(i * 100 + j);
+        }
+
+        graph.Infer();
+
+        const auto& output = outputNode->getParentEdgeAt(0)->getMemoryPtr();
+        ASSERT_EQ(output->getStaticDims(), dims);
+        auto outputData = output->getDataAs<const float>();
+        for (size_t j = 0; j < size; j++) {
+            ASSERT_EQ(outputData[j], static_cast<float>(i * 100 + j));
+        }
+    }
+
+    // the shape inference has run only once per distinct input shapes
+    ASSERT_EQ(*counter, 3);
+}
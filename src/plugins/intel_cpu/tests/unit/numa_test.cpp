@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include "utils/numa.h"
+
+using namespace ov::intel_cpu;
+
+TEST(NumaTest, NoPlacementForUnknownNode) {
+    std::vector<uint8_t> buffer(1 << 20);
+    ASSERT_FALSE(placeOnNumaNode(buffer.data(), buffer.size(), -1));
+    ASSERT_FALSE(placeOnNumaNode(nullptr, buffer.size(), 0));
+}
+
+TEST(NumaTest, ResidentBytesOfTouchedPages) {
+    std::vector<uint8_t> buffer(4 << 20);
+    std::memset(buffer.data(), 1, buffer.size());
+
+    std::map<int, size_t> bytesPerNode;
+    countNumaResidentBytes(buffer.data(), buffer.size(), bytesPerNode);
+    // the numa information is not available on every system
+    if (bytesPerNode.empty())
+        GTEST_SKIP();
+
+    size_t total = 0;
+    for (const auto& item : bytesPerNode) {
+        ASSERT_GE(item.first, 0);
+        total += item.second;
+    }
+    // all the pages are touched, the sampled bytes differ from the size by the rounding only
+    ASSERT_NEAR(static_cast<double>(total), static_cast<double>(buffer.size()), buffer.size() / 100.0);
+}
+
+TEST(NumaTest, NoResidentBytesOfEmptyBuffer) {
+    std::map<int, size_t> bytesPerNode;
+    countNumaResidentBytes(nullptr, 1 << 20, bytesPerNode);
+    std::vector<uint8_t> buffer(16);
+    countNumaResidentBytes(buffer.data(), 0, bytesPerNode);
+    ASSERT_TRUE(bytesPerNode.empty());
+}
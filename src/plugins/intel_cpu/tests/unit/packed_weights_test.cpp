@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "packed_weights.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+std::shared_ptr<ov::AlignedBuffer> toBuffer(const std::string& blob) {
+    auto buffer = std::make_shared<ov::AlignedBuffer>(blob.size());
+    std::memcpy(buffer->get_ptr(), blob.data(), blob.size());
+    return buffer;
+}
+}  // namespace
+
+TEST(PackedWeightsTest, ReadFromModelBuffer) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{10, 3});
+    auto weights = std::make_shared<Memory>(eng, desc);
+    auto data = weights->getDataAs<float>();
+    for (size_t i = 0; i < 30; i++) {
+        data[i] = static_cast<float>(i);
+    }
+    const auto key = PackedWeights::key("fc", "ab", ov::element::f32);
+
+    std::stringstream stream;
+    // the header of the cache blob
+    stream << "header";
+    PackedWeights::write(stream, {{key, weights}});
+    stream << "model";
+
+    const auto blob = stream.str();
+    std::istringstream istream(blob);
+    istream.seekg(6);
+    auto packedWeights = PackedWeights::read(istream, toBuffer(blob));
+    ASSERT_NE(packedWeights, nullptr);
+    // the stream is left at the model
+    std::string model;
+    istream >> model;
+    ASSERT_EQ(model, "model");
+
+    auto packed = packedWeights->find(key, eng, desc);
+    ASSERT_NE(packed, nullptr);
+    ASSERT_EQ(std::memcmp(packed->getData(), weights->getData(), weights->getSize()), 0);
+    // the weights are copied out of the blob
+    auto buffer = toBuffer(blob);
+    std::istringstream bufferStream(blob);
+    bufferStream.seekg(6);
+    packedWeights = PackedWeights::read(bufferStream, buffer);
+    ASSERT_NE(packedWeights, nullptr);
+    packed = packedWeights->find(key, eng, desc);
+    ASSERT_NE(packed, nullptr);
+    ASSERT_TRUE(packed->getDataAs<char>() < buffer->get_ptr<char>() ||
+                packed->getDataAs<char>() >= buffer->get_ptr<char>() + buffer->size());
+    // the other layout or size must be reordered
+    ASSERT_EQ(packedWeights->find(PackedWeights::key("fc", "ba", ov::element::f32), eng, desc), nullptr);
+    auto otherDesc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{10, 4});
+    ASSERT_EQ(packedWeights->find(key, eng, otherDesc), nullptr);
+}
+
+TEST(PackedWeightsTest, SkippedWithoutModelBuffer) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{4});
+    auto weights = std::make_shared<Memory>(eng, desc);
+
+    std::stringstream stream;
+    PackedWeights::write(stream, {{PackedWeights::key("fc", "a", ov::element::f32), weights}});
+    stream << "model";
+
+    ASSERT_EQ(PackedWeights::read(stream, nullptr), nullptr);
+    std::string model;
+    stream >> model;
+    ASSERT_EQ(model, "model");
+}
+
+TEST(PackedWeightsTest, BlobWithoutPackedWeights) {
+    std::istringstream stream("model of the older version");
+    ASSERT_EQ(PackedWeights::read(stream, toBuffer(stream.str())), nullptr);
+    ASSERT_EQ(static_cast<size_t>(stream.tellg()), 0u);
+}
+
+TEST(PackedWeightsTest, CorruptedKeyLength) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{4});
+    auto weights = std::make_shared<Memory>(eng, desc);
+
+    std::stringstream stream;
+    PackedWeights::write(stream, {{PackedWeights::key("fc", "a", ov::element::f32), weights}});
+    auto blob = stream.str();
+    // the key length follows the magic and the number of entries
+    const uint64_t keySize = std::numeric_limits<uint64_t>::max() / 2;
+    std::memcpy(&blob[2 * sizeof(uint64_t)], &keySize, sizeof(keySize));
+
+    std::istringstream istream(blob);
+    ASSERT_THROW(PackedWeights::read(istream, toBuffer(blob)), ov::Exception);
+}
@@ -0,0 +1,171 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "request_scheduler.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+// keeps the tasks until they are run explicitly, like a streams executor with a single busy stream
+struct ManualExecutor : public ov::threading::ITaskExecutor {
+    void run(ov::threading::Task task) override {
+        tasks.push_back(std::move(task));
+    }
+    void run_all() {
+        while (!tasks.empty()) {
+            auto task = std::move(tasks.front());
+            tasks.pop_front();
+            task();
+        }
+    }
+    std::deque<ov::threading::Task> tasks;
+};
+
+// executes the tasks in the caller thread like a streams executor, and counts them
+struct CountingStreamsExecutor : public ov::threading::IStreamsExecutor {
+    void run(ov::threading::Task task) override {
+        task();
+    }
+    void execute(ov::threading::Task task) override {
+        executed++;
+        task();
+    }
+    int get_stream_id() override {
+        return 1;
+    }
+    int get_numa_node_id() override {
+        return 2;
+    }
+    int get_socket_id() override {
+        return 3;
+    }
+    std::atomic<int> executed{0};
+};
+}  // namespace
+
+TEST(RequestSchedulerTest, PriorityThenEarliestDeadlineFirst) {
+    auto executor = std::make_shared<ManualExecutor>();
+    auto& scheduler = RequestScheduler::instance();
+    const auto now = RequestScheduler::Clock::now();
+    const auto no_deadline = RequestScheduler::Clock::time_point::max();
+
+    std::vector<std::string> order;
+    scheduler.run(executor, ov::hint::Priority::LOW, now, [&] {
+        order.push_back("low");
+    });
+    scheduler.run(executor, ov::hint::Priority::MEDIUM, no_deadline, [&] {
+        order.push_back("medium_no_deadline");
+    });
+    scheduler.run(executor, ov::hint::Priority::MEDIUM, now + std::chrono::milliseconds(20), [&] {
+        order.push_back("medium_late");
+    });
+    scheduler.run(executor, ov::hint::Priority::MEDIUM, now + std::chrono::milliseconds(10), [&] {
+        order.push_back("medium_early");
+    });
+    scheduler.run(executor, ov::hint::Priority::HIGH, no_deadline, [&] {
+        order.push_back("high");
+    });
+    // every task has its trampoline
+    ASSERT_EQ(executor->tasks.size(), 5);
+    executor->run_all();
+
+    const std::vector<std::string> expected{"high", "medium_early", "medium_late", "medium_no_deadline", "low"};
+    ASSERT_EQ(order, expected);
+}
+
+TEST(RequestSchedulerTest, PreemptionPointWaitsForHigherPriority) {
+    auto low_executor = std::make_shared<ManualExecutor>();
+    auto high_executor = std::make_shared<ManualExecutor>();
+    auto& scheduler = RequestScheduler::instance();
+    const auto no_deadline = RequestScheduler::Clock::time_point::max();
+
+    std::atomic<bool> high_started{false};
+    std::atomic<bool> high_finished{false};
+    std::atomic<bool> low_resumed_after_high{false};
+
+    scheduler.run(high_executor, ov::hint::Priority::HIGH, no_deadline, [&] {
+        high_started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        high_finished = true;
+    });
+    scheduler.run(low_executor, ov::hint::Priority::LOW, no_deadline, [&] {
+        while (!high_started) {
+            std::this_thread::yield();
+        }
+        RequestScheduler::preemption_point();
+        low_resumed_after_high = high_finished.load();
+    });
+
+    std::thread high_thread([&] {
+        high_executor->run_all();
+    });
+    low_executor->run_all();
+    high_thread.join();
+
+    ASSERT_TRUE(low_resumed_after_high);
+}
+
+TEST(RequestSchedulerTest, PreemptionPointOutsideScheduledTask) {
+    // must not block the threads which don't run a scheduled task
+    RequestScheduler::preemption_point();
+}
+
+TEST(RequestSchedulerTest, ExecuteWaitsForHigherPriority) {
+    auto high_executor = std::make_shared<ManualExecutor>();
+    auto& scheduler = RequestScheduler::instance();
+    const auto no_deadline = RequestScheduler::Clock::time_point::max();
+
+    std::atomic<bool> high_started{false};
+    std::atomic<bool> high_finished{false};
+    scheduler.run(high_executor, ov::hint::Priority::HIGH, no_deadline, [&] {
+        high_started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        high_finished = true;
+    });
+    std::thread high_thread([&] {
+        high_executor->run_all();
+    });
+    while (!high_started) {
+        std::this_thread::yield();
+    }
+
+    bool started_after_high = false;
+    scheduler.execute(ov::hint::Priority::LOW, [&] {
+        started_after_high = high_finished.load();
+        // the executed task is counted as a scheduled one
+        RequestScheduler::preemption_point();
+    });
+    high_thread.join();
+
+    ASSERT_TRUE(started_after_high);
+}
+
+TEST(RequestSchedulerTest, SchedulingExecutorExecutesOnStreamsExecutor) {
+    auto streams_executor = std::make_shared<CountingStreamsExecutor>();
+    std::shared_ptr<ov::threading::ITaskExecutor> executor =
+        std::make_shared<SchedulingExecutor>(streams_executor, ov::hint::Priority::MEDIUM, std::chrono::milliseconds(0));
+
+    // the synchronous inference uses the streams executor if the request executor is one
+    auto scheduling_streams_executor = std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(executor);
+    ASSERT_NE(scheduling_streams_executor, nullptr);
+    ASSERT_EQ(scheduling_streams_executor->get_stream_id(), 1);
+    ASSERT_EQ(scheduling_streams_executor->get_numa_node_id(), 2);
+    ASSERT_EQ(scheduling_streams_executor->get_socket_id(), 3);
+
+    bool executed = false;
+    scheduling_streams_executor->execute([&] {
+        executed = true;
+    });
+    ASSERT_TRUE(executed);
+    ASSERT_EQ(streams_executor->executed, 1);
+}
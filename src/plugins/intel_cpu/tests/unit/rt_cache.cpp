@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -9,6 +12,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/shared_multi_cache.h"
 
 using namespace ov::intel_cpu;
 
@@ -379,3 +383,84 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(SharedMultiCacheTests, CreatedOnce) {
+    constexpr int capacity = 10;
+    constexpr size_t numThreads = 30;
+    using IntValueType = std::shared_ptr<int>;
+
+    std::atomic<int> numCreated{0};
+    auto intBuilder = [&](const IntKey& key) {
+        numCreated++;
+        return std::make_shared<int>(key.data);
+    };
+
+    SharedMultiCache cache(capacity);
+    std::vector<IntValueType> results(numThreads);
+
+    auto testRoutine = [&](size_t idx) {
+        results[idx] = cache.getOrCreate(IntKey{1}, intBuilder).first;
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine, i));
+        }
+    }
+
+    // all the threads share the same value
+    ASSERT_EQ(numCreated, 1);
+    for (const auto& result : results) {
+        ASSERT_EQ(result, results.front());
+    }
+}
+
+TEST(SharedMultiCacheTests, DifferentKeysCreatedInParallel) {
+    constexpr int capacity = 10;
+    constexpr int numKeys = 4;
+
+    // each builder waits until all the builders have started, so it fails if the values are created one by one
+    std::atomic<int> numStarted{0};
+    auto intBuilder = [&](const IntKey& key) {
+        numStarted++;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (numStarted < numKeys && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+        return std::make_shared<int>(numStarted == numKeys ? key.data : -1);
+    };
+
+    SharedMultiCache cache(capacity);
+    std::vector<std::shared_ptr<int>> results(numKeys);
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numKeys);
+        for (int i = 0; i < numKeys; ++i) {
+            vecThreads.emplace_back(std::thread([&, i]() {
+                results[i] = cache.getOrCreate(IntKey{i}, intBuilder).first;
+            }));
+        }
+    }
+
+    ASSERT_EQ(cache.getCreatedNumber(), static_cast<size_t>(numKeys));
+    for (int i = 0; i < numKeys; ++i) {
+        ASSERT_EQ(*results[i], i);
+    }
+}
+
+TEST(SharedMultiCacheTests, FailedCreationIsRepeated) {
+    SharedMultiCache cache(10);
+    auto throwingBuilder = [](const IntKey&) -> std::shared_ptr<int> {
+        throw std::runtime_error("the value can't be created");
+    };
+    ASSERT_ANY_THROW(cache.getOrCreate(IntKey{1}, throwingBuilder));
+
+    auto result = cache.getOrCreate(IntKey{1}, [](const IntKey& key) {
+        return std::make_shared<int>(key.data);
+    });
+    ASSERT_EQ(*result.first, 1);
+    ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(cache.getCreatedNumber(), 2u);
+}
@@ -0,0 +1,143 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include <transformations/cpu_opset/common/op/preprocess.hpp>
+#include <transformations/cpu_opset/common/pass/preprocess_fusion.hpp>
+
+#include "openvino/core/preprocess/pre_post_process.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/opsets/opset1.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+namespace {
+std::shared_ptr<ov::Model> makeModel(const ov::Shape& shape, ov::element::Type type = ov::element::f32) {
+    auto input = std::make_shared<ov::opset1::Parameter>(type, shape);
+    auto relu = std::make_shared<ov::opset1::Relu>(input);
+    return std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{input});
+}
+}  // namespace
+
+class PreprocessFusionTest: public TransformationTestsF {
+public:
+    PreprocessFusionTest() : TransformationTestsF() {
+        comparator.enable(FunctionsComparator::CmpValues::ATTRIBUTES);
+    }
+};
+
+TEST_F(PreprocessFusionTest, NV12TwoPlanesToNCHW) {
+    const std::vector<float> mean = {123.675f, 116.28f, 103.53f};
+    const std::vector<float> scale = {58.395f, 57.12f, 57.375f};
+    {
+        model = makeModel(ov::Shape{1, 3, 224, 224});
+        ov::preprocess::PrePostProcessor ppp(model);
+        ppp.input().tensor()
+            .set_element_type(ov::element::u8)
+            .set_color_format(ov::preprocess::ColorFormat::NV12_TWO_PLANES)
+            .set_spatial_static_shape(480, 640);
+        ppp.input().preprocess()
+            .convert_element_type(ov::element::f32)
+            .convert_color(ov::preprocess::ColorFormat::BGR)
+            .resize(ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR)
+            .mean(mean)
+            .scale(scale);
+        ppp.input().model().set_layout("NCHW");
+        model = ppp.build();
+        manager.register_pass<PreprocessFusion>();
+    }
+    {
+        auto y = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::Shape{1, 480, 640, 1});
+        auto uv = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::Shape{1, 240, 320, 2});
+        PreprocessNode::Config config;
+        config.is_nv12 = true;
+        config.is_bgr = true;
+        config.round_color = false;
+        config.resize = true;
+        config.resize_height = 224;
+        config.resize_width = 224;
+        for (size_t c = 0; c < 3; c++) {
+            config.scale[c] = 1.f / scale[c];
+            config.shift[c] = -mean[c] / scale[c];
+        }
+        config.output_nchw = true;
+        auto preprocess = std::make_shared<PreprocessNode>(ov::OutputVector{y, uv}, config);
+        auto relu = std::make_shared<ov::opset1::Relu>(preprocess);
+        model_ref = std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{y, uv});
+    }
+}
+
+TEST_F(PreprocessFusionTest, InterleavedFrameToNHWC) {
+    {
+        model = makeModel(ov::Shape{1, 224, 224, 3});
+        ov::preprocess::PrePostProcessor ppp(model);
+        ppp.input().tensor()
+            .set_element_type(ov::element::u8)
+            .set_layout("NHWC")
+            .set_spatial_static_shape(480, 640);
+        ppp.input().preprocess()
+            .convert_element_type(ov::element::f32)
+            .resize(ov::preprocess::ResizeAlgorithm::RESIZE_NEAREST)
+            .scale(255.f);
+        ppp.input().model().set_layout("NHWC");
+        model = ppp.build();
+        manager.register_pass<PreprocessFusion>();
+    }
+    {
+        auto frame = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::Shape{1, 480, 640, 3});
+        PreprocessNode::Config config;
+        config.resize = true;
+        config.resize_mode = ov::op::util::InterpolateBase::InterpolateMode::NEAREST;
+        config.resize_height = 224;
+        config.resize_width = 224;
+        config.scale = std::vector<float>(3, 1.f / 255.f);
+        auto preprocess = std::make_shared<PreprocessNode>(ov::OutputVector{frame}, config);
+        auto relu = std::make_shared<ov::opset1::Relu>(preprocess);
+        model_ref = std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{frame});
+    }
+}
+
+TEST_F(PreprocessFusionTest, U8ColorConversionIsNotFused) {
+    model = makeModel(ov::Shape{1, 480, 640, 3}, ov::element::u8);
+    ov::preprocess::PrePostProcessor ppp(model);
+    ppp.input().tensor().set_color_format(ov::preprocess::ColorFormat::NV12_SINGLE_PLANE);
+    ppp.input().preprocess().convert_color(ov::preprocess::ColorFormat::RGB);
+    model = ppp.build();
+    manager.register_pass<PreprocessFusion>();
+}
+
+TEST_F(PreprocessFusionTest, AlignCornersResizeIsNotFused) {
+    auto frame = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::Shape{1, 480, 640, 3});
+    auto convert = std::make_shared<ov::opset1::Convert>(frame, ov::element::f32);
+    ov::op::v11::Interpolate::InterpolateAttrs attrs;
+    attrs.mode = ov::op::v11::Interpolate::InterpolateMode::LINEAR;
+    attrs.shape_calculation_mode = ov::op::v11::Interpolate::ShapeCalcMode::SIZES;
+    attrs.coordinate_transformation_mode = ov::op::v11::Interpolate::CoordinateTransformMode::ALIGN_CORNERS;
+    auto sizes = ov::opset1::Constant::create(ov::element::i64, {2}, {224, 224});
+    auto axes = ov::opset1::Constant::create(ov::element::i64, {2}, {1, 2});
+    auto interpolate = std::make_shared<ov::op::v11::Interpolate>(convert, sizes, axes, attrs);
+    auto relu = std::make_shared<ov::opset1::Relu>(interpolate);
+    model = std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{frame});
+    manager.register_pass<PreprocessFusion>();
+}
+
+TEST_F(PreprocessFusionTest, ConstantChainIsNotFused) {
+    // u8 weights decompressed and scaled like a frame
+    auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 3, 16, 16});
+    auto weights = ov::opset1::Constant::create(ov::element::u8, ov::Shape{8, 3, 3, 3}, {1});
+    auto convert = std::make_shared<ov::opset1::Convert>(weights, ov::element::f32);
+    auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{}, {0.5f});
+    auto multiply = std::make_shared<ov::opset1::Multiply>(convert, scale);
+    auto conv = std::make_shared<ov::opset1::Convolution>(input,
+                                                          multiply,
+                                                          ov::Strides{1, 1},
+                                                          ov::CoordinateDiff{0, 0},
+                                                          ov::CoordinateDiff{0, 0},
+                                                          ov::Strides{1, 1});
+    model = std::make_shared<ov::Model>(ov::NodeVector{conv}, ov::ParameterVector{input});
+    manager.register_pass<PreprocessFusion>();
+}
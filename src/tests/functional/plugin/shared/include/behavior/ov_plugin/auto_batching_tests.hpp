@@ -147,6 +147,89 @@ public:
     }
 };
 
+using AutoBatchPartialBatchParams = std::tuple<
+        std::string,  // device name
+        size_t,       // number of requests
+        size_t,       // batch size
+        bool>;        // adaptive timeout
+
+// The number of the requests is less than the batch size, so the batch is never full: the collected requests are
+// executed when the timeout is over, either one by one or as the padded batch (with the adaptive timeout)
+class AutoBatching_Test_PartialBatch : public OVPluginTestBase,
+                                       public testing::WithParamInterface<AutoBatchPartialBatchParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchPartialBatchParams> &obj) {
+        size_t requests, batch;
+        bool adaptive;
+        std::string target_device;
+        std::tie(target_device, requests, batch, adaptive) = obj.param;
+        return target_device + "_batch_size_" + std::to_string(batch) + "_num_req_" + std::to_string(requests) +
+               (adaptive ? "_adaptive_timeout" : "");
+    }
+
+protected:
+    size_t num_requests;
+    size_t num_batch;
+    bool adaptive_timeout;
+
+    void SetUp() override {
+        std::tie(target_device, num_requests, num_batch, adaptive_timeout) = this->GetParam();
+    };
+};
+
+TEST_P(AutoBatching_Test_PartialBatch, compareAutoBatchingToSingleBatch) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto model = ov::test::utils::make_single_conv();
+    const auto input = model->input();
+    const auto output = model->output();
+
+    ov::AnyMap config = {ov::auto_batch_timeout(50), ov::auto_batch_adaptive_timeout(adaptive_timeout)};
+    auto compiled_model = core->compile_model(model, std::string(ov::test::utils::DEVICE_BATCH) + ":" +
+                                              target_device + "(" + std::to_string(num_batch) + ")",
+                                              config);
+    auto compiled_model_ref = core->compile_model(model, ov::test::utils::DEVICE_TEMPLATE);
+
+    std::vector<ov::InferRequest> irs, irs_ref;
+    for (size_t j = 0; j < num_requests; j++) {
+        irs.push_back(compiled_model.create_infer_request());
+        irs_ref.push_back(compiled_model_ref.create_infer_request());
+    }
+
+    // the first partial batch is executed one by one, which gives the statistics to choose the padded batch later
+    const size_t num_rounds = 4;
+    for (size_t round = 0; round < num_rounds; round++) {
+        for (size_t j = 0; j < num_requests; j++) {
+            ov::test::utils::InputGenerateData in_data(0, 10, 1, static_cast<int32_t>(round * num_requests + j + 1));
+            auto tensor = ov::test::utils::create_and_fill_tensor(input.get_element_type(), input.get_shape(), in_data);
+            irs[j].set_tensor(input, tensor);
+            irs_ref[j].set_tensor(input, tensor);
+            irs_ref[j].infer();
+        }
+
+        for (auto& ir : irs) {
+            ir.start_async();
+        }
+        // the batch is never full, so the requests are completed by the timeout
+        for (auto& ir : irs) {
+            ASSERT_TRUE(ir.wait_for(std::chrono::seconds(10)));
+        }
+
+        for (size_t j = 0; j < num_requests; j++) {
+            ov::test::utils::compare(irs_ref[j].get_tensor(output), irs[j].get_tensor(output));
+        }
+    }
+
+    // only the batched executions are counted, so the padded batches are executed with the adaptive timeout only
+    const auto executed_batch_size = compiled_model.get_property(ov::auto_batch_executed_batch_size);
+    ASSERT_LE(executed_batch_size, static_cast<float>(num_requests));
+    if (adaptive_timeout) {
+        ASSERT_GT(executed_batch_size, 0.f);
+    } else {
+        ASSERT_EQ(executed_batch_size, 0.f);
+    }
+}
+
 TEST_P(AutoBatching_Test, compareAutoBatchingToSingleBatch) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED()
     TestAutoBatch();